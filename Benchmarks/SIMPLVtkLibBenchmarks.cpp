@@ -0,0 +1,531 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QThread>
+#include <QtWidgets/QApplication>
+
+#include <vtkCellData.h>
+#include <vtkDataSet.h>
+#include <vtkVersion.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdFilter.h"
+
+/**
+ * @brief SIMPLVtkLibBenchmarks builds synthetic DataContainers in memory and times
+ * the SIMPLVtkBridge wrapping and visual filter apply() paths without rendering.
+ * Results are written as JSON to stdout or to the file given by --output.
+ */
+
+namespace
+{
+const QString ThresholdArrayName("Float");
+const QString MaskArrayName("Mask");
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Stores the benchmark settings read from the command line
+ */
+struct BenchmarkSettings
+{
+  size_t m_MinImageDim = 64;
+  size_t m_MaxImageDim = 256;
+  size_t m_ElementCount = 2000000;
+  int m_Iterations = 3;
+};
+
+/**
+ * @brief Runs the function the given number of times and returns a JSON object
+ * with the minimum, mean, and maximum time in milliseconds.  The setup function
+ * is called before each iteration and is not timed.
+ */
+QJsonObject TimeOperation(int iterations, const std::function<void()>& setup, const std::function<void()>& operation)
+{
+  double minTime = std::numeric_limits<double>::max();
+  double maxTime = 0.0;
+  double totalTime = 0.0;
+  for(int i = 0; i < iterations; i++)
+  {
+    if(setup)
+    {
+      setup();
+    }
+
+    Clock::time_point start = Clock::now();
+    operation();
+    double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    minTime = std::min(minTime, elapsed);
+    maxTime = std::max(maxTime, elapsed);
+    totalTime += elapsed;
+  }
+
+  QJsonObject timing;
+  timing["iterations"] = iterations;
+  timing["min_ms"] = minTime;
+  timing["mean_ms"] = totalTime / std::max(iterations, 1);
+  timing["max_ms"] = maxTime;
+  return timing;
+}
+
+/**
+ * @brief Creates a single component array filled with a repeating ramp
+ */
+template <typename T> IDataArray::Pointer CreateRampArray(size_t numTuples, const QString& name)
+{
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, std::vector<size_t>(1, 1), name, true);
+  T* data = array->getPointer(0);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    data[i] = static_cast<T>(i % 100);
+  }
+  return array;
+}
+
+/**
+ * @brief Adds an attribute matrix containing one array of every primitive type
+ * along with the arrays used by the threshold and mask benchmarks
+ */
+void AddAttributeArrays(DataContainer::Pointer dc, size_t numTuples, AttributeMatrix::Type amType)
+{
+  AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), "AttributeMatrix", amType);
+
+  am->addOrReplaceAttributeArray(CreateRampArray<int8_t>(numTuples, "Int8"));
+  am->addOrReplaceAttributeArray(CreateRampArray<uint8_t>(numTuples, "UInt8"));
+  am->addOrReplaceAttributeArray(CreateRampArray<int16_t>(numTuples, "Int16"));
+  am->addOrReplaceAttributeArray(CreateRampArray<uint16_t>(numTuples, "UInt16"));
+  am->addOrReplaceAttributeArray(CreateRampArray<int32_t>(numTuples, "Int32"));
+  am->addOrReplaceAttributeArray(CreateRampArray<uint32_t>(numTuples, "UInt32"));
+  am->addOrReplaceAttributeArray(CreateRampArray<int64_t>(numTuples, "Int64"));
+  am->addOrReplaceAttributeArray(CreateRampArray<uint64_t>(numTuples, "UInt64"));
+  am->addOrReplaceAttributeArray(CreateRampArray<float>(numTuples, ThresholdArrayName));
+  am->addOrReplaceAttributeArray(CreateRampArray<double>(numTuples, "Double"));
+
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(numTuples, std::vector<size_t>(1, 1), "Bool", true);
+  UInt8ArrayType::Pointer maskArray = UInt8ArrayType::CreateArray(numTuples, std::vector<size_t>(1, 1), MaskArrayName, true);
+  FloatArrayType::Pointer vectorArray = FloatArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), "Vector", true);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    boolArray->setValue(i, (i % 2) == 0);
+    maskArray->setValue(i, (i % 3) == 0 ? 0 : 1);
+    for(size_t j = 0; j < 3; j++)
+    {
+      vectorArray->setComponent(i, j, static_cast<float>(i % (j + 7)));
+    }
+  }
+  am->addOrReplaceAttributeArray(boolArray);
+  am->addOrReplaceAttributeArray(maskArray);
+  am->addOrReplaceAttributeArray(vectorArray);
+
+  dc->addOrReplaceAttributeMatrix(am);
+}
+
+/**
+ * @brief Creates a shared vertex list for a regular grid of points
+ */
+SharedVertexList::Pointer CreateGridVertices(size_t xDim, size_t yDim, size_t zDim)
+{
+  SharedVertexList::Pointer vertices = IGeometry::CreateSharedVertexList(xDim * yDim * zDim);
+  float* coords = vertices->getPointer(0);
+  for(size_t z = 0; z < zDim; z++)
+  {
+    for(size_t y = 0; y < yDim; y++)
+    {
+      for(size_t x = 0; x < xDim; x++)
+      {
+        size_t index = (z * yDim + y) * xDim + x;
+        coords[3 * index] = static_cast<float>(x);
+        coords[3 * index + 1] = static_cast<float>(y);
+        coords[3 * index + 2] = static_cast<float>(z);
+      }
+    }
+  }
+  return vertices;
+}
+
+/**
+ * @brief Creates an ImageGeom DataContainer with dim^3 cells
+ */
+DataContainer::Pointer CreateImageDataContainer(size_t dim)
+{
+  DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+  ImageGeom::Pointer geom = ImageGeom::CreateGeometry("ImageGeom");
+  geom->setDimensions(SizeVec3Type(dim, dim, dim));
+  geom->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+  dc->setGeometry(geom);
+
+  AddAttributeArrays(dc, dim * dim * dim, AttributeMatrix::Type::Cell);
+  return dc;
+}
+
+/**
+ * @brief Creates a VertexGeom DataContainer with the given number of vertices
+ */
+DataContainer::Pointer CreateVertexDataContainer(size_t elementCount)
+{
+  size_t dim = static_cast<size_t>(std::cbrt(static_cast<double>(elementCount))) + 1;
+  SharedVertexList::Pointer vertices = CreateGridVertices(dim, dim, dim);
+
+  DataContainer::Pointer dc = DataContainer::New("VertexDataContainer");
+  VertexGeom::Pointer geom = VertexGeom::CreateGeometry(vertices, "VertexGeom");
+  dc->setGeometry(geom);
+
+  AddAttributeArrays(dc, geom->getNumberOfVertices(), AttributeMatrix::Type::Vertex);
+  return dc;
+}
+
+/**
+ * @brief Creates an EdgeGeom DataContainer of polylines along the x axis
+ */
+DataContainer::Pointer CreateEdgeDataContainer(size_t elementCount)
+{
+  size_t dim = static_cast<size_t>(std::sqrt(static_cast<double>(elementCount))) + 1;
+  SharedVertexList::Pointer vertices = CreateGridVertices(dim + 1, dim, 1);
+
+  size_t numEdges = dim * dim;
+  EdgeGeom::Pointer geom = EdgeGeom::CreateGeometry(numEdges, vertices, "EdgeGeom", true);
+  MeshIndexType* edges = geom->getEdges()->getPointer(0);
+  for(size_t y = 0; y < dim; y++)
+  {
+    for(size_t x = 0; x < dim; x++)
+    {
+      size_t edge = y * dim + x;
+      edges[2 * edge] = y * (dim + 1) + x;
+      edges[2 * edge + 1] = y * (dim + 1) + x + 1;
+    }
+  }
+
+  DataContainer::Pointer dc = DataContainer::New("EdgeDataContainer");
+  dc->setGeometry(geom);
+  AddAttributeArrays(dc, numEdges, AttributeMatrix::Type::Edge);
+  return dc;
+}
+
+/**
+ * @brief Creates a TriangleGeom DataContainer by splitting a grid of quads
+ */
+DataContainer::Pointer CreateTriangleDataContainer(size_t elementCount)
+{
+  size_t dim = static_cast<size_t>(std::sqrt(static_cast<double>(elementCount) / 2.0)) + 1;
+  SharedVertexList::Pointer vertices = CreateGridVertices(dim + 1, dim + 1, 1);
+
+  size_t numTris = 2 * dim * dim;
+  TriangleGeom::Pointer geom = TriangleGeom::CreateGeometry(numTris, vertices, "TriangleGeom", true);
+  MeshIndexType* tris = geom->getTriangles()->getPointer(0);
+  for(size_t y = 0; y < dim; y++)
+  {
+    for(size_t x = 0; x < dim; x++)
+    {
+      size_t v0 = y * (dim + 1) + x;
+      size_t v1 = v0 + 1;
+      size_t v2 = v0 + dim + 1;
+      size_t v3 = v2 + 1;
+      MeshIndexType* tri = tris + 6 * (y * dim + x);
+      tri[0] = v0;
+      tri[1] = v1;
+      tri[2] = v3;
+      tri[3] = v0;
+      tri[4] = v3;
+      tri[5] = v2;
+    }
+  }
+
+  DataContainer::Pointer dc = DataContainer::New("TriangleDataContainer");
+  dc->setGeometry(geom);
+  AddAttributeArrays(dc, numTris, AttributeMatrix::Type::Face);
+  return dc;
+}
+
+/**
+ * @brief Creates a QuadGeom DataContainer from a regular grid
+ */
+DataContainer::Pointer CreateQuadDataContainer(size_t elementCount)
+{
+  size_t dim = static_cast<size_t>(std::sqrt(static_cast<double>(elementCount))) + 1;
+  SharedVertexList::Pointer vertices = CreateGridVertices(dim + 1, dim + 1, 1);
+
+  size_t numQuads = dim * dim;
+  QuadGeom::Pointer geom = QuadGeom::CreateGeometry(numQuads, vertices, "QuadGeom", true);
+  MeshIndexType* quads = geom->getQuads()->getPointer(0);
+  for(size_t y = 0; y < dim; y++)
+  {
+    for(size_t x = 0; x < dim; x++)
+    {
+      size_t v0 = y * (dim + 1) + x;
+      MeshIndexType* quad = quads + 4 * (y * dim + x);
+      quad[0] = v0;
+      quad[1] = v0 + 1;
+      quad[2] = v0 + dim + 2;
+      quad[3] = v0 + dim + 1;
+    }
+  }
+
+  DataContainer::Pointer dc = DataContainer::New("QuadDataContainer");
+  dc->setGeometry(geom);
+  AddAttributeArrays(dc, numQuads, AttributeMatrix::Type::Face);
+  return dc;
+}
+
+/**
+ * @brief Creates a TetrahedralGeom DataContainer by splitting a grid of hexahedra
+ * into six tetrahedra each
+ */
+DataContainer::Pointer CreateTetDataContainer(size_t elementCount)
+{
+  // Corner offsets are stored as x | y << 1 | z << 2 within each hexahedron
+  const int tetCorners[6][4] = {{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7}, {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}};
+
+  size_t dim = static_cast<size_t>(std::cbrt(static_cast<double>(elementCount) / 6.0)) + 1;
+  size_t pointDim = dim + 1;
+  SharedVertexList::Pointer vertices = CreateGridVertices(pointDim, pointDim, pointDim);
+
+  size_t numTets = 6 * dim * dim * dim;
+  TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(numTets, vertices, "TetrahedralGeom", true);
+  MeshIndexType* tets = geom->getTetrahedra()->getPointer(0);
+  size_t tetIndex = 0;
+  for(size_t z = 0; z < dim; z++)
+  {
+    for(size_t y = 0; y < dim; y++)
+    {
+      for(size_t x = 0; x < dim; x++)
+      {
+        for(int t = 0; t < 6; t++)
+        {
+          for(int c = 0; c < 4; c++)
+          {
+            int corner = tetCorners[t][c];
+            size_t px = x + (corner & 1);
+            size_t py = y + ((corner >> 1) & 1);
+            size_t pz = z + ((corner >> 2) & 1);
+            tets[4 * tetIndex + c] = (pz * pointDim + py) * pointDim + px;
+          }
+          tetIndex++;
+        }
+      }
+    }
+  }
+
+  DataContainer::Pointer dc = DataContainer::New("TetrahedralDataContainer");
+  dc->setGeometry(geom);
+  AddAttributeArrays(dc, numTets, AttributeMatrix::Type::Cell);
+  return dc;
+}
+
+/**
+ * @brief Times a visual filter's apply() on a freshly created child of the parent
+ * filter.  A new filter is created for each iteration so that VTK cannot skip the
+ * update because nothing was modified.  apply() runs on a worker thread, so each
+ * iteration waits for the output to be swapped in before stopping the timer.
+ */
+template <typename FilterT>
+QJsonObject TimeFilterApply(VSAbstractFilter* parentFilter, int iterations, const std::function<void(FilterT*)>& apply)
+{
+  FilterT* filter = nullptr;
+  auto cleanup = [&filter] {
+    if(filter)
+    {
+      filter->deleteFilter();
+      delete filter;
+      filter = nullptr;
+    }
+  };
+
+  QJsonObject timing = TimeOperation(iterations,
+                                     [&] {
+                                       cleanup();
+                                       filter = new FilterT(parentFilter);
+                                     },
+                                     [&] {
+                                       apply(filter);
+                                       filter->waitForApply();
+                                     });
+  cleanup();
+  return timing;
+}
+
+/**
+ * @brief Runs every benchmark for the given DataContainer and appends the results
+ */
+void BenchmarkDataContainer(const QString& geometryName, const QString& sizeName, DataContainer::Pointer dc, const BenchmarkSettings& settings, QJsonArray& results)
+{
+  auto addResult = [&](const QString& operation, QJsonObject timing) {
+    timing["geometry"] = geometryName;
+    timing["size"] = sizeName;
+    timing["operation"] = operation;
+    results.append(timing);
+    std::cerr << qPrintable(geometryName) << " " << qPrintable(sizeName) << " " << qPrintable(operation) << ": " << timing["mean_ms"].toDouble() << " ms" << std::endl;
+  };
+
+  addResult("WrapDataContainerAsStruct", TimeOperation(settings.m_Iterations, nullptr, [&] { SIMPLVtkBridge::WrapDataContainerAsStruct(dc); }));
+
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc;
+  addResult("FinishWrappingDataContainerStruct",
+            TimeOperation(settings.m_Iterations, [&] { wrappedDc = SIMPLVtkBridge::WrapGeometryPtr(dc); }, [&] { SIMPLVtkBridge::FinishWrappingDataContainerStruct(wrappedDc); }));
+
+  // Filters are applied to the same output the import produces
+  wrappedDc = SIMPLVtkBridge::WrapGeometryPtr(dc);
+  VSSIMPLDataContainerFilter* dcFilter = new VSSIMPLDataContainerFilter(wrappedDc, nullptr);
+  dcFilter->finishWrapping();
+
+  double* bounds = dcFilter->getBounds();
+  double center[3] = {(bounds[0] + bounds[1]) / 2.0, (bounds[2] + bounds[3]) / 2.0, (bounds[4] + bounds[5]) / 2.0};
+  double normal[3] = {1.0, 1.0, 1.0};
+
+  int iterations = settings.m_Iterations;
+
+  // Threshold and mask filters only operate on cell arrays
+  if(dcFilter->getOutput()->GetCellData()->GetArray(qPrintable(ThresholdArrayName)))
+  {
+    addResult("VSThresholdFilter::apply", TimeFilterApply<VSThresholdFilter>(dcFilter, iterations, [](VSThresholdFilter* filter) { filter->apply(ThresholdArrayName, 25.0, 75.0); }));
+    addResult("VSMaskFilter::apply", TimeFilterApply<VSMaskFilter>(dcFilter, iterations, [](VSMaskFilter* filter) { filter->apply(MaskArrayName); }));
+  }
+  addResult("VSClipFilter::apply", TimeFilterApply<VSClipFilter>(dcFilter, iterations, [&](VSClipFilter* filter) { filter->apply(center, normal); }));
+  addResult("VSSliceFilter::apply", TimeFilterApply<VSSliceFilter>(dcFilter, iterations, [&](VSSliceFilter* filter) { filter->apply(center, normal); }));
+
+  ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+  if(imageGeom)
+  {
+    SizeVec3Type dims = imageGeom->getDimensions();
+    int voi[6] = {0, static_cast<int>(dims[0] / 2), 0, static_cast<int>(dims[1] / 2), 0, static_cast<int>(dims[2] / 2)};
+    int sampleRate[3] = {1, 1, 1};
+    addResult("VSCropFilter::apply", TimeFilterApply<VSCropFilter>(dcFilter, iterations, [&](VSCropFilter* filter) { filter->apply(voi, sampleRate); }));
+  }
+
+  dcFilter->deleteFilter();
+  delete dcFilter;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  // The filters create Qt objects but nothing is ever shown
+  if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+  {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  QApplication app(argc, argv);
+  QApplication::setApplicationName("SIMPLVtkLibBenchmarks");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Times SIMPLVtkBridge wrapping and visual filter application on synthetic data");
+  parser.addHelpOption();
+  QCommandLineOption outputOption("output", "Write the JSON results to <file> instead of stdout.", "file");
+  QCommandLineOption minImageOption("min-image-dim", "Smallest ImageGeom dimension. Defaults to 64.", "dim", "64");
+  QCommandLineOption maxImageOption("max-image-dim", "Largest ImageGeom dimension. Defaults to 256; 1024 requires tens of GB of memory.", "dim", "256");
+  QCommandLineOption elementOption("elements", "Approximate element count for unstructured geometries. Defaults to 2000000.", "count", "2000000");
+  QCommandLineOption iterationOption("iterations", "Number of timed iterations per operation. Defaults to 3.", "count", "3");
+  parser.addOption(outputOption);
+  parser.addOption(minImageOption);
+  parser.addOption(maxImageOption);
+  parser.addOption(elementOption);
+  parser.addOption(iterationOption);
+  parser.process(app);
+
+  BenchmarkSettings settings;
+  settings.m_MinImageDim = parser.value(minImageOption).toULongLong();
+  settings.m_MaxImageDim = parser.value(maxImageOption).toULongLong();
+  settings.m_ElementCount = parser.value(elementOption).toULongLong();
+  settings.m_Iterations = std::max(parser.value(iterationOption).toInt(), 1);
+
+  QJsonArray results;
+  for(size_t dim = std::max<size_t>(settings.m_MinImageDim, 1); dim <= settings.m_MaxImageDim; dim *= 2)
+  {
+    BenchmarkDataContainer("Image", QString("%1^3").arg(dim), CreateImageDataContainer(dim), settings, results);
+  }
+
+  QString elementName = QString::number(settings.m_ElementCount);
+  BenchmarkDataContainer("Vertex", elementName, CreateVertexDataContainer(settings.m_ElementCount), settings, results);
+  BenchmarkDataContainer("Edge", elementName, CreateEdgeDataContainer(settings.m_ElementCount), settings, results);
+  BenchmarkDataContainer("Triangle", elementName, CreateTriangleDataContainer(settings.m_ElementCount), settings, results);
+  BenchmarkDataContainer("Quad", elementName, CreateQuadDataContainer(settings.m_ElementCount), settings, results);
+  BenchmarkDataContainer("Tetrahedral", elementName, CreateTetDataContainer(settings.m_ElementCount), settings, results);
+
+  QJsonObject root;
+  root["vtkVersion"] = vtkVersion::GetVTKVersion();
+  root["threadCount"] = QThread::idealThreadCount();
+  root["elementCount"] = static_cast<double>(settings.m_ElementCount);
+  root["results"] = results;
+  QByteArray json = QJsonDocument(root).toJson(QJsonDocument::Indented);
+
+  if(parser.isSet(outputOption))
+  {
+    QFile outputFile(parser.value(outputOption));
+    if(false == outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      std::cerr << "Could not open " << qPrintable(outputFile.fileName()) << " for writing" << std::endl;
+      return 1;
+    }
+    outputFile.write(json);
+  }
+  else
+  {
+    std::cout << json.constData() << std::endl;
+  }
+
+  return 0;
+}
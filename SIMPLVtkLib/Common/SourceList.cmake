@@ -3,10 +3,12 @@ set(SUBDIR_NAME Common)
 set(${PROJECT_NAME}_${SUBDIR_NAME}_HDRS
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/${SUBDIR_NAME}/MontageUtilities.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/${SUBDIR_NAME}/SIMPLVtkLibConstants.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/${SUBDIR_NAME}/VSTraceRecorder.h
 )
 
 set(${PROJECT_NAME}_${SUBDIR_NAME}_SRCS
 ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/${SUBDIR_NAME}/MontageUtilities.cpp
+${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/${SUBDIR_NAME}/VSTraceRecorder.cpp
 )
 
 cmp_IDE_SOURCE_PROPERTIES( "${PROJECT_NAME}/${SUBDIR_NAME}" "${${PROJECT_NAME}_${SUBDIR_NAME}_HDRS}" "${${PROJECT_NAME}_${SUBDIR_NAME}_SRCS}" "0")
@@ -0,0 +1,312 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSTraceRecorder.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTraceRecorder::VSTraceRecorder()
+: m_StartTime(Clock::now())
+, m_Enabled(false)
+, m_NextThreadId(1)
+{
+  QString filePath = QString::fromLocal8Bit(qgetenv("SIMPLVtkLib_TRACE_FILE"));
+  if(false == filePath.isEmpty())
+  {
+    m_ExportFilePath = filePath;
+    m_Enabled = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTraceRecorder::~VSTraceRecorder()
+{
+  exportTrace();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTraceRecorder* VSTraceRecorder::Instance()
+{
+  static VSTraceRecorder recorder;
+  return &recorder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTraceRecorder::isEnabled() const
+{
+  return m_Enabled.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTraceRecorder::setEnabled(bool enabled)
+{
+  m_Enabled = enabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSTraceRecorder::getExportFilePath() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_ExportFilePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTraceRecorder::setExportFilePath(const QString& filePath)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_ExportFilePath = filePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 VSTraceRecorder::getTimestamp() const
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_StartTime).count();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSTraceRecorder::getThreadId()
+{
+  static thread_local int threadId = 0;
+  if(threadId == 0)
+  {
+    threadId = m_NextThreadId++;
+
+    QString threadName;
+    QThread* thread = QThread::currentThread();
+    if(QCoreApplication::instance() && QCoreApplication::instance()->thread() == thread)
+    {
+      threadName = "Main Thread";
+    }
+    else if(thread && false == thread->objectName().isEmpty())
+    {
+      threadName = thread->objectName();
+    }
+    else
+    {
+      threadName = QString("Worker Thread %1").arg(threadId);
+    }
+
+    QMutexLocker locker(&m_Mutex);
+    m_ThreadNames[threadId] = threadName;
+  }
+
+  return threadId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTraceRecorder::addEvent(const char* category, const char* name, const QString& detail, qint64 startTime, qint64 duration, qint64 bytes)
+{
+  int threadId = getThreadId();
+
+  QMutexLocker locker(&m_Mutex);
+  if(m_Events.size() >= MaxEventCount)
+  {
+    return;
+  }
+
+  m_Events.push_back({category, name, detail, startTime, duration, bytes, threadId});
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTraceRecorder::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Events.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSTraceRecorder::getEventCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Events.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTraceRecorder::writeChromeTrace(const QString& filePath) const
+{
+  QJsonArray traceEvents;
+  {
+    QMutexLocker locker(&m_Mutex);
+
+    // Metadata events name each thread's row in the trace viewer
+    for(auto iter = m_ThreadNames.begin(); iter != m_ThreadNames.end(); iter++)
+    {
+      QJsonObject args;
+      args["name"] = iter.value();
+
+      QJsonObject metadata;
+      metadata["name"] = "thread_name";
+      metadata["ph"] = "M";
+      metadata["pid"] = 1;
+      metadata["tid"] = iter.key();
+      metadata["args"] = args;
+      traceEvents.append(metadata);
+    }
+
+    for(const TraceEvent& event : m_Events)
+    {
+      QJsonObject args;
+      if(event.m_Bytes > 0)
+      {
+        args["bytes"] = static_cast<double>(event.m_Bytes);
+      }
+      if(false == event.m_Detail.isEmpty())
+      {
+        args["detail"] = event.m_Detail;
+      }
+
+      QJsonObject traceEvent;
+      traceEvent["cat"] = event.m_Category;
+      traceEvent["name"] = event.m_Name;
+      traceEvent["ph"] = "X";
+      traceEvent["ts"] = static_cast<double>(event.m_StartTime);
+      traceEvent["dur"] = static_cast<double>(event.m_Duration);
+      traceEvent["pid"] = 1;
+      traceEvent["tid"] = event.m_ThreadId;
+      if(false == args.isEmpty())
+      {
+        traceEvent["args"] = args;
+      }
+      traceEvents.append(traceEvent);
+    }
+  }
+
+  QJsonObject root;
+  root["traceEvents"] = traceEvents;
+  root["displayTimeUnit"] = "ms";
+
+  QFile outputFile(filePath);
+  if(false == outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+
+  QJsonDocument document(root);
+  return outputFile.write(document.toJson(QJsonDocument::Compact)) >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTraceRecorder::exportTrace() const
+{
+  QString filePath = getExportFilePath();
+  if(filePath.isEmpty())
+  {
+    return false;
+  }
+
+  return writeChromeTrace(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTraceScope::VSTraceScope(const char* category, const char* name)
+: m_Category(category)
+, m_Name(name)
+{
+  VSTraceRecorder* recorder = VSTraceRecorder::Instance();
+  if(recorder->isEnabled())
+  {
+    m_StartTime = recorder->getTimestamp();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTraceScope::~VSTraceScope()
+{
+  if(m_StartTime < 0)
+  {
+    return;
+  }
+
+  VSTraceRecorder* recorder = VSTraceRecorder::Instance();
+  recorder->addEvent(m_Category, m_Name, m_Detail, m_StartTime, recorder->getTimestamp() - m_StartTime, m_Bytes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTraceScope::addBytes(qint64 bytes)
+{
+  m_Bytes += bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTraceScope::setDetail(const QString& detail)
+{
+  if(m_StartTime >= 0)
+  {
+    m_Detail = detail;
+  }
+}
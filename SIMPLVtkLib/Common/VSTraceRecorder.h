@@ -0,0 +1,233 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @brief The VS_TRACE macros record scoped timings when SIMPLVtkLib_ENABLE_TRACING
+ * is defined and compile to nothing otherwise.  Categories and names must be string
+ * literals.  Use VS_TRACE_NAMED_SCOPE when a byte count or detail string should be
+ * attached to the recorded event.
+ */
+#ifdef SIMPLVtkLib_ENABLE_TRACING
+#define VS_TRACE_CONCAT_IMPL(a, b) a##b
+#define VS_TRACE_CONCAT(a, b) VS_TRACE_CONCAT_IMPL(a, b)
+#define VS_TRACE_SCOPE(category, name) VSTraceScope VS_TRACE_CONCAT(vsTraceScope, __LINE__)(category, name)
+#define VS_TRACE_NAMED_SCOPE(scope, category, name) VSTraceScope scope(category, name)
+#define VS_TRACE_BYTES(scope, bytes) scope.addBytes(bytes)
+#define VS_TRACE_DETAIL(scope, detail) scope.setDetail(detail)
+#define VS_TRACE_EXPORT() VSTraceRecorder::Instance()->exportTrace()
+#else
+#define VS_TRACE_SCOPE(category, name)
+#define VS_TRACE_NAMED_SCOPE(scope, category, name)
+#define VS_TRACE_BYTES(scope, bytes)
+#define VS_TRACE_DETAIL(scope, detail)
+#define VS_TRACE_EXPORT()
+#endif
+
+/**
+ * @class VSTraceRecorder VSTraceRecorder.h SIMPLVtkLib/Common/VSTraceRecorder.h
+ * @brief This class collects completed trace events from any thread and writes
+ * them in the Chrome trace-event JSON format that can be opened in chrome://tracing
+ * or Perfetto.  Recording is disabled until setEnabled(true) is called or the
+ * SIMPLVtkLib_TRACE_FILE environment variable names a file to export to.
+ */
+class SIMPLVtkLib_EXPORT VSTraceRecorder
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct TraceEvent
+  {
+    const char* m_Category;
+    const char* m_Name;
+    QString m_Detail;
+    qint64 m_StartTime;
+    qint64 m_Duration;
+    qint64 m_Bytes;
+    int m_ThreadId;
+  };
+
+  /**
+   * @brief Returns the application-wide trace recorder
+   * @return
+   */
+  static VSTraceRecorder* Instance();
+
+  /**
+   * @brief Destructor.  Exports the recorded events if an export file was set.
+   */
+  virtual ~VSTraceRecorder();
+
+  /**
+   * @brief Returns true if events are currently being recorded
+   * @return
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Enables or disables recording new events
+   * @param enabled
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * @brief Returns the file path used by exportTrace()
+   * @return
+   */
+  QString getExportFilePath() const;
+
+  /**
+   * @brief Sets the file path used by exportTrace()
+   * @param filePath
+   */
+  void setExportFilePath(const QString& filePath);
+
+  /**
+   * @brief Returns the number of microseconds since the recorder was created
+   * @return
+   */
+  qint64 getTimestamp() const;
+
+  /**
+   * @brief Adds a completed event for the calling thread
+   * @param category
+   * @param name
+   * @param detail
+   * @param startTime
+   * @param duration
+   * @param bytes
+   */
+  void addEvent(const char* category, const char* name, const QString& detail, qint64 startTime, qint64 duration, qint64 bytes);
+
+  /**
+   * @brief Removes all recorded events
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of recorded events
+   * @return
+   */
+  size_t getEventCount() const;
+
+  /**
+   * @brief Writes the recorded events to the given file as Chrome trace-event JSON.
+   * Returns false if the file could not be written.
+   * @param filePath
+   * @return
+   */
+  bool writeChromeTrace(const QString& filePath) const;
+
+  /**
+   * @brief Writes the recorded events to the export file path if one is set
+   * @return
+   */
+  bool exportTrace() const;
+
+protected:
+  VSTraceRecorder();
+
+  /**
+   * @brief Returns the trace ID for the calling thread, assigning one if required
+   * @return
+   */
+  int getThreadId();
+
+private:
+  static const size_t MaxEventCount = 1000000;
+
+  Clock::time_point m_StartTime;
+  std::atomic<bool> m_Enabled;
+  std::atomic<int> m_NextThreadId;
+  QString m_ExportFilePath;
+  std::vector<TraceEvent> m_Events;
+  QMap<int, QString> m_ThreadNames;
+  mutable QMutex m_Mutex;
+};
+
+/**
+ * @class VSTraceScope VSTraceRecorder.h SIMPLVtkLib/Common/VSTraceRecorder.h
+ * @brief This class records the time between its construction and destruction as a
+ * single trace event.  Nothing is recorded if the recorder is disabled when the
+ * scope is created.
+ */
+class SIMPLVtkLib_EXPORT VSTraceScope
+{
+public:
+  /**
+   * @brief Constructor
+   * @param category
+   * @param name
+   */
+  VSTraceScope(const char* category, const char* name);
+
+  /**
+   * @brief Destructor.  Records the event.
+   */
+  ~VSTraceScope();
+
+  VSTraceScope(const VSTraceScope&) = delete;
+  VSTraceScope& operator=(const VSTraceScope&) = delete;
+
+  /**
+   * @brief Adds to the number of bytes processed within the scope
+   * @param bytes
+   */
+  void addBytes(qint64 bytes);
+
+  /**
+   * @brief Sets a detail string such as a DataContainer name for the event
+   * @param detail
+   */
+  void setDetail(const QString& detail);
+
+private:
+  const char* m_Category;
+  const char* m_Name;
+  QString m_Detail;
+  qint64 m_StartTime = -1;
+  qint64 m_Bytes = 0;
+};
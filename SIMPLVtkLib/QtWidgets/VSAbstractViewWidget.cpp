@@ -35,10 +35,15 @@
 
 #include "VSViewWidget.h"
 
+#include <QtCore/QPointer>
+#include <QtCore/QTimer>
 #include <QtGui/QKeyEvent>
+#include <QtGui/QShowEvent>
 #include <QtWidgets/QLayout>
 #include <QtWidgets/QStyle>
 
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
+#include "SIMPLVtkLib/QtWidgets/VSRenderScheduler.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSRootFilter.h"
 
@@ -67,6 +72,14 @@ VSAbstractViewWidget::VSAbstractViewWidget(const VSAbstractViewWidget& other)
   setupModel();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractViewWidget::~VSAbstractViewWidget()
+{
+  VSRenderScheduler::Instance()->cancelRender(this);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -110,6 +123,8 @@ void VSAbstractViewWidget::addViewSettings(VSFilterViewSettings* viewSettings)
   connect(viewSettings, &VSFilterViewSettings::showScalarBarChanged, this, &VSAbstractViewWidget::setFilterShowScalarBar);
   connect(viewSettings, &VSFilterViewSettings::requiresRender, this, &VSAbstractViewWidget::renderView);
   connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, &VSAbstractViewWidget::updateScene);
+  connect(viewSettings, &VSFilterViewSettings::swappingActors, this, &VSAbstractViewWidget::swapActors);
+  connect(viewSettings, &VSFilterViewSettings::planeActorsChanged, this, &VSAbstractViewWidget::addPlaneActors);
 
   checkFilterViewSetting(viewSettings);
 
@@ -279,9 +294,41 @@ void VSAbstractViewWidget::changeFilterVisibility(VSFilterViewSettings* viewSett
     return;
   }
 
-  if(filterVisible)
+  // Montage tiles are drawn by the montage actor instead of their own actors unless the
+  // montage atlas cannot hold the resolution required by the camera
+  VSMontageActor* montageActor = getMontageActor(viewSettings);
+  if(montageActor)
+  {
+    if(filterVisible)
+    {
+      montageActor->addTile(viewSettings);
+    }
+    else
+    {
+      montageActor->removeTile(viewSettings);
+    }
+    updateMontageActor(montageActor);
+  }
+
+  // Tiles only create their own actors when the montage cannot draw them
+  viewSettings->setRenderedByMontage(montageActor && false == montageActor->usesTileActors());
+
+  if(montageActor && false == montageActor->usesTileActors())
+  {
+    getVisualizationWidget()->getRenderer()->RemoveViewProp(viewSettings->getActor());
+    getVisualizationWidget()->getRenderer()->RemoveViewProp(viewSettings->getCubeAxesActor());
+    if(viewSettings->getScalarBarWidget())
+    {
+      viewSettings->getScalarBarWidget()->SetEnabled(0);
+    }
+  }
+  else if(filterVisible)
   {
     getVisualizationWidget()->getRenderer()->AddViewProp(viewSettings->getActor());
+    for(const VTK_PTR(vtkActor)& planeActor : viewSettings->getPlaneActors())
+    {
+      getVisualizationWidget()->getRenderer()->AddViewProp(planeActor);
+    }
 
     if(viewSettings->isScalarBarVisible())
     {
@@ -299,6 +346,10 @@ void VSAbstractViewWidget::changeFilterVisibility(VSFilterViewSettings* viewSett
   {
     getVisualizationWidget()->getRenderer()->RemoveViewProp(viewSettings->getActor());
     getVisualizationWidget()->getRenderer()->RemoveViewProp(viewSettings->getCubeAxesActor());
+    for(const VTK_PTR(vtkActor)& planeActor : viewSettings->getPlaneActors())
+    {
+      getVisualizationWidget()->getRenderer()->RemoveViewProp(planeActor);
+    }
 
     if(viewSettings->isScalarBarVisible())
     {
@@ -320,12 +371,26 @@ void VSAbstractViewWidget::changeScalarBarVisibility(VSFilterViewSettings* viewS
     return;
   }
 
-  if(nullptr == viewSettings->getScalarBarWidget() || nullptr == getVisualizationWidget())
+  if(nullptr == getVisualizationWidget())
   {
     return;
   }
 
-  if(viewSettings->getScalarBarWidget())
+  // Montage tiles have no scalar bar of their own while the montage draws them
+  VSMontageActor* montageActor = getMontageActor(viewSettings);
+  if(montageActor)
+  {
+    updateMontageActor(montageActor);
+  }
+
+  if(montageActor && false == montageActor->usesTileActors())
+  {
+    if(viewSettings->getScalarBarWidget())
+    {
+      viewSettings->getScalarBarWidget()->SetEnabled(0);
+    }
+  }
+  else if(viewSettings->getScalarBarWidget())
   {
     if(viewSettings->isVisible())
     {
@@ -348,6 +413,81 @@ void VSAbstractViewWidget::changeScalarBarVisibility(VSFilterViewSettings* viewS
   renderView();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSMontageActor* VSAbstractViewWidget::getMontageActor(VSFilterViewSettings* settings)
+{
+  if(nullptr == settings || AbstractImportMontageDialog::DisplayType::Montage != settings->getDisplayType())
+  {
+    return nullptr;
+  }
+  if(VSFilterViewSettings::ActorType::Image2D != settings->getActorType() || nullptr == settings->getFilter())
+  {
+    return nullptr;
+  }
+
+  VSAbstractFilter* montageFilter = settings->getFilter()->getParentFilter();
+  if(nullptr == montageFilter)
+  {
+    return nullptr;
+  }
+
+  auto iter = m_MontageActors.find(montageFilter);
+  if(iter != m_MontageActors.end())
+  {
+    return iter->second;
+  }
+
+  VSMontageActor* montageActor = new VSMontageActor(montageFilter, this);
+  connect(montageActor, &VSMontageActor::requiresRender, this, &VSAbstractViewWidget::renderView);
+  connect(montageActor, &VSMontageActor::usesTileActorsChanged, this, [=] {
+    for(const auto& settingsPair : getAllFilterViewSettings())
+    {
+      if(settingsPair.first->getParentFilter() == montageFilter && montageActor->hasTile(settingsPair.second))
+      {
+        checkFilterViewSetting(settingsPair.second);
+      }
+    }
+  });
+  connect(montageFilter, &QObject::destroyed, this, [=] {
+    if(getVisualizationWidget() && getVisualizationWidget()->getRenderer())
+    {
+      getVisualizationWidget()->getRenderer()->RemoveViewProp(montageActor->getActor());
+    }
+    montageActor->getScalarBarWidget()->SetEnabled(0);
+    m_MontageActors.erase(montageFilter);
+    montageActor->deleteLater();
+  });
+
+  m_MontageActors[montageFilter] = montageActor;
+  return montageActor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::updateMontageActor(VSMontageActor* montageActor)
+{
+  if(nullptr == montageActor || nullptr == getVisualizationWidget() || nullptr == getVisualizationWidget()->getRenderer())
+  {
+    return;
+  }
+
+  bool hasTiles = montageActor->getNumberOfTiles() > 0 && false == montageActor->usesTileActors();
+  if(hasTiles)
+  {
+    getVisualizationWidget()->getRenderer()->AddViewProp(montageActor->getActor());
+  }
+  else
+  {
+    getVisualizationWidget()->getRenderer()->RemoveViewProp(montageActor->getActor());
+  }
+
+  montageActor->getScalarBarWidget()->SetInteractor(getVisualizationWidget()->GetInteractor());
+  montageActor->getScalarBarWidget()->SetEnabled(hasTiles && montageActor->isScalarBarVisible());
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -401,13 +541,53 @@ void VSAbstractViewWidget::setGridVisibility(const bool& gridVisible)
   renderView();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::addPlaneActors()
+{
+  VSFilterViewSettings* viewSettings = dynamic_cast<VSFilterViewSettings*>(sender());
+  if(nullptr == viewSettings || false == viewSettings->isVisible() || nullptr == getVisualizationWidget() || nullptr == getVisualizationWidget()->getRenderer())
+  {
+    return;
+  }
+
+  for(const VTK_PTR(vtkActor)& planeActor : viewSettings->getPlaneActors())
+  {
+    getVisualizationWidget()->getRenderer()->AddViewProp(planeActor);
+  }
+  renderView();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::swapActors(vtkProp3D* oldProp, vtkProp3D* newProp)
 {
+  if(nullptr == getVisualizationWidget() || nullptr == getVisualizationWidget()->getRenderer())
+  {
+    return;
+  }
+
   getVisualizationWidget()->getRenderer()->RemoveViewProp(oldProp);
-  getVisualizationWidget()->getRenderer()->AddViewProp(newProp);
+
+  VSFilterViewSettings* viewSettings = dynamic_cast<VSFilterViewSettings*>(sender());
+  if(nullptr == viewSettings)
+  {
+    getVisualizationWidget()->getRenderer()->AddViewProp(newProp);
+    renderView();
+    return;
+  }
+
+  // The settings finish switching actors after emitting the signal, so the new actor is
+  // added afterwards.  This also routes montage tiles to their montage actor.
+  QPointer<VSFilterViewSettings> settings(viewSettings);
+  QTimer::singleShot(0, this, [this, settings] {
+    if(settings)
+    {
+      checkFilterViewSetting(settings);
+    }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -459,6 +639,20 @@ void VSAbstractViewWidget::mousePressEvent(QMouseEvent* event)
   mousePressed();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::showEvent(QShowEvent* event)
+{
+  QFrame::showEvent(event);
+
+  VSRenderScheduler* scheduler = VSRenderScheduler::Instance();
+  if(scheduler->isRenderPending(this))
+  {
+    scheduler->requestRender(this);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -671,6 +865,20 @@ void VSAbstractViewWidget::renderView()
     return;
   }
 
+  VSRenderScheduler::Instance()->requestRender(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::renderImmediately()
+{
+  if(m_BlockRender)
+  {
+    return;
+  }
+
+  VS_TRACE_SCOPE("Render", "Render View");
   VSVisualizationWidget* visualizationWidget = getVisualizationWidget();
   if(visualizationWidget)
   {
@@ -692,7 +900,7 @@ void VSAbstractViewWidget::resetCamera()
   if(visualizationWidget && visualizationWidget->getRenderer())
   {
     visualizationWidget->getRenderer()->ResetCamera();
-    visualizationWidget->render();
+    renderView();
   }
 }
 
@@ -769,6 +977,8 @@ void VSAbstractViewWidget::setController(VSController* controller)
     connect(viewSettings, &VSFilterViewSettings::showScalarBarChanged, this, &VSAbstractViewWidget::setFilterShowScalarBar);
     connect(viewSettings, &VSFilterViewSettings::requiresRender, this, &VSAbstractViewWidget::renderView);
     connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, &VSAbstractViewWidget::updateScene);
+    connect(viewSettings, &VSFilterViewSettings::swappingActors, this, &VSAbstractViewWidget::swapActors);
+    connect(viewSettings, &VSFilterViewSettings::planeActorsChanged, this, &VSAbstractViewWidget::addPlaneActors);
 
     // Check filter and scalar bar visibility
     checkFilterViewSetting(viewSettings);
@@ -795,6 +1005,13 @@ VSAbstractFilter* VSAbstractViewWidget::getFilterFromProp(vtkProp3D* prop)
     return nullptr;
   }
 
+  // Montage actors are picked as their montage filter
+  VSMontageActor* montageActor = getMontageActorFromProp(prop);
+  if(montageActor)
+  {
+    return montageActor->getMontageFilter();
+  }
+
   // Compare prop with all VSFilterViewSettings to find a match
   for(std::pair<VSAbstractFilter*, VSFilterViewSettings*> settingPair : getAllFilterViewSettings())
   {
@@ -802,11 +1019,82 @@ VSAbstractFilter* VSAbstractViewWidget::getFilterFromProp(vtkProp3D* prop)
     {
       return settingPair.first;
     }
+    for(const VTK_PTR(vtkActor)& planeActor : settingPair.second->getPlaneActors())
+    {
+      if(planeActor.GetPointer() == prop)
+      {
+        return settingPair.first;
+      }
+    }
   }
 
   return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkProp3D* VSAbstractViewWidget::getFilterProp(VSFilterViewSettings* settings) const
+{
+  if(nullptr == settings)
+  {
+    return nullptr;
+  }
+
+  if(settings->getActor())
+  {
+    return settings->getActor();
+  }
+
+  // Tiles without actors of their own are drawn by their montage actor
+  if(settings->getFilter())
+  {
+    auto iter = m_MontageActors.find(settings->getFilter()->getParentFilter());
+    if(iter != m_MontageActors.end() && iter->second->hasTile(settings))
+    {
+      return iter->second->getActor();
+    }
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSMontageActor* VSAbstractViewWidget::getMontageActorFromProp(vtkProp3D* prop) const
+{
+  if(nullptr == prop)
+  {
+    return nullptr;
+  }
+
+  for(const auto& montagePair : m_MontageActors)
+  {
+    if(montagePair.second->getActor().GetPointer() == prop)
+    {
+      return montagePair.second;
+    }
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VSMontageActor*> VSAbstractViewWidget::getMontageActors() const
+{
+  std::vector<VSMontageActor*> montageActors;
+  montageActors.reserve(m_MontageActors.size());
+  for(const auto& montagePair : m_MontageActors)
+  {
+    montageActors.push_back(montagePair.second);
+  }
+
+  return montageActors;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
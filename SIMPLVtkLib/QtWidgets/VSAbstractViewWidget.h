@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <map>
 #include <vector>
 
 #include <QtCore/QItemSelectionModel>
@@ -44,6 +45,7 @@
 #include "SIMPLVtkLib/QtWidgets/VSVisualizationWidget.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSMontageActor.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
@@ -76,7 +78,7 @@ public:
   /**
    * @brief Deconstructor
    */
-  virtual ~VSAbstractViewWidget() = default;
+  virtual ~VSAbstractViewWidget();
 
   /**
    * @brief Returns the VSFilterViewSettings for the given filter.
@@ -151,6 +153,27 @@ public:
    */
   virtual VSAbstractFilter* getFilterFromProp(vtkProp3D* prop);
 
+  /**
+   * @brief Returns the prop drawing the given settings.  Montage tiles without actors of
+   * their own return the actor of the montage drawing them.
+   * @param settings
+   * @return
+   */
+  vtkProp3D* getFilterProp(VSFilterViewSettings* settings) const;
+
+  /**
+   * @brief Returns the VSMontageActor using the given prop or nullptr if the prop does not draw a montage
+   * @param prop
+   * @return
+   */
+  VSMontageActor* getMontageActorFromProp(vtkProp3D* prop) const;
+
+  /**
+   * @brief Returns every VSMontageActor in the view
+   * @return
+   */
+  std::vector<VSMontageActor*> getMontageActors() const;
+
   /**
    * @brief Returns the visualization filter based on the given mouse coordinates.
    * @param pos
@@ -219,10 +242,16 @@ public slots:
   void closeView();
 
   /**
-   * @brief Renders the visualization widget
+   * @brief Requests a render of the visualization widget.  Requests are coalesced by
+   * VSRenderScheduler into at most one render per frame.
    */
   void renderView();
 
+  /**
+   * @brief Renders the visualization widget without waiting for the next frame
+   */
+  void renderImmediately();
+
   /**
    * @brief Resets the visualization widget's camera
    */
@@ -278,6 +307,12 @@ protected slots:
    */
   void swapActors(vtkProp3D* oldProp, vtkProp3D* newProp);
 
+  /**
+   * @brief Adds the plane actors of the sending VSFilterViewSettings to the renderer
+   * if its filter is visible
+   */
+  void addPlaneActors();
+
   /**
    * @brief Active array changed for filter
    * @param index
@@ -358,6 +393,20 @@ protected:
    */
   void changeScalarBarVisibility(VSFilterViewSettings* settings, const bool& visibility);
 
+  /**
+   * @brief Returns the VSMontageActor rendering the given settings, creating it if required.
+   * Returns nullptr if the settings are not a flat image tile of a montage.
+   * @param settings
+   * @return
+   */
+  VSMontageActor* getMontageActor(VSFilterViewSettings* settings);
+
+  /**
+   * @brief Adds or removes the montage actor and its scalar bar based on the montage's tiles
+   * @param montageActor
+   */
+  void updateMontageActor(VSMontageActor* montageActor);
+
   /**
    * @brief Copies the VSFilterViewModel
    * @param filterViewModel
@@ -407,6 +456,12 @@ protected:
    */
   virtual void mousePressEvent(QMouseEvent* event) override;
 
+  /**
+   * @brief Renders the view if a render was requested while it was hidden
+   * @param event
+   */
+  virtual void showEvent(QShowEvent* event) override;
+
   /**
    * @brief emits the currentFilterChanged signal when the current index changes
    * @param current
@@ -453,6 +508,7 @@ private:
   VSFilterViewModel* m_FilterViewModel = nullptr;
   QItemSelectionModel* m_SelectionModel = nullptr;
   VSController* m_Controller = nullptr;
+  std::map<VSAbstractFilter*, VSMontageActor*> m_MontageActors;
   bool m_BlockRender = false;
   bool m_Active = false;
 };
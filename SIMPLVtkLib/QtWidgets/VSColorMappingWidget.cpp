@@ -68,6 +68,7 @@ void VSColorMappingWidget::setupGui()
   });
   connect(m_Ui->selectPresetColorsBtn, &QPushButton::clicked, this, &VSColorMappingWidget::selectPresetColors);
   connect(m_presetsDialog, &ColorPresetsDialog::applyPreset, this, &VSColorMappingWidget::loadPresetColors);
+  connect(m_Ui->histogramWidget, &VSHistogramWidget::rangeSelected, this, &VSColorMappingWidget::setColorRange);
 }
 
 // -----------------------------------------------------------------------------
@@ -122,6 +123,7 @@ void VSColorMappingWidget::updateViewSettingInfo()
   }
 
   m_Ui->alphaSlider->setValue(alpha * 100);
+  updateHistogram();
 
   // Unblock Signals
   m_Ui->showScalarBarComboBox->blockSignals(false);
@@ -202,6 +204,8 @@ void VSColorMappingWidget::connectFilterViewSettings(VSFilterViewSettings::Colle
     disconnect(settings, &VSFilterViewSettings::mapColorsChanged, this, &VSColorMappingWidget::listenMapColors);
     disconnect(settings, &VSFilterViewSettings::alphaChanged, this, &VSColorMappingWidget::listenAlpha);
     disconnect(settings, &VSFilterViewSettings::scalarBarSettingChanged, this, &VSColorMappingWidget::listenScalarBar);
+    disconnect(settings, &VSFilterViewSettings::activeArrayNameChanged, this, &VSColorMappingWidget::updateHistogram);
+    disconnect(settings, &VSFilterViewSettings::activeComponentIndexChanged, this, &VSColorMappingWidget::updateHistogram);
   }
 
   m_ViewSettings = filterSettings;
@@ -211,9 +215,41 @@ void VSColorMappingWidget::connectFilterViewSettings(VSFilterViewSettings::Colle
     connect(settings, &VSFilterViewSettings::mapColorsChanged, this, &VSColorMappingWidget::listenMapColors);
     connect(settings, &VSFilterViewSettings::alphaChanged, this, &VSColorMappingWidget::listenAlpha);
     connect(settings, &VSFilterViewSettings::scalarBarSettingChanged, this, &VSColorMappingWidget::listenScalarBar);
+    connect(settings, &VSFilterViewSettings::activeArrayNameChanged, this, &VSColorMappingWidget::updateHistogram);
+    connect(settings, &VSFilterViewSettings::activeComponentIndexChanged, this, &VSColorMappingWidget::updateHistogram);
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSColorMappingWidget::setColorRange(double min, double max)
+{
+  for(VSFilterViewSettings* settings : m_ViewSettings)
+  {
+    settings->setColorRange(min, max);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSColorMappingWidget::updateHistogram()
+{
+  // Distributions of different arrays cannot be shown together
+  if(m_ViewSettings.size() != 1)
+  {
+    m_Ui->histogramWidget->setHistogram(VSHistogram());
+    return;
+  }
+
+  VSFilterViewSettings* settings = m_ViewSettings.front();
+  double range[2];
+  settings->getColorRange(range);
+  m_Ui->histogramWidget->setHistogram(settings->getActiveArrayHistogram());
+  m_Ui->histogramWidget->setSelectedRange(range[0], range[1]);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -333,6 +369,7 @@ void VSColorMappingWidget::listenAlpha(double alpha)
 {
   m_Ui->alphaSlider->blockSignals(true);
   m_Ui->alphaSlider->setValue(alpha * 100);
+  updateHistogram();
   m_Ui->alphaSlider->blockSignals(false);
 }
 
@@ -40,6 +40,7 @@
 #include "SVWidgetsLib/Dialogs/ColorPresetsDialog.h"
 
 #include "SIMPLVtkLib/QtWidgets/VSAbstractViewWidget.h"
+#include "SIMPLVtkLib/QtWidgets/VSHistogramWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -127,6 +128,18 @@ protected slots:
    */
   void listenScalarBar(const VSFilterViewSettings::ScalarBarSetting& scalarBar);
 
+  /**
+   * @brief Slot for handling a range selected in the histogramWidget
+   * @param min
+   * @param max
+   */
+  void setColorRange(double min, double max);
+
+  /**
+   * @brief Updates the histogramWidget for the active array of the current VSFilterViewSettings
+   */
+  void updateHistogram();
+
 protected:
   /**
    * @brief Performs initial setup for the GUI
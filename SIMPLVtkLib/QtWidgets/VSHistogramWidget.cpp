@@ -0,0 +1,280 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSHistogramWidget.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtGui/QContextMenuEvent>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPainter>
+#include <QtWidgets/QMenu>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogramWidget::VSHistogramWidget(QWidget* parent)
+: QWidget(parent)
+{
+  setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+  setToolTip("Drag to select a range.  Right-click for percentile ranges.");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const VSHistogram& VSHistogramWidget::getHistogram() const
+{
+  return m_Histogram;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSHistogramWidget::isLogScale() const
+{
+  return m_LogScale;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QSize VSHistogramWidget::sizeHint() const
+{
+  return QSize(200, 80);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QSize VSHistogramWidget::minimumSizeHint() const
+{
+  return QSize(50, 40);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::setHistogram(const VSHistogram& histogram)
+{
+  m_Histogram = histogram;
+  update();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::setSelectedRange(double min, double max)
+{
+  m_SelectedRange[0] = std::min(min, max);
+  m_SelectedRange[1] = std::max(min, max);
+  update();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::setLogScale(bool logScale)
+{
+  m_LogScale = logScale;
+  update();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::selectPercentileRange(double lowerPercent, double upperPercent)
+{
+  if(!m_Histogram.isValid())
+  {
+    return;
+  }
+
+  double min = m_Histogram.getPercentileValue(lowerPercent);
+  double max = m_Histogram.getPercentileValue(upperPercent);
+  setSelectedRange(min, max);
+  emit rangeSelected(m_SelectedRange[0], m_SelectedRange[1]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSHistogramWidget::xToValue(int x) const
+{
+  double fraction = std::min(std::max(static_cast<double>(x) / std::max(width() - 1, 1), 0.0), 1.0);
+  return m_Histogram.getMinValue() + fraction * (m_Histogram.getMaxValue() - m_Histogram.getMinValue());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSHistogramWidget::valueToX(double value) const
+{
+  double range = m_Histogram.getMaxValue() - m_Histogram.getMinValue();
+  if(range <= 0.0)
+  {
+    return 0.0;
+  }
+
+  return (value - m_Histogram.getMinValue()) / range * (width() - 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::paintEvent(QPaintEvent* event)
+{
+  QPainter painter(this);
+  painter.fillRect(rect(), palette().base());
+
+  if(!m_Histogram.isValid())
+  {
+    painter.setPen(palette().color(QPalette::Disabled, QPalette::Text));
+    painter.drawText(rect(), Qt::AlignCenter, "No Data");
+    return;
+  }
+
+  // Adaptive bins have different widths, so their heights show density rather than count
+  const std::vector<double>& edges = m_Histogram.getBinEdges();
+  const std::vector<vtkIdType>& counts = m_Histogram.getCounts();
+  bool useDensity = (VSHistogram::BinningMode::Adaptive == m_Histogram.getBinningMode());
+  std::vector<double> heights(counts.size(), 0.0);
+  for(size_t i = 0; i < counts.size(); i++)
+  {
+    double binWidth = edges[i + 1] - edges[i];
+    heights[i] = (useDensity && binWidth > 0.0) ? counts[i] / binWidth : counts[i];
+    if(m_LogScale)
+    {
+      heights[i] = std::log10(1.0 + heights[i]);
+    }
+  }
+
+  double maxHeight = *std::max_element(heights.begin(), heights.end());
+  if(maxHeight <= 0.0)
+  {
+    return;
+  }
+
+  QColor barColor = palette().color(QPalette::Mid);
+  QColor selectedColor = palette().color(QPalette::Highlight);
+  int widgetHeight = height();
+  for(size_t i = 0; i < counts.size(); i++)
+  {
+    double left = valueToX(edges[i]);
+    double right = std::max(valueToX(edges[i + 1]), left + 1.0);
+    double barHeight = heights[i] / maxHeight * widgetHeight;
+    double center = 0.5 * (edges[i] + edges[i + 1]);
+    bool selected = (center >= m_SelectedRange[0] && center <= m_SelectedRange[1]);
+
+    painter.fillRect(QRectF(left, widgetHeight - barHeight, right - left, barHeight), selected ? selectedColor : barColor);
+  }
+
+  // Outline the selected range
+  painter.setPen(selectedColor.darker());
+  painter.drawLine(QPointF(valueToX(m_SelectedRange[0]), 0), QPointF(valueToX(m_SelectedRange[0]), widgetHeight));
+  painter.drawLine(QPointF(valueToX(m_SelectedRange[1]), 0), QPointF(valueToX(m_SelectedRange[1]), widgetHeight));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::mousePressEvent(QMouseEvent* event)
+{
+  if(event->button() != Qt::LeftButton || !m_Histogram.isValid())
+  {
+    QWidget::mousePressEvent(event);
+    return;
+  }
+
+  m_Dragging = true;
+  m_DragStart = xToValue(event->x());
+  setSelectedRange(m_DragStart, m_DragStart);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::mouseMoveEvent(QMouseEvent* event)
+{
+  if(!m_Dragging)
+  {
+    QWidget::mouseMoveEvent(event);
+    return;
+  }
+
+  setSelectedRange(m_DragStart, xToValue(event->x()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::mouseReleaseEvent(QMouseEvent* event)
+{
+  if(!m_Dragging || event->button() != Qt::LeftButton)
+  {
+    QWidget::mouseReleaseEvent(event);
+    return;
+  }
+
+  m_Dragging = false;
+  setSelectedRange(m_DragStart, xToValue(event->x()));
+  emit rangeSelected(m_SelectedRange[0], m_SelectedRange[1]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogramWidget::contextMenuEvent(QContextMenuEvent* event)
+{
+  QMenu menu(this);
+  menu.addAction("Full Range", [=] { selectPercentileRange(0.0, 100.0); });
+  menu.addAction("1st - 99th Percentile", [=] { selectPercentileRange(1.0, 99.0); });
+  menu.addAction("5th - 95th Percentile", [=] { selectPercentileRange(5.0, 95.0); });
+  menu.addAction("25th - 75th Percentile", [=] { selectPercentileRange(25.0, 75.0); });
+  menu.addSeparator();
+  QAction* logAction = menu.addAction("Logarithmic Scale", this, &VSHistogramWidget::setLogScale);
+  logAction->setCheckable(true);
+  logAction->setChecked(m_LogScale);
+
+  for(QAction* action : menu.actions())
+  {
+    if(action != logAction && !action->isSeparator())
+    {
+      action->setEnabled(m_Histogram.isValid());
+    }
+  }
+
+  menu.exec(event->globalPos());
+}
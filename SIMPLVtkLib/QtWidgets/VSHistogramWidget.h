@@ -0,0 +1,137 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSHistogram.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSHistogramWidget VSHistogramWidget.h SIMPLVtkLib/QtWidgets/VSHistogramWidget.h
+ * @brief This widget draws a VSHistogram and highlights the selected value range.
+ * Dragging across the histogram selects a new range and the context menu snaps the
+ * range to common percentiles.
+ */
+class SIMPLVtkLib_EXPORT VSHistogramWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSHistogramWidget(QWidget* parent = nullptr);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSHistogramWidget() = default;
+
+  /**
+   * @brief Returns the histogram being displayed
+   * @return
+   */
+  const VSHistogram& getHistogram() const;
+
+  /**
+   * @brief Returns true if bar heights use a logarithmic scale.  Returns false otherwise.
+   * @return
+   */
+  bool isLogScale() const;
+
+  QSize sizeHint() const override;
+  QSize minimumSizeHint() const override;
+
+public slots:
+  /**
+   * @brief Sets the histogram to display
+   * @param histogram
+   */
+  void setHistogram(const VSHistogram& histogram);
+
+  /**
+   * @brief Sets the highlighted value range
+   * @param min
+   * @param max
+   */
+  void setSelectedRange(double min, double max);
+
+  /**
+   * @brief Sets whether bar heights use a logarithmic scale
+   * @param logScale
+   */
+  void setLogScale(bool logScale);
+
+  /**
+   * @brief Selects the range between the given percentiles and emits rangeSelected
+   * @param lowerPercent
+   * @param upperPercent
+   */
+  void selectPercentileRange(double lowerPercent, double upperPercent);
+
+signals:
+  void rangeSelected(double min, double max);
+
+protected:
+  void paintEvent(QPaintEvent* event) override;
+  void mousePressEvent(QMouseEvent* event) override;
+  void mouseMoveEvent(QMouseEvent* event) override;
+  void mouseReleaseEvent(QMouseEvent* event) override;
+  void contextMenuEvent(QContextMenuEvent* event) override;
+
+  /**
+   * @brief Converts a widget x coordinate to a data value
+   * @param x
+   * @return
+   */
+  double xToValue(int x) const;
+
+  /**
+   * @brief Converts a data value to a widget x coordinate
+   * @param value
+   * @return
+   */
+  double valueToX(double value) const;
+
+private:
+  VSHistogram m_Histogram;
+  double m_SelectedRange[2] = {0.0, 0.0};
+  bool m_LogScale = false;
+  bool m_Dragging = false;
+  double m_DragStart = 0.0;
+};
@@ -38,15 +38,16 @@
 #include <string>
 
 #include <vtkCamera.h>
+#include <vtkCellPicker.h>
 #include <vtkMath.h>
 #include <vtkPropPicker.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 
 #include "SIMPLVtkLib/QtWidgets/VSAbstractViewWidget.h"
+#include "SIMPLVtkLib/QtWidgets/VSRenderScheduler.h"
 #include "SIMPLVtkLib/QtWidgets/VSViewWidget.h"
 #include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
-#include "SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h"
 
 vtkStandardNewMacro(VSInteractorStyleFilterCamera);
 
@@ -81,7 +82,6 @@ void VSInteractorStyleFilterCamera::OnRightButtonDown()
   }
   updateLinkedRenderWindows();
 
-  determineSubsampling();
   // Cancel the current action
   cancelAction();
 }
@@ -138,7 +138,6 @@ void VSInteractorStyleFilterCamera::OnMouseMove()
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::OnMouseWheelForward()
 {
-  determineSubsampling();
   if(GetInteractionMode() == VTKIS_IMAGE2D)
   {
     vtkInteractorStyleImage::OnMouseWheelForward();
@@ -155,7 +154,6 @@ void VSInteractorStyleFilterCamera::OnMouseWheelForward()
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::OnMouseWheelBackward()
 {
-  determineSubsampling();
   if(GetInteractionMode() == VTKIS_IMAGE2D)
   {
     vtkInteractorStyleImage::OnMouseWheelBackward();
@@ -184,7 +182,7 @@ void VSInteractorStyleFilterCamera::updateLinkedRenderWindows()
   VSVisualizationWidget::LinkedRenderWindowType linkedRenderWindows = m_ViewWidget->getVisualizationWidget()->getLinkedRenderWindows();
   for(VTK_PTR(vtkRenderWindow) renderWindow : linkedRenderWindows)
   {
-    renderWindow->Render();
+    VSRenderScheduler::Instance()->requestRender(renderWindow);
   }
 }
 
@@ -543,6 +541,22 @@ VSInteractorStyleFilterCamera::FilterProp VSInteractorStyleFilterCamera::getFilt
   filterProp.first = picker->GetProp3D();
   filterProp.second = m_ViewWidget->getFilterFromProp(filterProp.first);
 
+  // Montage actors draw every tile, so the picked cell identifies the tile
+  VSMontageActor* montageActor = m_ViewWidget->getMontageActorFromProp(filterProp.first);
+  if(montageActor)
+  {
+    VTK_NEW(vtkCellPicker, cellPicker);
+    cellPicker->PickFromListOn();
+    cellPicker->AddPickList(filterProp.first);
+    cellPicker->Pick(pos[0], pos[1], 0, renderer);
+    VSFilterViewSettings* tile = montageActor->getTile(cellPicker->GetCellId());
+    if(tile && tile->getFilter())
+    {
+      filterProp.first = m_ViewWidget->getFilterProp(tile);
+      filterProp.second = tile->getFilter();
+    }
+  }
+
   renderer->GetRenderWindow()->Render();
 
   return filterProp;
@@ -617,7 +631,7 @@ void VSInteractorStyleFilterCamera::removeSelection(VSAbstractFilter* filter)
     else
     {
       m_ActiveFilter = (*selection.begin());
-      m_ActiveProp = m_ViewWidget->getFilterViewSettings(m_ActiveFilter)->getActor();
+      m_ActiveProp = m_ViewWidget->getFilterProp(m_ViewWidget->getFilterViewSettings(m_ActiveFilter));
     }
   }
 
@@ -781,13 +795,12 @@ void VSInteractorStyleFilterCamera::translateFilter()
   deltaPosition[2] = new_pick_point[2] - old_pick_point[2];
 
   VSTransform* transform = m_ActiveFilter->getTransform();
-  double* globalPosition = transform->getPosition();
+  std::array<double, 3> globalPosition = transform->getPosition();
   double localDelta[3];
   for(int i = 0; i < 3; i++)
   {
     localDelta[i] = deltaPosition[i] + globalPosition[i];
   }
-  delete[] globalPosition;
 
   transform->localizePoint(localDelta);
   for(int i = 0; i < 3; i++)
@@ -1064,7 +1077,7 @@ void VSInteractorStyleFilterCamera::beginScaling()
   if(m_ActiveFilter)
   {
     vtkRenderWindowInteractor* iren = this->Interactor;
-    double* obj_center = m_ActiveFilter->getTransform()->getPosition();
+    std::array<double, 3> obj_center = m_ActiveFilter->getTransform()->getPosition();
     double disp_obj_center[3];
     this->ComputeWorldToDisplay(obj_center[0], obj_center[1], obj_center[2], disp_obj_center);
 
@@ -1196,7 +1209,7 @@ void VSInteractorStyleFilterCamera::selectAllFilters()
     {
       continue;
     }
-    vtkProp3D* prop = m_ViewWidget->getFilterViewSettings(filter)->getActor();
+    vtkProp3D* prop = m_ViewWidget->getFilterProp(m_ViewWidget->getFilterViewSettings(filter));
 
     if(nullptr == prop || nullptr == filter)
     {
@@ -1320,77 +1333,3 @@ void VSInteractorStyleFilterCamera::updateTransformText()
   VSViewWidget* viewWidget = dynamic_cast<VSViewWidget*>(m_ViewWidget);
   viewWidget->updateTransformText(transformText);
 }
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::determineSubsampling()
-{
-  VTK_PTR(vtkCamera) camera = m_ViewWidget->getVisualizationWidget()->getRenderer()->GetActiveCamera();
-  double cameraPosition[3];
-  if(camera)
-  {
-    camera->GetPosition(cameraPosition);
-  }
-
-  // Check the memory available vs memory required for current subsampling rate
-  std::map<VSAbstractFilter*, VSFilterViewSettings*> allFilterViewSettings = m_ViewWidget->getAllFilterViewSettings();
-  bool isSIMPL = false;
-  VSSIMPLDataContainerFilter* simplDataContainerFilter;
-  VSDataSetFilter* imageDatasetFilter;
-  VSFilterViewSettings::Collection filterViewSettingsCollection;
-  double distanceToPlane;
-  for(auto iter = allFilterViewSettings.begin(); iter != allFilterViewSettings.end(); iter++)
-  {
-    filterViewSettingsCollection.push_back(iter->second);
-    if(!isSIMPL)
-    {
-      try
-      {
-        simplDataContainerFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(iter->first);
-        imageDatasetFilter = dynamic_cast<VSDataSetFilter*>(iter->first);
-      } catch(const std::bad_cast& badCastException)
-      {
-        qDebug() << badCastException.what();
-      }
-      isSIMPL = simplDataContainerFilter && iter->second->isFlat();
-      if(isSIMPL || imageDatasetFilter)
-      {
-        double position[3];
-        VTK_PTR(vtkProp3D) actor = iter->second->getActor();
-        if(actor)
-        {
-          actor->GetPosition(position);
-        }
-        VTK_PTR(vtkPlane) plane = VTK_PTR(vtkPlane)::New();
-        if(plane)
-        {
-          plane->SetOrigin(position);
-
-          // Check distance to plane from camera
-          distanceToPlane = plane->DistanceToPlane(cameraPosition);
-        }
-      }
-    }
-  }
-
-  // Only works if this is a VSSIMPLDataContainerFilter
-  if(isSIMPL)
-  {
-    int subsamplingRate = 1;
-
-    if(distanceToPlane > 10.0)
-    {
-      subsamplingRate = (distanceToPlane) / 1000;
-      if(subsamplingRate > 100)
-      {
-        subsamplingRate = 100;
-      }
-    }
-
-    if(subsamplingRate > 1)
-    {
-      VSFilterViewSettings::SetSubsampling(filterViewSettingsCollection, subsamplingRate);
-    }
-  }
-}
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <array>
+
 #include <vtkInteractorStyleImage.h>
 #include <vtkProp3D.h>
 
@@ -312,11 +314,6 @@ protected:
    */
   void updateLinkedRenderWindows();
 
-  /**
-   * @brief Determine the amount of subsampling to perform, if any
-   */
-  void determineSubsampling();
-
   /**
    * @brief Update the active transform text
    */
@@ -332,14 +329,14 @@ private:
   std::map<VSAbstractFilter*, VSTransform*> m_PreviousTransforms;
   std::map<VSAbstractFilter*, VSTransform*> m_LastUndoneTransforms;
   // Position
-  double* m_InitialPosition;
+  std::array<double, 3> m_InitialPosition;
   double m_Translation[3];
   // Rotation
   int* m_InitialMousePos;
   double* m_CameraAxis;
   double m_RotationAmt;
   // Scaling
-  double* m_InitialCenter;
+  std::array<double, 3> m_InitialCenter;
   double m_LastDistance;
   double m_ScaleAmt = 1.0;
 
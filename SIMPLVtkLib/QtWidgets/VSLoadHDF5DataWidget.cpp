@@ -37,6 +37,8 @@
 
 #include <QtConcurrent>
 
+#include <QtCore/QMutexLocker>
+
 #include <QtGui/QMovie>
 
 #include <QtWidgets/QMessageBox>
@@ -46,6 +48,7 @@
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
 #include "SIMPLVtkLib/Dialogs/Utilities/DREAM3DFileTreeModel.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -165,6 +168,7 @@ DataContainerArrayProxy VSLoadHDF5DataWidget::readDCAProxy(const QString& filePa
 {
   QFileInfo fi(filePath);
 
+  QMutexLocker hdf5Lock(VSConcurrentImport::HDF5Mutex());
   SIMPLH5DataReader reader;
   connect(&reader, &SIMPLH5DataReader::errorGenerated, [=](const QString& title, const QString& msg, const int& code) {
     m_Ui->errLabel->setText(tr("%1").arg(msg));
@@ -38,6 +38,7 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSTextFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdFilter.h"
@@ -127,12 +128,7 @@ void VSMainWidget2::renderAll()
   QVector<VSAbstractViewWidget*> viewWidgets = getAllViewWidgets();
   for(auto iter = viewWidgets.begin(); iter != viewWidgets.end(); iter++)
   {
-    VSVisualizationWidget* visualizationWidget = (*iter)->getVisualizationWidget();
-    if(visualizationWidget)
-    {
-      // Render the VTK widget
-      visualizationWidget->render();
-    }
+    (*iter)->renderView();
   }
 }
 
@@ -202,6 +198,10 @@ void VSMainWidget2::setCurrentFilter(VSAbstractFilter* filter)
   m_Ui->sliceBtn->setEnabled(enableSlice);
   m_ActionAddSlice->setEnabled(enableSlice);
 
+  // Ortho Slice
+  bool enableOrthoSlice = VSOrthoSliceFilter::CompatibleWithParent(filter);
+  m_ActionAddOrthoSlice->setEnabled(enableOrthoSlice);
+
   // Crop Filter
   bool enableCrop = VSCropFilter::CompatibleWithParent(filter);
   m_ActionAddCrop->setEnabled(enableCrop);
@@ -279,6 +279,10 @@ void VSMainWidget2::updateFilterButtons()
   m_Ui->sliceBtn->setEnabled(enableSlice);
   m_ActionAddSlice->setEnabled(enableSlice);
 
+  // Ortho Slice
+  bool enableOrthoSlice = VSOrthoSliceFilter::CompatibleWithParents(filtersSelected);
+  m_ActionAddOrthoSlice->setEnabled(enableOrthoSlice);
+
   // Crop Filter
   bool enableCrop = VSCropFilter::CompatibleWithParents(filtersSelected);
   m_ActionAddCrop->setEnabled(enableCrop);
@@ -583,6 +587,9 @@ void VSMainWidget2::createFilterMenu()
   m_ActionAddSlice = new QAction("Slice Filter");
   connect(m_ActionAddSlice, SIGNAL(triggered()), this, SLOT(createSliceFilter()));
 
+  m_ActionAddOrthoSlice = new QAction("Ortho Slice Filter");
+  connect(m_ActionAddOrthoSlice, SIGNAL(triggered()), this, SLOT(createOrthoSliceFilter()));
+
   m_ActionAddThreshold = new QAction("Threshold Filter");
   connect(m_ActionAddThreshold, SIGNAL(triggered()), this, SLOT(createThresholdFilter()));
 
@@ -596,6 +603,7 @@ void VSMainWidget2::createFilterMenu()
   m_FilterMenu = new QMenu("Filters", this);
   m_FilterMenu->addAction(m_ActionAddClip);
   m_FilterMenu->addAction(m_ActionAddSlice);
+  m_FilterMenu->addAction(m_ActionAddOrthoSlice);
   m_FilterMenu->addAction(m_ActionAddCrop);
   m_FilterMenu->addAction(m_ActionAddThreshold);
   m_FilterMenu->addAction(m_ActionAddMask);
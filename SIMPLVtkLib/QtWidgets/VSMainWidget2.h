@@ -243,6 +243,7 @@ private:
   QAction* m_ActionAddClip = nullptr;
   QAction* m_ActionAddCrop = nullptr;
   QAction* m_ActionAddSlice = nullptr;
+  QAction* m_ActionAddOrthoSlice = nullptr;
   QAction* m_ActionAddMask = nullptr;
   QAction* m_ActionAddThreshold = nullptr;
 
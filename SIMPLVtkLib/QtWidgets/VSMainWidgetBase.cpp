@@ -41,6 +41,7 @@
 #include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QThread>
 #include <QtCore/QUuid>
 #include <QtGui/QKeySequence>
@@ -54,13 +55,16 @@
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
 #include "SIMPLVtkLib/Dialogs/LoadHDF5FileDialog.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h"
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSPipelineFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSRootFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
@@ -487,6 +491,7 @@ void VSMainWidgetBase::launchHDF5SelectionDialog(const QString& filePath)
 
   if(ret == QDialog::Accepted)
   {
+    QMutexLocker hdf5Lock(VSConcurrentImport::HDF5Mutex());
     SIMPLH5DataReader reader;
 
     bool success = reader.openFile(filePath);
@@ -495,7 +500,12 @@ void VSMainWidgetBase::launchHDF5SelectionDialog(const QString& filePath)
       connect(&reader, SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SLOT(generateError(const QString&, const QString&, const int&)));
 
       DataContainerArrayProxy dcaProxy = dialog->getDataStructureProxy();
-      DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(dcaProxy, false);
+      DataContainerArray::Pointer dca;
+      {
+        VS_TRACE_NAMED_SCOPE(traceScope, "Import", "Read HDF5 Data");
+        VS_TRACE_DETAIL(traceScope, filePath);
+        dca = reader.readSIMPLDataUsingProxy(dcaProxy, false);
+      }
       if(dca.get() == nullptr)
       {
         return;
@@ -853,6 +863,7 @@ void VSMainWidgetBase::reloadFilters(std::vector<VSAbstractDataFilter*> filters)
   else if(filters.size() > 1 && dynamic_cast<VSSIMPLDataContainerFilter*>(filters[0]) != nullptr)
   {
     // This is from a file containing multiple SIMPL Data Containers, so we will use this block of code to optimize the file reading process
+    QMutexLocker hdf5Lock(VSConcurrentImport::HDF5Mutex());
     QSharedPointer<SIMPLH5DataReader> reader = QSharedPointer<SIMPLH5DataReader>(new SIMPLH5DataReader());
     connect(reader.data(), SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SLOT(generateError(const QString&, const QString&, const int&)));
 
@@ -890,7 +901,11 @@ void VSMainWidgetBase::reloadFilters(std::vector<VSAbstractDataFilter*> filters)
         dataContainers[dcProxy.getName()] = dcProxy;
       }
 
-      DataContainerArray::Pointer dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+      DataContainerArray::Pointer dca;
+      {
+        VS_TRACE_SCOPE("Import", "Read HDF5 Data");
+        dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+      }
       if(dca->getDataContainers().size() > 0)
       {
         m_Controller->importDataContainerArray(fileNameFilter, dca);
@@ -975,6 +990,30 @@ void VSMainWidgetBase::createSliceFilter(VSAbstractFilter::FilterListType parent
   selectFilters(createdFilters);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMainWidgetBase::createOrthoSliceFilter(VSAbstractFilter::FilterListType parents)
+{
+  if(parents.size() == 0)
+  {
+    parents = getCurrentSelection();
+  }
+
+  VSAbstractFilter::FilterListType createdFilters;
+  for(VSAbstractFilter* parent : parents)
+  {
+    if(parent && VSOrthoSliceFilter::CompatibleWithParent(parent))
+    {
+      VSOrthoSliceFilter* filter = new VSOrthoSliceFilter(parent);
+      finishAddingFilter(filter, parent);
+      createdFilters.push_back(filter);
+    }
+  }
+
+  selectFilters(createdFilters);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
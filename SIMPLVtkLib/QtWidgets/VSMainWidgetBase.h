@@ -233,6 +233,13 @@ public slots:
    */
   void createSliceFilter(VSAbstractFilter::FilterListType parents = VSAbstractFilter::FilterListType());
 
+  /**
+   * @brief Create an orthogonal slice filter and set the given filter as its parent.  If no filter
+   * is provided, the current filter is used instead.
+   * @param parents
+   */
+  void createOrthoSliceFilter(VSAbstractFilter::FilterListType parents = VSAbstractFilter::FilterListType());
+
   /**
    * @brief Create a mask filter and set the given filter as its parent.  If no filter is provided,
    * the current filter is used instead.
@@ -0,0 +1,227 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSRenderScheduler.h"
+
+#include <algorithm>
+
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
+#include "SIMPLVtkLib/QtWidgets/VSAbstractViewWidget.h"
+
+namespace
+{
+const int DefaultFrameInterval = 16;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderScheduler::VSRenderScheduler()
+: QObject()
+, m_FrameInterval(DefaultFrameInterval)
+{
+  m_FrameTimer.setSingleShot(true);
+  m_FrameTimer.setTimerType(Qt::PreciseTimer);
+  connect(&m_FrameTimer, &QTimer::timeout, this, &VSRenderScheduler::renderFrame);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderScheduler* VSRenderScheduler::Instance()
+{
+  static VSRenderScheduler instance;
+  return &instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::requestRender(VSAbstractViewWidget* viewWidget)
+{
+  if(nullptr == viewWidget)
+  {
+    return;
+  }
+
+  m_FrameStatistics[viewWidget].m_RequestCount++;
+  if(!isRenderPending(viewWidget))
+  {
+    m_DirtyViews.push_back(viewWidget);
+  }
+
+  scheduleFrame();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::requestRender(vtkRenderWindow* renderWindow)
+{
+  if(nullptr == renderWindow)
+  {
+    return;
+  }
+
+  auto iter = std::find_if(m_DirtyWindows.begin(), m_DirtyWindows.end(), [=](const vtkWeakPointer<vtkRenderWindow>& window) { return window.GetPointer() == renderWindow; });
+  if(iter == m_DirtyWindows.end())
+  {
+    m_DirtyWindows.push_back(renderWindow);
+  }
+
+  scheduleFrame();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::cancelRender(VSAbstractViewWidget* viewWidget)
+{
+  m_DirtyViews.erase(std::remove(m_DirtyViews.begin(), m_DirtyViews.end(), viewWidget), m_DirtyViews.end());
+  m_FrameStatistics.erase(viewWidget);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSRenderScheduler::isRenderPending(VSAbstractViewWidget* viewWidget) const
+{
+  return std::find(m_DirtyViews.begin(), m_DirtyViews.end(), viewWidget) != m_DirtyViews.end();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSRenderScheduler::getFrameInterval() const
+{
+  return m_FrameInterval;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::setFrameInterval(int milliseconds)
+{
+  m_FrameInterval = std::max(milliseconds, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderScheduler::FrameStatistics VSRenderScheduler::getFrameStatistics(VSAbstractViewWidget* viewWidget) const
+{
+  auto iter = m_FrameStatistics.find(viewWidget);
+  if(iter == m_FrameStatistics.end())
+  {
+    return FrameStatistics();
+  }
+
+  return iter->second;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::resetFrameStatistics()
+{
+  m_FrameStatistics.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::scheduleFrame()
+{
+  if(m_FrameTimer.isActive())
+  {
+    return;
+  }
+
+  // Wait out the remainder of the current frame before rendering again
+  qint64 elapsed = m_FrameClock.isValid() ? m_FrameClock.elapsed() : m_FrameInterval;
+  m_FrameTimer.start(static_cast<int>(std::max<qint64>(m_FrameInterval - elapsed, 0)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderScheduler::renderFrame()
+{
+  VS_TRACE_SCOPE("Render", "Render Frame");
+  m_FrameClock.restart();
+
+  // Views requesting a render while this frame is drawn are rendered in the next frame
+  std::vector<QPointer<VSAbstractViewWidget>> dirtyViews;
+  std::vector<vtkWeakPointer<vtkRenderWindow>> dirtyWindows;
+  dirtyViews.swap(m_DirtyViews);
+  dirtyWindows.swap(m_DirtyWindows);
+
+  QElapsedTimer frameTimer;
+  for(const QPointer<VSAbstractViewWidget>& viewWidget : dirtyViews)
+  {
+    if(viewWidget.isNull())
+    {
+      continue;
+    }
+
+    // Hidden views stay dirty until they are shown
+    if(!viewWidget->isVisible())
+    {
+      if(!isRenderPending(viewWidget))
+      {
+        m_DirtyViews.push_back(viewWidget);
+      }
+      continue;
+    }
+
+    frameTimer.start();
+    viewWidget->renderImmediately();
+    double frameTime = frameTimer.nsecsElapsed() / 1.0e6;
+
+    FrameStatistics& statistics = m_FrameStatistics[viewWidget];
+    statistics.m_FrameCount++;
+    statistics.m_LastFrameTime = frameTime;
+    statistics.m_TotalFrameTime += frameTime;
+    statistics.m_MaxFrameTime = std::max(statistics.m_MaxFrameTime, frameTime);
+    emit frameRendered(viewWidget, frameTime);
+  }
+
+  for(const vtkWeakPointer<vtkRenderWindow>& renderWindow : dirtyWindows)
+  {
+    if(renderWindow)
+    {
+      renderWindow->Render();
+    }
+  }
+}
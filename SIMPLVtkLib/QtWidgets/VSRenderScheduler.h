@@ -0,0 +1,155 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QTimer>
+
+#include <vtkRenderWindow.h>
+#include <vtkWeakPointer.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class VSAbstractViewWidget;
+
+/**
+ * @class VSRenderScheduler VSRenderScheduler.h SIMPLVtkLib/QtWidgets/VSRenderScheduler.h
+ * @brief This class defers render requests until the next display frame.  Views
+ * requesting a render are marked dirty and every dirty view is rendered at most once
+ * per frame interval no matter how many requests were made.  Views whose widgets are
+ * hidden stay dirty and are rendered once they are shown again.  The time spent
+ * rendering each view is recorded for instrumentation.
+ */
+class SIMPLVtkLib_EXPORT VSRenderScheduler : public QObject
+{
+  Q_OBJECT
+
+public:
+  struct FrameStatistics
+  {
+    int m_RequestCount = 0;
+    int m_FrameCount = 0;
+    double m_LastFrameTime = 0.0;
+    double m_TotalFrameTime = 0.0;
+    double m_MaxFrameTime = 0.0;
+  };
+
+  /**
+   * @brief Returns the application-wide render scheduler
+   * @return
+   */
+  static VSRenderScheduler* Instance();
+
+  virtual ~VSRenderScheduler() = default;
+
+  /**
+   * @brief Marks the view as requiring a render during the next frame
+   * @param viewWidget
+   */
+  void requestRender(VSAbstractViewWidget* viewWidget);
+
+  /**
+   * @brief Marks a render window without a view widget as requiring a render during the next frame
+   * @param renderWindow
+   */
+  void requestRender(vtkRenderWindow* renderWindow);
+
+  /**
+   * @brief Removes any pending render and the frame statistics for the given view
+   * @param viewWidget
+   */
+  void cancelRender(VSAbstractViewWidget* viewWidget);
+
+  /**
+   * @brief Returns true if the view is waiting to be rendered
+   * @param viewWidget
+   * @return
+   */
+  bool isRenderPending(VSAbstractViewWidget* viewWidget) const;
+
+  /**
+   * @brief Returns the minimum time in milliseconds between frames
+   * @return
+   */
+  int getFrameInterval() const;
+
+  /**
+   * @brief Sets the minimum time in milliseconds between frames
+   * @param milliseconds
+   */
+  void setFrameInterval(int milliseconds);
+
+  /**
+   * @brief Returns the render requests and frame times recorded for the given view
+   * @param viewWidget
+   * @return
+   */
+  FrameStatistics getFrameStatistics(VSAbstractViewWidget* viewWidget) const;
+
+  /**
+   * @brief Clears the recorded frame statistics for every view
+   */
+  void resetFrameStatistics();
+
+signals:
+  void frameRendered(VSAbstractViewWidget* viewWidget, double milliseconds);
+
+protected:
+  VSRenderScheduler();
+
+  /**
+   * @brief Starts the frame timer if it is not already running.  Frames are spaced
+   * by at least the frame interval.
+   */
+  void scheduleFrame();
+
+  /**
+   * @brief Renders every dirty view that is visible and every dirty render window
+   */
+  void renderFrame();
+
+private:
+  std::vector<QPointer<VSAbstractViewWidget>> m_DirtyViews;
+  std::vector<vtkWeakPointer<vtkRenderWindow>> m_DirtyWindows;
+  std::map<const VSAbstractViewWidget*, FrameStatistics> m_FrameStatistics;
+  QTimer m_FrameTimer;
+  QElapsedTimer m_FrameClock;
+  int m_FrameInterval;
+};
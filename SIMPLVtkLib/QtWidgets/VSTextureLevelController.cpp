@@ -0,0 +1,383 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSTextureLevelController.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+
+#include <vtkCallbackCommand.h>
+#include <vtkCamera.h>
+#include <vtkCommand.h>
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkProp3D.h>
+
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
+#include "SIMPLVtkLib/QtWidgets/VSAbstractViewWidget.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.h"
+
+namespace
+{
+const int DefaultFrameBudget = 8;
+const int CoarsestTextureLevel = 16;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTextureLevelController::VSTextureLevelController(VSAbstractViewWidget* viewWidget)
+: QObject(viewWidget)
+, m_ViewWidget(viewWidget)
+, m_FrameBudget(DefaultFrameBudget)
+{
+  if(m_ViewWidget && m_ViewWidget->getVisualizationWidget())
+  {
+    setRenderer(m_ViewWidget->getVisualizationWidget()->getRenderer());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTextureLevelController::~VSTextureLevelController()
+{
+  setRenderer(nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureLevelController::setRenderer(vtkRenderer* renderer)
+{
+  if(m_Renderer)
+  {
+    m_Renderer->RemoveObserver(m_ObserverTag);
+    m_ObserverTag = 0;
+  }
+
+  m_Renderer = renderer;
+  if(m_Renderer)
+  {
+    VTK_NEW(vtkCallbackCommand, callback);
+    callback->SetCallback(&VSTextureLevelController::RenderFinished);
+    callback->SetClientData(this);
+    m_ObserverTag = m_Renderer->AddObserver(vtkCommand::EndEvent, callback);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSTextureLevelController::getFrameBudget() const
+{
+  return m_FrameBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureLevelController::setFrameBudget(int milliseconds)
+{
+  m_FrameBudget = std::max(milliseconds, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSTextureLevelController::getPendingCount() const
+{
+  return static_cast<int>(m_PendingChanges.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureLevelController::RenderFinished(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  VSTextureLevelController* controller = static_cast<VSTextureLevelController*>(clientData);
+  if(controller)
+  {
+    controller->requestUpdate();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureLevelController::requestUpdate()
+{
+  // Levels are calculated after the frame completes rather than from within the render
+  if(m_UpdateRequested)
+  {
+    return;
+  }
+
+  m_UpdateRequested = true;
+  QTimer::singleShot(0, this, [this] {
+    m_UpdateRequested = false;
+    updateLevels();
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextureLevelController::calculateLevel(VSFilterViewSettings* settings, int& level, double& area) const
+{
+  level = 0;
+  area = 0.0;
+
+  VTK_PTR(vtkDataSet) outputData = settings->getFilter()->getOutput();
+  vtkImageData* imageData = vtkImageData::SafeDownCast(outputData);
+  vtkDataArray* scalars = VSImagePyramidCache::GetTextureScalars(imageData);
+  VTK_PTR(vtkProp3D) actor = settings->getActor();
+  if(nullptr == scalars || nullptr == actor)
+  {
+    return true;
+  }
+
+  double bounds[6];
+  actor->GetBounds(bounds);
+  return calculateLevel(bounds, scalars->GetNumberOfTuples(), settings->getTextureLevel(), level, area);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextureLevelController::calculateLevel(double bounds[6], vtkIdType numTexels, int currentLevel, int& level, double& area) const
+{
+  level = 0;
+  area = 0.0;
+  if(false == vtkMath::AreBoundsInitialized(bounds) || numTexels <= 0)
+  {
+    return true;
+  }
+
+  int* viewportSize = m_Renderer->GetSize();
+
+  // Project the corners of the bounding box into normalized device coordinates
+  vtkCamera* camera = m_Renderer->GetActiveCamera();
+  vtkMatrix4x4* projection = camera->GetCompositeProjectionTransformMatrix(m_Renderer->GetTiledAspectRatio(), -1, 1);
+  double ndcMin[2] = {VTK_DOUBLE_MAX, VTK_DOUBLE_MAX};
+  double ndcMax[2] = {VTK_DOUBLE_MIN, VTK_DOUBLE_MIN};
+  bool behindCamera = false;
+  for(int corner = 0; corner < 8; corner++)
+  {
+    double point[4] = {bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)], bounds[4 + ((corner >> 2) & 1)], 1.0};
+    double projected[4];
+    projection->MultiplyPoint(point, projected);
+    if(projected[3] <= 0.0)
+    {
+      behindCamera = true;
+      break;
+    }
+
+    for(int i = 0; i < 2; i++)
+    {
+      double value = projected[i] / projected[3];
+      ndcMin[i] = std::min(ndcMin[i], value);
+      ndcMax[i] = std::max(ndcMax[i], value);
+    }
+  }
+
+  // Tiles crossing the camera plane are treated as covering the whole viewport
+  if(behindCamera)
+  {
+    area = static_cast<double>(viewportSize[0]) * viewportSize[1];
+    return true;
+  }
+
+  if(ndcMax[0] < -1.0 || ndcMin[0] > 1.0 || ndcMax[1] < -1.0 || ndcMin[1] > 1.0)
+  {
+    level = currentLevel;
+    return false;
+  }
+
+  double footprint = 1.0;
+  area = 1.0;
+  for(int i = 0; i < 2; i++)
+  {
+    footprint *= std::max((ndcMax[i] - ndcMin[i]) * 0.5 * viewportSize[i], 1.0);
+    area *= (std::min(ndcMax[i], 1.0) - std::max(ndcMin[i], -1.0)) * 0.5 * viewportSize[i];
+  }
+
+  // Each level halves both texture dimensions
+  double texelsPerPixel = numTexels / footprint;
+  if(texelsPerPixel > 1.0)
+  {
+    level = std::min(static_cast<int>(std::floor(0.5 * std::log2(texelsPerPixel))), CoarsestTextureLevel);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureLevelController::updateLevels()
+{
+  m_PendingChanges.clear();
+  if(nullptr == m_ViewWidget || nullptr == m_Renderer)
+  {
+    return;
+  }
+
+  int* viewportSize = m_Renderer->GetSize();
+  if(viewportSize[0] <= 0 || viewportSize[1] <= 0)
+  {
+    return;
+  }
+
+  // The pyramid cache sizes its budget to hold a pyramid for every displayed tile
+  size_t sourceMemorySize = 0;
+  VSFilterViewSettings::Map allViewSettings = m_ViewWidget->getAllFilterViewSettings();
+  for(auto iter = allViewSettings.begin(); iter != allViewSettings.end(); iter++)
+  {
+    VSFilterViewSettings* settings = iter->second;
+    if(nullptr == settings || !settings->isVisible() || VSFilterViewSettings::ActorType::Image2D != settings->getActorType())
+    {
+      continue;
+    }
+
+    vtkDataArray* scalars = VSImagePyramidCache::GetTextureScalars(vtkImageData::SafeDownCast(settings->getFilter()->getOutput()));
+    if(scalars)
+    {
+      sourceMemorySize += static_cast<size_t>(scalars->GetActualMemorySize()) * 1024;
+    }
+
+    // Tiles drawn by a montage atlas do not render their own textures
+    if(!m_Renderer->HasViewProp(settings->getActor()))
+    {
+      continue;
+    }
+
+    // Culled tiles keep their current level.  Coarsening them would build pyramids
+    // that are never drawn and evict the levels of the visible tiles from the cache.
+    int level;
+    double area;
+    int currentLevel = settings->getTextureLevel();
+    if(!calculateLevel(settings, level, area) || level == currentLevel)
+    {
+      continue;
+    }
+
+    // Sharpen tiles first, largest on screen first, then coarsen tiles
+    LevelChange change;
+    change.m_Settings = settings;
+    change.m_Level = level;
+    if(level < currentLevel)
+    {
+      change.m_Priority = 1.0 + area;
+    }
+    else
+    {
+      change.m_Priority = area / (1.0 + area);
+    }
+    m_PendingChanges.push_back(change);
+  }
+
+  VSImagePyramidCache::Instance()->setSourceMemorySize(sourceMemorySize);
+
+  // Montages take the level for their size on screen.  Montages whose atlas cannot hold
+  // that level draw their tiles with their own actors, which were handled above.
+  for(VSMontageActor* montageActor : m_ViewWidget->getMontageActors())
+  {
+    if(0 == montageActor->getNumberOfTiles())
+    {
+      continue;
+    }
+
+    double bounds[6];
+    montageActor->getBounds(bounds);
+    int level;
+    double area;
+    if(calculateLevel(bounds, montageActor->getSourceTexelCount(), montageActor->getRequestedTextureLevel(), level, area))
+    {
+      montageActor->setRequestedTextureLevel(level);
+    }
+  }
+
+  std::sort(m_PendingChanges.begin(), m_PendingChanges.end(), [](const LevelChange& lhs, const LevelChange& rhs) { return lhs.m_Priority > rhs.m_Priority; });
+
+  if(!m_PendingChanges.empty() && !m_ApplyRequested)
+  {
+    m_ApplyRequested = true;
+    QTimer::singleShot(0, this, [this] {
+      m_ApplyRequested = false;
+      applyPendingLevels();
+    });
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureLevelController::applyPendingLevels()
+{
+  if(m_PendingChanges.empty())
+  {
+    return;
+  }
+
+  VS_TRACE_SCOPE("Render", "Apply Texture Levels");
+  QElapsedTimer timer;
+  timer.start();
+
+  size_t count = 0;
+  do
+  {
+    LevelChange& change = m_PendingChanges[count++];
+    if(change.m_Settings)
+    {
+      change.m_Settings->setTextureLevel(change.m_Level);
+    }
+  } while(count < m_PendingChanges.size() && timer.elapsed() < m_FrameBudget);
+  m_PendingChanges.erase(m_PendingChanges.begin(), m_PendingChanges.begin() + count);
+
+  // Rendering recalculates the remaining levels for the new frame
+  m_ViewWidget->renderView();
+  if(!m_PendingChanges.empty() && !m_ApplyRequested)
+  {
+    m_ApplyRequested = true;
+    QTimer::singleShot(0, this, [this] {
+      m_ApplyRequested = false;
+      applyPendingLevels();
+    });
+  }
+}
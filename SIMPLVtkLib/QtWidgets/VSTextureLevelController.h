@@ -0,0 +1,167 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+
+#include <vtkRenderer.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewSettings.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkObject;
+class VSAbstractViewWidget;
+
+/**
+ * @class VSTextureLevelController VSTextureLevelController.h SIMPLVtkLib/QtWidgets/VSTextureLevelController.h
+ * @brief This class chooses the image pyramid level of every flat image tile in a
+ * view widget from the tile's projected size on screen.  Tiles outside of the view
+ * frustum keep their current level so that no pyramids are built for them.  Level changes are applied in priority
+ * order over several frames so that a large montage does not stall the interactor.
+ * Montage actors are given the level for the montage's size on screen.  When their atlas
+ * cannot hold that level, the tiles are drawn by their own actors and receive their own levels.
+ */
+class SIMPLVtkLib_EXPORT VSTextureLevelController : public QObject
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param viewWidget
+   */
+  VSTextureLevelController(VSAbstractViewWidget* viewWidget);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSTextureLevelController();
+
+  /**
+   * @brief Returns the time in milliseconds spent applying texture levels per frame
+   * @return
+   */
+  int getFrameBudget() const;
+
+  /**
+   * @brief Sets the time in milliseconds spent applying texture levels per frame.
+   * At least one tile is updated each frame regardless of the budget.
+   * @param milliseconds
+   */
+  void setFrameBudget(int milliseconds);
+
+  /**
+   * @brief Returns the number of texture level changes waiting to be applied
+   * @return
+   */
+  int getPendingCount() const;
+
+public slots:
+  /**
+   * @brief Schedules the texture levels to be recalculated once control returns to the event loop
+   */
+  void requestUpdate();
+
+protected:
+  /**
+   * @brief Recalculates the texture level for each visible flat image and queues the changes
+   */
+  void updateLevels();
+
+  /**
+   * @brief Applies queued texture level changes until the frame budget is spent
+   */
+  void applyPendingLevels();
+
+  /**
+   * @brief Sets the renderer observed for finished frames
+   * @param renderer
+   */
+  void setRenderer(vtkRenderer* renderer);
+
+  /**
+   * @brief Calculates the pyramid level for the given tile.  Returns false and the
+   * tile's current level if the tile is outside of the view frustum.  The area
+   * parameter is set to the number of screen pixels covered by the tile.
+   * @param settings
+   * @param level
+   * @param area
+   * @return
+   */
+  bool calculateLevel(VSFilterViewSettings* settings, int& level, double& area) const;
+
+  /**
+   * @brief Calculates the pyramid level for the given number of texels drawn within the
+   * given world bounds.  Returns false and the current level if the bounds are outside of
+   * the view frustum.  The area parameter is set to the number of screen pixels covered.
+   * @param bounds
+   * @param numTexels
+   * @param currentLevel
+   * @param level
+   * @param area
+   * @return
+   */
+  bool calculateLevel(double bounds[6], vtkIdType numTexels, int currentLevel, int& level, double& area) const;
+
+  /**
+   * @brief Callback for the renderer's EndEvent
+   * @param caller
+   * @param eventId
+   * @param clientData
+   * @param callData
+   */
+  static void RenderFinished(vtkObject* caller, unsigned long eventId, void* clientData, void* callData);
+
+private:
+  struct LevelChange
+  {
+    QPointer<VSFilterViewSettings> m_Settings;
+    int m_Level = 0;
+    double m_Priority = 0.0;
+  };
+
+  VSAbstractViewWidget* m_ViewWidget = nullptr;
+  VTK_PTR(vtkRenderer) m_Renderer = nullptr;
+  unsigned long m_ObserverTag = 0;
+  std::vector<LevelChange> m_PendingChanges;
+  bool m_UpdateRequested = false;
+  bool m_ApplyRequested = false;
+  int m_FrameBudget;
+};
@@ -97,9 +97,9 @@ void VSTransformWidget::setupGui()
     for(VSAbstractFilter* filter : m_SelectedFilters)
     {
       VSTransform* transform = filter->getTransform();
-      double* resetPos = transform->getOriginPosition();
-      double* resetRot = transform->getOriginRotation();
-      double* resetScale = transform->getOriginScale();
+      std::array<double, 3> resetPos = transform->getOriginPosition();
+      std::array<double, 3> resetRot = transform->getOriginRotation();
+      std::array<double, 3> resetScale = transform->getOriginScale();
       transform->setLocalPosition(resetPos);
       transform->setLocalRotation(resetRot);
       transform->setLocalScale(resetScale);
@@ -164,40 +164,31 @@ void VSTransformWidget::setTransform(VSTransform* transform)
     connect(transform, &VSTransform::updatedLocalScale, this, &VSTransformWidget::updateLocalScale);
 
     // local
-    double* localPos = transform->getLocalPosition();
-    double* originPosition = transform->getOriginPosition();
-    if(originPosition != nullptr)
+    std::array<double, 3> localPos = transform->getLocalPosition();
+    std::array<double, 3> originPosition = transform->getOriginPosition();
+    for(int i = 0; i < 3; i++)
     {
-      for(int i = 0; i < 3; i++)
-      {
-        localPos[i] -= originPosition[i];
-      }
+      localPos[i] -= originPosition[i];
     }
     m_Internals->posXEdit->setText(QString::number(localPos[0]));
     m_Internals->posYEdit->setText(QString::number(localPos[1]));
     m_Internals->posZEdit->setText(QString::number(localPos[2]));
 
-    double* localRot = transform->getLocalRotation();
-    double* originRotation = transform->getOriginRotation();
-    if(originRotation != nullptr)
+    std::array<double, 3> localRot = transform->getLocalRotation();
+    std::array<double, 3> originRotation = transform->getOriginRotation();
+    for(int i = 0; i < 3; i++)
     {
-      for(int i = 0; i < 3; i++)
-      {
-        localRot[i] -= originRotation[i];
-      }
+      localRot[i] -= originRotation[i];
     }
     m_Internals->rotXEdit->setText(QString::number(localRot[0]));
     m_Internals->rotYEdit->setText(QString::number(localRot[1]));
     m_Internals->rotZEdit->setText(QString::number(localRot[2]));
 
-    double* localScale = transform->getLocalScale();
-    double* originScale = transform->getOriginScale();
-    if(originScale != nullptr)
+    std::array<double, 3> localScale = transform->getLocalScale();
+    std::array<double, 3> originScale = transform->getOriginScale();
+    for(int i = 0; i < 3; i++)
     {
-      for(int i = 0; i < 3; i++)
-      {
-        localScale[i] /= originScale[i];
-      }
+      localScale[i] /= originScale[i];
     }
     m_Internals->scaleXEdit->setText(QString::number(localScale[0]));
     m_Internals->scaleYEdit->setText(QString::number(localScale[1]));
@@ -281,7 +272,7 @@ void VSTransformWidget::translationEditChanged()
 
   for(VSAbstractFilter* filter : m_SelectedFilters)
   {
-    double* originPosition = filter->getTransform()->getOriginPosition();
+    std::array<double, 3> originPosition = filter->getTransform()->getOriginPosition();
     position[0] = m_Internals->posXEdit->text().toDouble() + originPosition[0];
     position[1] = m_Internals->posYEdit->text().toDouble() + originPosition[1];
     position[2] = m_Internals->posZEdit->text().toDouble() + originPosition[2];
@@ -303,8 +294,8 @@ void VSTransformWidget::rotationEditChanged(char axis)
 
   for(VSAbstractFilter* filter : m_SelectedFilters)
   {
-    double* originRotation = filter->getTransform()->getOriginRotation();
-    double* localRotation = filter->getTransform()->getLocalRotation();
+    std::array<double, 3> originRotation = filter->getTransform()->getOriginRotation();
+    std::array<double, 3> localRotation = filter->getTransform()->getLocalRotation();
 
     switch(axis)
     {
@@ -347,8 +338,8 @@ void VSTransformWidget::scaleEditChanged(char axis)
 
   for(VSAbstractFilter* filter : m_SelectedFilters)
   {
-    double* originScale = filter->getTransform()->getOriginScale();
-    double* localScale = filter->getTransform()->getLocalScale();
+    std::array<double, 3> originScale = filter->getTransform()->getOriginScale();
+    std::array<double, 3> localScale = filter->getTransform()->getLocalScale();
 
     switch(axis)
     {
@@ -382,16 +373,8 @@ void VSTransformWidget::scaleEditChanged(char axis)
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateTranslationLabels()
 {
-  double* position;
-  if(nullptr == m_Transform)
-  {
-    position = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      position[i] = 0.0;
-    }
-  }
-  else
+  std::array<double, 3> position = {{0.0, 0.0, 0.0}};
+  if(m_Transform)
   {
     position = m_Transform->getPosition();
   }
@@ -412,25 +395,14 @@ void VSTransformWidget::updateTranslationLabels()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateRotationLabels()
 {
-  double* rotation;
-  if(nullptr == m_Transform)
-  {
-    rotation = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      rotation[i] = 0.0;
-    }
-  }
-  else
+  std::array<double, 3> rotation = {{0.0, 0.0, 0.0}};
+  if(m_Transform)
   {
     rotation = m_Transform->getRotation();
-    double* originRotation = m_Transform->getOriginRotation();
-    if(originRotation != nullptr)
+    std::array<double, 3> originRotation = m_Transform->getOriginRotation();
+    for(int i = 0; i < 3; i++)
     {
-      for(int i = 0; i < 3; i++)
-      {
-        rotation[i] -= originRotation[i];
-      }
+      rotation[i] -= originRotation[i];
     }
   }
 
@@ -450,16 +422,8 @@ void VSTransformWidget::updateRotationLabels()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateScaleLabels()
 {
-  double* scale;
-  if(nullptr == m_Transform)
-  {
-    scale = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      scale[i] = 1.0;
-    }
-  }
-  else
+  std::array<double, 3> scale = {{1.0, 1.0, 1.0}};
+  if(m_Transform)
   {
     scale = m_Transform->getScale();
   }
@@ -480,20 +444,11 @@ void VSTransformWidget::updateScaleLabels()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateLocalTranslation()
 {
-  double* position;
-  double* origin;
-  if(nullptr == m_Transform)
-  {
-    position = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      position[i] = 0.0;
-    }
-  }
-  else
+  std::array<double, 3> position = {{0.0, 0.0, 0.0}};
+  if(m_Transform)
   {
     position = m_Transform->getLocalPosition();
-    double* origin = m_Transform->getOriginPosition();
+    std::array<double, 3> origin = m_Transform->getOriginPosition();
     for(int i = 0; i < 3; i++)
     {
       position[i] -= origin[i];
@@ -510,16 +465,8 @@ void VSTransformWidget::updateLocalTranslation()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateLocalRotation()
 {
-  double* rotation;
-  if(nullptr == m_Transform)
-  {
-    rotation = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      rotation[i] = 0.0;
-    }
-  }
-  else
+  std::array<double, 3> rotation = {{0.0, 0.0, 0.0}};
+  if(m_Transform)
   {
     rotation = m_Transform->getLocalRotation();
   }
@@ -534,25 +481,14 @@ void VSTransformWidget::updateLocalRotation()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateLocalScale()
 {
-  double* scale;
-  if(nullptr == m_Transform)
-  {
-    scale = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      scale[i] = 0.0;
-    }
-  }
-  else
+  std::array<double, 3> scale = {{0.0, 0.0, 0.0}};
+  if(m_Transform)
   {
     scale = m_Transform->getLocalScale();
-    double* originScale = m_Transform->getOriginScale();
-    if(originScale != nullptr)
+    std::array<double, 3> originScale = m_Transform->getOriginScale();
+    for(int i = 0; i < 3; i++)
     {
-      for(int i = 0; i < 3; i++)
-      {
-        scale[i] /= originScale[i];
-      }
+      scale[i] /= originScale[i];
     }
   }
 
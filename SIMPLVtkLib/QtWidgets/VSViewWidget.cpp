@@ -63,6 +63,7 @@ VSViewWidget::VSViewWidget(QWidget* parent, Qt::WindowFlags windowFlags)
   m_Internals->setupUi(this);
   m_Internals->visualizationWidget->setInteractorStyle(m_InteractorStyle);
   m_InteractorStyle->setViewWidget(this);
+  m_TextureLevelController = new VSTextureLevelController(this);
 
   setupGui();
 }
@@ -78,6 +79,7 @@ VSViewWidget::VSViewWidget(const VSViewWidget& other)
   m_Internals->setupUi(this);
   m_Internals->visualizationWidget->setInteractorStyle(m_InteractorStyle);
   m_InteractorStyle->setViewWidget(this);
+  m_TextureLevelController = new VSTextureLevelController(this);
 
   copyFilters(*other.getFilterViewModel());
   getVisualizationWidget()->copy(other.getVisualizationWidget());
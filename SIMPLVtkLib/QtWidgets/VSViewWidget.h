@@ -37,6 +37,7 @@
 
 #include "SIMPLVtkLib/QtWidgets/VSAbstractViewWidget.h"
 #include "SIMPLVtkLib/QtWidgets/VSInteractorStyleFilterCamera.h"
+#include "SIMPLVtkLib/QtWidgets/VSTextureLevelController.h"
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 /**
@@ -160,4 +161,5 @@ private:
   class VSInternals;
   VSInternals* m_Internals;
   VSInteractorStyleFilterCamera* m_InteractorStyle;
+  VSTextureLevelController* m_TextureLevelController = nullptr;
 };
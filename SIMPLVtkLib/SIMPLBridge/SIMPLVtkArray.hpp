@@ -32,25 +32,95 @@
  *    United States Prime Contract Navy N00173-07-C-2068
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-
 #ifndef _simplvtkarray_h_
 #define _simplvtkarray_h_
 
-#include "vtkGenericDataArray.h"
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <vtkGenericDataArray.h>
+#include <vtkObjectFactory.h>
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
 
-template <class T> class SIMPLVtkArray : public vtkGenericDataArray<SIMPLVtkArray<T>>, T >
+/**
+ * @class SIMPLVtkArray SIMPLVtkArray.hpp SIMPLVtkLib/SIMPLBridge/SIMPLVtkArray.hpp
+ * @brief This class exposes a SIMPLib DataArray to VTK as a vtkGenericDataArray
+ * without copying the data.  The adaptor holds a shared pointer to the DataArray
+ * so the wrapped memory stays valid for as long as VTK references the array,
+ * and all access goes through the DataArray so resizing it on the SIMPLib side
+ * does not leave VTK with a dangling pointer.  VTK never resizes a wrapped DataArray.
+ *
+ * SIMPLValueT is the type stored by the DataArray while ValueT is the type
+ * reported to VTK.  These only differ for bool arrays, which are exposed as
+ * unsigned char because VTK has no boolean array type.
+ *
+ * This is neither a vtkAOSDataArrayTemplate nor a vtkSOADataArrayTemplate, so
+ * vtkArrayDispatch workers compiled for those array types do not match it and
+ * take their generic vtkDataArray fallback.  Only code that reads the memory
+ * through GetVoidPointer avoids the per-value virtual access.
+ */
+template <typename SIMPLValueT, typename ValueT = SIMPLValueT> class SIMPLVtkArray : public vtkGenericDataArray<SIMPLVtkArray<SIMPLValueT, ValueT>, ValueT>
 {
+  using GenericDataArrayType = vtkGenericDataArray<SIMPLVtkArray<SIMPLValueT, ValueT>, ValueT>;
+  static_assert(sizeof(SIMPLValueT) == sizeof(ValueT), "SIMPLVtkArray requires matching value sizes");
+
 public:
+  using SelfType = SIMPLVtkArray<SIMPLValueT, ValueT>;
+  using DataArrayType = DataArray<SIMPLValueT>;
+  vtkTemplateTypeMacro(SelfType, GenericDataArrayType)
+  using ValueType = typename Superclass::ValueType;
+
   /**
-   * @brief Constructor
+   * @brief Creates a new SIMPLVtkArray without a DataArray.  A DataArray is
+   * created when tuples are first allocated.
+   * @return
+   */
+  static SIMPLVtkArray* New()
+  {
+    VTK_STANDARD_NEW_BODY(SelfType);
+  }
+
+  /**
+   * @brief Sets the DataArray to wrap and updates the array dimensions to match.
+   * The wrapped DataArray is never resized by VTK.
    * @param dataArray
    */
-  SIMPLVtkArray(DataArray<T>::Pointer dataArray)
-  : vtkGenericDataArray<SIMPLVtkArray<T>, T>()
-  , m_DataArray(dataArray)
+  void SetDataArray(typename DataArrayType::Pointer dataArray)
   {
+    m_DataArray = dataArray;
+    m_OwnsDataArray = false;
+    UpdateDimensions();
+    this->Modified();
+  }
+
+  /**
+   * @brief Returns the wrapped DataArray
+   * @return
+   */
+  typename DataArrayType::Pointer GetDataArray() const
+  {
+    return m_DataArray;
+  }
+
+  /**
+   * @brief Updates the number of components and tuples from the wrapped DataArray.
+   * This should be called after the DataArray is resized outside of VTK.
+   */
+  void UpdateDimensions()
+  {
+    if(nullptr == m_DataArray)
+    {
+      this->Size = 0;
+      this->MaxId = -1;
+      return;
+    }
+
+    this->NumberOfComponents = m_DataArray->getNumberOfComponents();
+    this->Size = static_cast<vtkIdType>(m_DataArray->getSize());
+    this->MaxId = this->Size - 1;
+    this->DataChanged();
   }
 
   /**
@@ -58,9 +128,9 @@ public:
    * @param valueIdx
    * @return
    */
-  inline T GetValue(vtkIdType valueIdx) const
+  inline ValueType GetValue(vtkIdType valueIdx) const
   {
-    return m_DataArray->getValue(valueIdx);
+    return static_cast<ValueType>(m_DataArray->getValue(valueIdx));
   }
 
   /**
@@ -68,29 +138,31 @@ public:
    * @param valueIdx
    * @param value
    */
-  inline void SetValue(vtkIdType valueIdx, T value)
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
   {
-    m_DataArray->setValue(valueIdx, value);
+    m_DataArray->setValue(valueIdx, static_cast<SIMPLValueT>(value));
   }
 
   /**
-   * @brief Copies the tuple pointer for the given index
+   * @brief Copies the tuple at the given index into the provided buffer
    * @param tupleIdx
    * @param tuple
    */
-  inline void GetTypedTuple(vtkIdType tupleIdx, T* tuple)
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
   {
-    tuple = m_DataArray->getTuplePointer(tupleIdx);
+    const SIMPLValueT* values = m_DataArray->getTuplePointer(tupleIdx);
+    std::transform(values, values + this->NumberOfComponents, tuple, [](SIMPLValueT value) { return static_cast<ValueType>(value); });
   }
 
   /**
-   * @brief Sets the tuple pointer for the given index
+   * @brief Copies the provided buffer into the tuple at the given index
    * @param tupleIdx
    * @param tuple
    */
-  inline void SetTypedTuple(vtkIdType tupleIdx, const T* tuple)
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
   {
-    m_DataArray->initializeTuple(tupleIdx, tuple);
+    SIMPLValueT* values = m_DataArray->getTuplePointer(tupleIdx);
+    std::transform(tuple, tuple + this->NumberOfComponents, values, [](ValueType value) { return static_cast<SIMPLValueT>(value); });
   }
 
   /**
@@ -99,9 +171,9 @@ public:
    * @param compIdx
    * @return
    */
-  inline T GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
   {
-    return m_DataArray->getComponent(tupleIdx, compIdx);
+    return static_cast<ValueType>(m_DataArray->getComponent(tupleIdx, compIdx));
   }
 
   /**
@@ -110,34 +182,95 @@ public:
    * @param compIdx
    * @param value
    */
-  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, T value)
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
   {
-    m_DataArray->setComponent(tupleIdx, compIdx, value);
+    m_DataArray->setComponent(tupleIdx, compIdx, static_cast<SIMPLValueT>(value));
+  }
+
+  /**
+   * @brief SIMPLib stores tuples contiguously in the same layout as vtkAOSDataArrayTemplate
+   * @return
+   */
+  bool HasStandardMemoryLayout() const override
+  {
+    return true;
+  }
+
+  /**
+   * @brief Returns a pointer to the wrapped DataArray memory starting at the given value
+   * @param valueIdx
+   * @return
+   */
+  void* GetVoidPointer(vtkIdType valueIdx) override
+  {
+    if(nullptr == m_DataArray)
+    {
+      return nullptr;
+    }
+
+    return m_DataArray->getVoidPointer(valueIdx);
   }
 
 protected:
   /**
-   * @brief Allocates space for a given number of tuples. Old data should not be preserved
+   * @brief Constructor
+   */
+  SIMPLVtkArray() = default;
+
+  /**
+   * @brief Deconstructor
+   */
+  ~SIMPLVtkArray() override = default;
+
+  /**
+   * @brief Allocates space for a given number of tuples. Old data should not be preserved.
+   * A wrapped DataArray is replaced by a new DataArray rather than resized.
    * @param numTuples
    * @return
    */
-  inline bool AllocateTuples(vtkIdType numTuples)
+  bool AllocateTuples(vtkIdType numTuples)
   {
-    m_DataArray->resize(numTuples);
+    if(nullptr == m_DataArray || !m_OwnsDataArray || m_DataArray->getNumberOfComponents() != this->NumberOfComponents)
+    {
+      std::vector<size_t> cDims(1, static_cast<size_t>(this->NumberOfComponents));
+      const char* name = this->GetName();
+      m_DataArray = DataArrayType::CreateArray(static_cast<size_t>(numTuples), cDims, name ? QString(name) : QString(), true);
+      m_OwnsDataArray = true;
+      return nullptr != m_DataArray;
+    }
+
+    return ReallocateTuples(numTuples);
   }
 
   /**
-   * @brief Allocates space for a given number of tuples.  Old data should be preserved
+   * @brief Allocates space for a given number of tuples.  Old data should be preserved.
+   * A wrapped DataArray belongs to SIMPLib and is only accepted at its current size.
    * @param numTuples
    * @return
    */
-  inline bool ReallocateTuples(vtkIdType numTuples)
+  bool ReallocateTuples(vtkIdType numTuples)
   {
-    m_DataArray->resize(numTuples);
+    if(nullptr == m_DataArray)
+    {
+      return AllocateTuples(numTuples);
+    }
+
+    if(!m_OwnsDataArray)
+    {
+      return static_cast<size_t>(numTuples) == m_DataArray->getNumberOfTuples();
+    }
+
+    return m_DataArray->resizeTuples(static_cast<size_t>(numTuples)) > 0;
   }
 
+  friend GenericDataArrayType;
+
 private:
-  DataArray<T>::Pointer m_DataArray;
+  typename DataArrayType::Pointer m_DataArray = nullptr;
+  bool m_OwnsDataArray = false;
+
+  SIMPLVtkArray(const SIMPLVtkArray&) = delete; // Copy Constructor Not Implemented
+  void operator=(const SIMPLVtkArray&) = delete; // Copy Assignment Not Implemented
 };
 
 #endif
@@ -35,13 +35,24 @@
 
 #include "SIMPLVtkBridge.h"
 
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <vtkCellArray.h>
 #include <vtkCellData.h>
+#include <vtkCellType.h>
 #include <vtkCellDataToPointData.h>
 #include <vtkCharArray.h>
 #include <vtkColorTransferFunction.h>
 #include <vtkDataArray.h>
 #include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
 #include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkImageData.h>
 #include <vtkIntArray.h>
 #include <vtkLine.h>
@@ -54,18 +65,23 @@
 #include <vtkPolyData.h>
 #include <vtkPolygon.h>
 #include <vtkRectilinearGrid.h>
+#include <vtkSMPTools.h>
 #include <vtkScalarBarActor.h>
 #include <vtkScalarBarWidget.h>
 #include <vtkShortArray.h>
 #include <vtkStructuredPoints.h>
 #include <vtkTextProperty.h>
+#include <vtkTypeInt64Array.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedIntArray.h>
 #include <vtkUnsignedLongLongArray.h>
 #include <vtkUnsignedShortArray.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkVersionMacros.h>
 #include <vtkVertexGlyphFilter.h>
+#include <vtkWeakPointer.h>
 
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSQuadGeom.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h"
@@ -81,6 +97,260 @@ namespace
 {
 const AttributeMatrix::Types CellTypes = {AttributeMatrix::Type::Cell, AttributeMatrix::Type::Face, AttributeMatrix::Type::Edge};
 const AttributeMatrix::Types PointTypes = {AttributeMatrix::Type::Vertex};
+
+/**
+ * @brief Returns whether unstructured geometries use native cell arrays before
+ * SIMPLVtkBridge::SetNativeCellArraysEnabled is called.  Native cell arrays only share
+ * SIMPLib's element lists with the offsets/connectivity layout introduced in VTK 9.
+ * Older versions copy the connectivity into the legacy layout, roughly doubling the
+ * memory of each mesh, so the mapped VS*Geom grids remain the default there.  Setting
+ * the SIMPLVtkLib_NATIVE_CELL_ARRAYS environment variable to 1 or 0 overrides the
+ * default for either version.
+ * @return
+ */
+bool DefaultNativeCellArraysEnabled()
+{
+  QByteArray value = qgetenv("SIMPLVtkLib_NATIVE_CELL_ARRAYS");
+  if(false == value.isEmpty())
+  {
+    return value != "0";
+  }
+
+#if VTK_MAJOR_VERSION >= 9
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::atomic<bool> NativeCellArraysEnabled(DefaultNativeCellArraysEnabled());
+
+#if VTK_MAJOR_VERSION >= 9
+/**
+ * @brief Fills the offsets and, when the SIMPLib element list cannot be shared,
+ * the connectivity of a vtkCellArray for cells of a single size.
+ */
+class NativeCellArrayFunctor
+{
+public:
+  NativeCellArrayFunctor(const MeshIndexType* elements, int cellSize, vtkTypeInt64* offsets, vtkTypeInt64* connectivity)
+  : m_Elements(elements)
+  , m_CellSize(cellSize)
+  , m_Offsets(offsets)
+  , m_Connectivity(connectivity)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    for(vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      const vtkTypeInt64 offset = static_cast<vtkTypeInt64>(cellId) * m_CellSize;
+      m_Offsets[cellId] = offset;
+      if(nullptr == m_Connectivity)
+      {
+        continue;
+      }
+      for(int i = 0; i < m_CellSize; i++)
+      {
+        m_Connectivity[offset + i] = m_Elements ? static_cast<vtkTypeInt64>(m_Elements[offset + i]) : static_cast<vtkTypeInt64>(cellId);
+      }
+    }
+  }
+
+private:
+  const MeshIndexType* m_Elements;
+  int m_CellSize;
+  vtkTypeInt64* m_Offsets;
+  vtkTypeInt64* m_Connectivity;
+};
+#else
+/**
+ * @brief Converts a SIMPLib element list to the legacy vtkCellArray layout where
+ * every cell is prefixed by its point count.  Cell locations and types are filled
+ * in the same pass.
+ */
+class NativeCellArrayFunctor
+{
+public:
+  NativeCellArrayFunctor(const MeshIndexType* elements, int cellSize, unsigned char cellType, vtkIdType* cellArray, vtkIdType* locations, unsigned char* types)
+  : m_Elements(elements)
+  , m_CellSize(cellSize)
+  , m_CellType(cellType)
+  , m_CellArray(cellArray)
+  , m_Locations(locations)
+  , m_Types(types)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    const vtkIdType stride = m_CellSize + 1;
+    for(vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      vtkIdType* cell = m_CellArray + cellId * stride;
+      const MeshIndexType* element = m_Elements ? m_Elements + cellId * m_CellSize : nullptr;
+      cell[0] = m_CellSize;
+      for(int i = 0; i < m_CellSize; i++)
+      {
+        cell[i + 1] = element ? static_cast<vtkIdType>(element[i]) : cellId;
+      }
+      m_Locations[cellId] = cellId * stride;
+      m_Types[cellId] = m_CellType;
+    }
+  }
+
+private:
+  const MeshIndexType* m_Elements;
+  int m_CellSize;
+  unsigned char m_CellType;
+  vtkIdType* m_CellArray;
+  vtkIdType* m_Locations;
+  unsigned char* m_Types;
+};
+#endif
+
+/**
+ * @brief Averages the cell values surrounding each point of a vtkImageData.
+ * Each point is written by exactly one thread so the functor can be run
+ * through vtkSMPTools without any locking.
+ */
+template <typename T> class ImageCellToPointFunctor
+{
+public:
+  ImageCellToPointFunctor(const T* cellValues, T* pointValues, const int pointDims[3], int numComps)
+  : m_CellValues(cellValues)
+  , m_PointValues(pointValues)
+  , m_NumComps(numComps)
+  {
+    for(int i = 0; i < 3; i++)
+    {
+      m_PointDims[i] = pointDims[i];
+      m_CellDims[i] = pointDims[i] > 1 ? pointDims[i] - 1 : 1;
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    std::vector<double> sum(m_NumComps);
+    const vtkIdType pointSliceSize = static_cast<vtkIdType>(m_PointDims[0]) * m_PointDims[1];
+    const vtkIdType cellSliceSize = static_cast<vtkIdType>(m_CellDims[0]) * m_CellDims[1];
+
+    for(vtkIdType ptId = begin; ptId < end; ptId++)
+    {
+      int ijk[3];
+      ijk[0] = static_cast<int>(ptId % m_PointDims[0]);
+      ijk[1] = static_cast<int>((ptId / m_PointDims[0]) % m_PointDims[1]);
+      ijk[2] = static_cast<int>(ptId / pointSliceSize);
+
+      int minIjk[3];
+      int maxIjk[3];
+      for(int i = 0; i < 3; i++)
+      {
+        minIjk[i] = std::max(ijk[i] - 1, 0);
+        maxIjk[i] = std::min(ijk[i], m_CellDims[i] - 1);
+      }
+
+      std::fill(sum.begin(), sum.end(), 0.0);
+      int count = 0;
+      for(int k = minIjk[2]; k <= maxIjk[2]; k++)
+      {
+        for(int j = minIjk[1]; j <= maxIjk[1]; j++)
+        {
+          for(int i = minIjk[0]; i <= maxIjk[0]; i++)
+          {
+            vtkIdType cellId = k * cellSliceSize + static_cast<vtkIdType>(j) * m_CellDims[0] + i;
+            const T* cellTuple = m_CellValues + cellId * m_NumComps;
+            for(int comp = 0; comp < m_NumComps; comp++)
+            {
+              sum[comp] += static_cast<double>(cellTuple[comp]);
+            }
+            count++;
+          }
+        }
+      }
+
+      T* pointTuple = m_PointValues + ptId * m_NumComps;
+      for(int comp = 0; comp < m_NumComps; comp++)
+      {
+        pointTuple[comp] = static_cast<T>(sum[comp] / count);
+      }
+    }
+  }
+
+private:
+  const T* m_CellValues;
+  T* m_PointValues;
+  int m_PointDims[3];
+  int m_CellDims[3];
+  int m_NumComps;
+};
+
+/**
+ * @brief Stores a point array generated from a cell array.  The entry is only valid
+ * while the cell array is unmodified and the vtkDataSet has the same structure.
+ */
+struct PointArrayCacheEntry
+{
+  vtkWeakPointer<vtkDataArray> m_CellArray;
+  vtkWeakPointer<vtkDataSet> m_DataSet;
+  vtkMTimeType m_CellArrayMTime = 0;
+  vtkIdType m_NumPoints = 0;
+  VTK_PTR(vtkDataArray) m_PointArray;
+  size_t m_MemorySize = 0;
+};
+
+const size_t DefaultPointArrayCacheMemoryBudget = 1024 * 1024 * 1024;
+
+std::mutex PointArrayCacheMutex;
+std::map<const vtkDataArray*, PointArrayCacheEntry> PointArrayCache;
+std::list<const vtkDataArray*> PointArrayUsageOrder;
+size_t PointArrayCacheMemoryUsage = 0;
+size_t PointArrayCacheMemoryBudget = DefaultPointArrayCacheMemoryBudget;
+
+/**
+ * @brief Removes the cached point array for the given cell array.  PointArrayCacheMutex
+ * must be locked by the caller.
+ * @param key
+ */
+void removePointArrayEntry(const vtkDataArray* key)
+{
+  auto iter = PointArrayCache.find(key);
+  if(iter == PointArrayCache.end())
+  {
+    return;
+  }
+
+  PointArrayCacheMemoryUsage -= iter->second.m_MemorySize;
+  PointArrayUsageOrder.remove(key);
+  PointArrayCache.erase(iter);
+}
+
+/**
+ * @brief Removes the point arrays of deleted cell arrays or datasets and evicts the least
+ * recently used point arrays until the cache fits its budget.  The most recently used
+ * point array is never evicted.  PointArrayCacheMutex must be locked by the caller.
+ */
+void evictPointArraysToBudget()
+{
+  std::vector<const vtkDataArray*> expiredKeys;
+  for(const auto& entry : PointArrayCache)
+  {
+    if(nullptr == entry.second.m_CellArray.GetPointer() || nullptr == entry.second.m_DataSet.GetPointer())
+    {
+      expiredKeys.push_back(entry.first);
+    }
+  }
+  for(const vtkDataArray* key : expiredKeys)
+  {
+    removePointArrayEntry(key);
+  }
+
+  while(PointArrayCacheMemoryUsage > PointArrayCacheMemoryBudget && PointArrayUsageOrder.size() > 1)
+  {
+    removePointArrayEntry(PointArrayUsageOrder.back());
+  }
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -162,39 +432,8 @@ SIMPLVtkBridge::WrappedDataContainerPtr SIMPLVtkBridge::WrapDataContainerAsStruc
           cellData->AddArray(wrappedCellData->m_VtkArray);
         }
 
-        // Create point data from cell data
-        VTK_NEW(vtkCellDataToPointData, cell2Point);
-        cell2Point->SetInputData(dataSet);
-        cell2Point->PassCellDataOn();
-        cell2Point->Update();
-
-        VTK_PTR(vtkDataSet) pointDataSet = nullptr;
-        switch(dataSet->GetDataObjectType())
-        {
-        case VTK_IMAGE_DATA:
-          pointDataSet = cell2Point->GetImageDataOutput();
-          break;
-        case VTK_STRUCTURED_GRID:
-          pointDataSet = cell2Point->GetUnstructuredGridOutput();
-          break;
-        case VTK_RECTILINEAR_GRID:
-          pointDataSet = cell2Point->GetRectilinearGridOutput();
-          break;
-        case VTK_STRUCTURED_POINTS:
-          pointDataSet = cell2Point->GetStructuredPointsOutput();
-          break;
-        case VTK_UNSTRUCTURED_GRID:
-          pointDataSet = cell2Point->GetUnstructuredGridOutput();
-          break;
-        case VTK_POLY_DATA:
-          pointDataSet = cell2Point->GetPolyDataOutput();
-          break;
-        default:
-          pointDataSet = cell2Point->GetOutput();
-          break;
-        }
-
-        dataSet->DeepCopy(pointDataSet);
+        // Point data is generated on demand through GeneratePointArray so the
+        // wrapped cell arrays are never duplicated during import.
       }
       // Wrap Vertex data
       else if(AttributeMatrix::Type::Vertex == (*attrMat)->getType())
@@ -246,6 +485,8 @@ SIMPLVtkBridge::WrappedDataContainerPtr SIMPLVtkBridge::WrapGeometryPtr(DataCont
   {
     return nullptr;
   }
+  VS_TRACE_NAMED_SCOPE(traceScope, "Import", "Wrap Geometry");
+  VS_TRACE_DETAIL(traceScope, dc->getName());
   VTK_PTR(vtkDataSet) dataSet = WrapGeometry(dc->getGeometry());
   if(!dataSet)
   {
@@ -253,6 +494,7 @@ SIMPLVtkBridge::WrappedDataContainerPtr SIMPLVtkBridge::WrapGeometryPtr(DataCont
   }
   else
   {
+    VS_TRACE_BYTES(traceScope, static_cast<qint64>(dataSet->GetActualMemorySize()) * 1024);
     WrappedDataContainerPtr wrappedDcStruct(new WrappedDataContainer());
     wrappedDcStruct->m_DataSet = dataSet;
     wrappedDcStruct->m_DataContainer = dc;
@@ -264,6 +506,158 @@ SIMPLVtkBridge::WrappedDataContainerPtr SIMPLVtkBridge::WrapGeometryPtr(DataCont
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataArray) SIMPLVtkBridge::GeneratePointArray(vtkDataSet* dataSet, const QString& arrayName)
+{
+  if(nullptr == dataSet)
+  {
+    return nullptr;
+  }
+
+  vtkDataArray* cellArray = dataSet->GetCellData()->GetArray(qPrintable(arrayName));
+  if(nullptr == cellArray)
+  {
+    return nullptr;
+  }
+
+  // Point arrays are generated once until the cell array is modified
+  {
+    std::lock_guard<std::mutex> lock(::PointArrayCacheMutex);
+    ::evictPointArraysToBudget();
+
+    auto iter = ::PointArrayCache.find(cellArray);
+    if(iter != ::PointArrayCache.end())
+    {
+      const PointArrayCacheEntry& entry = iter->second;
+      if(entry.m_DataSet.GetPointer() == dataSet && entry.m_CellArrayMTime == cellArray->GetMTime() && entry.m_NumPoints == dataSet->GetNumberOfPoints())
+      {
+        ::PointArrayUsageOrder.remove(cellArray);
+        ::PointArrayUsageOrder.push_front(cellArray);
+        return entry.m_PointArray;
+      }
+    }
+  }
+
+  VS_TRACE_NAMED_SCOPE(traceScope, "Import", "Generate Point Array");
+  VS_TRACE_DETAIL(traceScope, arrayName);
+  VTK_PTR(vtkDataArray) pointArray = nullptr;
+  vtkImageData* imageData = vtkImageData::SafeDownCast(dataSet);
+  if(imageData)
+  {
+    // Structured fast path reading the wrapped SIMPL memory directly
+    int numComps = cellArray->GetNumberOfComponents();
+    vtkIdType numPoints = imageData->GetNumberOfPoints();
+
+    pointArray = VTK_PTR(vtkDataArray)::Take(cellArray->NewInstance());
+    pointArray->SetName(cellArray->GetName());
+    pointArray->SetNumberOfComponents(numComps);
+    pointArray->SetNumberOfTuples(numPoints);
+    for(int i = 0; i < numComps; i++)
+    {
+      if(cellArray->GetComponentName(i))
+      {
+        pointArray->SetComponentName(i, cellArray->GetComponentName(i));
+      }
+    }
+
+    int pointDims[3];
+    imageData->GetDimensions(pointDims);
+
+    switch(cellArray->GetDataType())
+    {
+      vtkTemplateMacro(ImageCellToPointFunctor<VTK_TT> functor(static_cast<VTK_TT*>(cellArray->GetVoidPointer(0)), static_cast<VTK_TT*>(pointArray->GetVoidPointer(0)), pointDims, numComps);
+                       vtkSMPTools::For(0, numPoints, functor));
+    default:
+      return nullptr;
+    }
+  }
+  else
+  {
+    // Convert only the requested array using a shallow structure copy
+    VTK_PTR(vtkDataSet) arrayDataSet = VTK_PTR(vtkDataSet)::Take(dataSet->NewInstance());
+    arrayDataSet->CopyStructure(dataSet);
+    arrayDataSet->GetCellData()->AddArray(cellArray);
+
+    VTK_NEW(vtkCellDataToPointData, cell2Point);
+    cell2Point->SetInputData(arrayDataSet);
+    cell2Point->PassCellDataOff();
+    cell2Point->Update();
+
+    pointArray = cell2Point->GetOutput()->GetPointData()->GetArray(qPrintable(arrayName));
+    if(nullptr == pointArray)
+    {
+      return nullptr;
+    }
+  }
+
+  size_t memorySize = static_cast<size_t>(pointArray->GetActualMemorySize()) * 1024;
+  VS_TRACE_BYTES(traceScope, static_cast<qint64>(memorySize));
+
+  PointArrayCacheEntry entry;
+  entry.m_CellArray = cellArray;
+  entry.m_DataSet = dataSet;
+  entry.m_CellArrayMTime = cellArray->GetMTime();
+  entry.m_NumPoints = dataSet->GetNumberOfPoints();
+  entry.m_PointArray = pointArray;
+  entry.m_MemorySize = memorySize;
+
+  std::lock_guard<std::mutex> lock(::PointArrayCacheMutex);
+  ::removePointArrayEntry(cellArray);
+  ::PointArrayCache[cellArray] = entry;
+  ::PointArrayUsageOrder.push_front(cellArray);
+  ::PointArrayCacheMemoryUsage += memorySize;
+  ::evictPointArraysToBudget();
+  return pointArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t SIMPLVtkBridge::GetPointArrayCacheMemoryBudget()
+{
+  std::lock_guard<std::mutex> lock(::PointArrayCacheMutex);
+  return ::PointArrayCacheMemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::SetPointArrayCacheMemoryBudget(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(::PointArrayCacheMutex);
+  ::PointArrayCacheMemoryBudget = bytes;
+  ::evictPointArraysToBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::ClearPointArrayCache()
+{
+  std::lock_guard<std::mutex> lock(::PointArrayCacheMutex);
+  ::PointArrayCache.clear();
+  ::PointArrayUsageOrder.clear();
+  ::PointArrayCacheMemoryUsage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLVtkBridge::GetNativeCellArraysEnabled()
+{
+  return ::NativeCellArraysEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::SetNativeCellArraysEnabled(bool enabled)
+{
+  ::NativeCellArraysEnabled = enabled;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -455,6 +849,9 @@ void SIMPLVtkBridge::FinishWrappingDataContainerStruct(WrappedDataContainerPtr w
     return;
   }
 
+  VS_TRACE_NAMED_SCOPE(traceScope, "Import", "Finish Wrapping DataContainer");
+  VS_TRACE_DETAIL(traceScope, wrappedDcStruct->m_Name);
+
   VTK_PTR(vtkDataSet) dataSet = wrappedDcStruct->m_DataSet;
   wrappedDcStruct->m_CellData.clear();
   wrappedDcStruct->m_PointData.clear();
@@ -545,6 +942,7 @@ void SIMPLVtkBridge::FinishWrappingDataContainerStruct(WrappedDataContainerPtr w
     }
   }
   pointData->Update();
+  VS_TRACE_BYTES(traceScope, static_cast<qint64>(dataSet->GetActualMemorySize()) * 1024);
 
   // Set the active cell / point data scalars
   if(pointData->GetNumberOfArrays() > 0)
@@ -634,11 +1032,9 @@ SIMPLVtkBridge::WrappedDataArrayPtr SIMPLVtkBridge::WrapIDataArrayAsStruct(IData
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataArray) SIMPLVtkBridge::WrapVertices(SharedVertexList::Pointer vertexArray)
 {
-  VTK_NEW(vtkFloatArray, vtkArray);
-  vtkArray->SetNumberOfComponents(vertexArray->getNumberOfComponents());
-  vtkArray->SetNumberOfTuples(vertexArray->getNumberOfTuples());
-
-  vtkArray->SetVoidArray(vertexArray->getVoidPointer(0), vertexArray->getSize(), 1);
+  VTK_NEW(SIMPLVtkArray<float>, vtkArray);
+  vtkArray->SetName(qPrintable(vertexArray->getName()));
+  vtkArray->SetDataArray(vertexArray);
 
   return vtkArray;
 }
@@ -648,6 +1044,11 @@ VTK_PTR(vtkDataArray) SIMPLVtkBridge::WrapVertices(SharedVertexList::Pointer ver
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(EdgeGeom::Pointer geom)
 {
+  if(GetNativeCellArraysEnabled())
+  {
+    return CreateNativeGrid(geom->getVertices(), geom->getEdges(), VTK_LINE, 2);
+  }
+
   VTK_NEW(VSEdgeGrid, dataSet);
   VSEdgeGeom* edgeGeom = dataSet->GetImplementation();
   edgeGeom->SetGeometry(geom);
@@ -666,6 +1067,11 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(EdgeGeom::Pointer geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(QuadGeom::Pointer geom)
 {
+  if(GetNativeCellArraysEnabled())
+  {
+    return CreateNativeGrid(geom->getVertices(), geom->getQuads(), VTK_QUAD, 4);
+  }
+
   VTK_NEW(VSQuadGrid, dataSet);
   VSQuadGeom* quadGeom = dataSet->GetImplementation();
   quadGeom->SetGeometry(geom);
@@ -709,6 +1115,11 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(RectGridGeom::Pointer geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(TetrahedralGeom::Pointer geom)
 {
+  if(GetNativeCellArraysEnabled())
+  {
+    return CreateNativeGrid(geom->getVertices(), geom->getTetrahedra(), VTK_TETRA, 4);
+  }
+
   VTK_NEW(VSTetrahedralGrid, dataSet);
   VSTetrahedralGeom* tetGeom = dataSet->GetImplementation();
   tetGeom->SetGeometry(geom);
@@ -727,6 +1138,11 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(TetrahedralGeom::Pointer geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(TriangleGeom::Pointer geom)
 {
+  if(GetNativeCellArraysEnabled())
+  {
+    return CreateNativeGrid(geom->getVertices(), geom->getTriangles(), VTK_TRIANGLE, 3);
+  }
+
   VTK_NEW(VtkTriangleGrid, dataSet);
   VSTriangleGeom* triGeom = dataSet->GetImplementation();
   triGeom->SetGeometry(geom);
@@ -745,6 +1161,11 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(TriangleGeom::Pointer geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(VertexGeom::Pointer geom)
 {
+  if(GetNativeCellArraysEnabled())
+  {
+    return CreateNativeGrid(geom->getVertices(), nullptr, VTK_VERTEX, 1);
+  }
+
   VTK_NEW(VSVertexGrid, dataSet);
   VSVertexGeom* vertGeom = dataSet->GetImplementation();
   vertGeom->SetGeometry(geom);
@@ -758,6 +1179,74 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(VertexGeom::Pointer geom)
   return dataSet;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) SIMPLVtkBridge::CreateNativeGrid(SharedVertexList::Pointer vertices, DataArray<MeshIndexType>::Pointer elements, int cellType, int cellSize)
+{
+  if(nullptr == vertices)
+  {
+    return nullptr;
+  }
+
+  vtkIdType numCells = static_cast<vtkIdType>(elements ? elements->getNumberOfTuples() : vertices->getNumberOfTuples());
+  const MeshIndexType* elementData = elements ? elements->getPointer(0) : nullptr;
+
+  VTK_NEW(vtkUnstructuredGrid, dataSet);
+
+  VTK_NEW(vtkPoints, points);
+  VTK_PTR(vtkDataArray) vertexArray = WrapVertices(vertices);
+  points->SetDataTypeToFloat();
+  points->SetData(vertexArray);
+  dataSet->SetPoints(points);
+
+  VTK_NEW(vtkCellArray, cells);
+#if VTK_MAJOR_VERSION >= 9
+  VTK_NEW(vtkTypeInt64Array, offsets);
+  offsets->SetNumberOfValues(numCells + 1);
+
+  // Element IDs never exceed the signed range, so matching index widths can be read in place
+  VTK_NEW(vtkTypeInt64Array, connectivity);
+  bool shareElements = (nullptr != elementData) && (sizeof(MeshIndexType) == sizeof(vtkTypeInt64));
+  if(shareElements)
+  {
+    connectivity->SetArray(reinterpret_cast<vtkTypeInt64*>(const_cast<MeshIndexType*>(elementData)), numCells * cellSize, 1);
+
+    // The wrapped element list in the field data keeps the shared memory alive for
+    // as long as the grid or any shallow copy of it exists.
+    VTK_PTR(vtkDataArray) elementHolder = WrapIDataArrayTemplate<MeshIndexType>(elements);
+    elementHolder->SetName("SIMPLElementList");
+    dataSet->GetFieldData()->AddArray(elementHolder);
+  }
+  else
+  {
+    connectivity->SetNumberOfValues(numCells * cellSize);
+  }
+
+  ::NativeCellArrayFunctor functor(elementData, cellSize, offsets->GetPointer(0), shareElements ? nullptr : connectivity->GetPointer(0));
+  vtkSMPTools::For(0, numCells, functor);
+  offsets->SetValue(numCells, static_cast<vtkTypeInt64>(numCells) * cellSize);
+
+  cells->SetData(offsets, connectivity);
+  dataSet->SetCells(cellType, cells);
+#else
+  VTK_NEW(vtkIdTypeArray, cellArray);
+  cellArray->SetNumberOfValues(numCells * (cellSize + 1));
+  VTK_NEW(vtkIdTypeArray, locations);
+  locations->SetNumberOfValues(numCells);
+  VTK_NEW(vtkUnsignedCharArray, types);
+  types->SetNumberOfValues(numCells);
+
+  ::NativeCellArrayFunctor functor(elementData, cellSize, static_cast<unsigned char>(cellType), cellArray->GetPointer(0), locations->GetPointer(0), types->GetPointer(0));
+  vtkSMPTools::For(0, numCells, functor);
+
+  cells->SetCells(numCells, cellArray);
+  dataSet->SetCells(types, locations, cells);
+#endif
+
+  return dataSet;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -821,43 +1310,47 @@ VTK_PTR(vtkDataArray) SIMPLVtkBridge::WrapIDataArray(IDataArray::Pointer array)
 {
   if(std::dynamic_pointer_cast<UInt8ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkUnsignedCharArray>(array);
+    return WrapIDataArrayTemplate<uint8_t>(array);
   }
   else if(std::dynamic_pointer_cast<Int8ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkCharArray>(array);
+    return WrapIDataArrayTemplate<int8_t>(array);
   }
   else if(std::dynamic_pointer_cast<UInt16ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkUnsignedShortArray>(array);
+    return WrapIDataArrayTemplate<uint16_t>(array);
   }
   else if(std::dynamic_pointer_cast<Int16ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkShortArray>(array);
+    return WrapIDataArrayTemplate<int16_t>(array);
   }
   else if(std::dynamic_pointer_cast<UInt32ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkUnsignedIntArray>(array);
+    return WrapIDataArrayTemplate<uint32_t>(array);
   }
   else if(std::dynamic_pointer_cast<Int32ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkIntArray>(array);
+    return WrapIDataArrayTemplate<int32_t>(array);
   }
   else if(std::dynamic_pointer_cast<UInt64ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkUnsignedLongLongArray>(array);
+    return WrapIDataArrayTemplate<uint64_t>(array);
   }
   else if(std::dynamic_pointer_cast<Int64ArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkLongLongArray>(array);
+    return WrapIDataArrayTemplate<int64_t>(array);
   }
   else if(std::dynamic_pointer_cast<FloatArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkFloatArray>(array);
+    return WrapIDataArrayTemplate<float>(array);
   }
   else if(std::dynamic_pointer_cast<DoubleArrayType>(array))
   {
-    return WrapIDataArrayTemplate<vtkDoubleArray>(array);
+    return WrapIDataArrayTemplate<double>(array);
+  }
+  else if(std::dynamic_pointer_cast<BoolArrayType>(array))
+  {
+    return WrapIDataArrayTemplate<bool, uint8_t>(array);
   }
   else
   {
@@ -865,6 +1358,34 @@ VTK_PTR(vtkDataArray) SIMPLVtkBridge::WrapIDataArray(IDataArray::Pointer array)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::SetComponentNames(vtkDataArray* vtkArray, const QString& arrayName, bool isCharArray, bool isFloatArray)
+{
+  int numComp = vtkArray->GetNumberOfComponents();
+  if(isCharArray && numComp == 3)
+  {
+    vtkArray->SetComponentName(0, qPrintable(arrayName + " R"));
+    vtkArray->SetComponentName(1, qPrintable(arrayName + " G"));
+    vtkArray->SetComponentName(2, qPrintable(arrayName + " B"));
+  }
+  else if(isFloatArray && numComp == 3)
+  {
+    vtkArray->SetComponentName(0, qPrintable(arrayName + " X"));
+    vtkArray->SetComponentName(1, qPrintable(arrayName + " Y"));
+    vtkArray->SetComponentName(2, qPrintable(arrayName + " Z"));
+  }
+  else
+  {
+    for(int i = 0; i < numComp; i++)
+    {
+      QString compName = arrayName + " Comp_" + QString::number(i + 1);
+      vtkArray->SetComponentName(i, qPrintable(compName));
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -910,6 +1431,10 @@ bool SIMPLVtkBridge::CanWrapDataArray(IDataArray::Pointer array)
   {
     return true;
   }
+  else if(std::dynamic_pointer_cast<BoolArrayType>(array))
+  {
+    return true;
+  }
   else
   {
     return false;
@@ -40,6 +40,7 @@
 #endif
 
 #include <string>
+#include <type_traits>
 
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
@@ -54,6 +55,7 @@
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 
+#include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkArray.hpp"
 #include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
@@ -158,6 +160,57 @@ public:
    */
   static WrappedDataArrayPtr WrapIDataArrayAsStruct(IDataArray::Pointer da);
 
+  /**
+   * @brief Generates point values for the named cell array of the given vtkDataSet.
+   * Wrapped cell data is no longer converted to point data during import, so this
+   * should be called whenever a filter or color mapping requires point values.
+   * vtkImageData is converted in parallel directly from the wrapped cell values.
+   * The vtkDataSet is not modified.  The generated array is cached until the cell
+   * array's MTime changes or it is evicted by the point array cache budget.
+   * @param dataSet
+   * @param arrayName
+   * @return
+   */
+  static VTK_PTR(vtkDataArray) GeneratePointArray(vtkDataSet* dataSet, const QString& arrayName);
+
+  /**
+   * @brief Returns the memory budget in bytes for point arrays cached by GeneratePointArray
+   * @return
+   */
+  static size_t GetPointArrayCacheMemoryBudget();
+
+  /**
+   * @brief Sets the memory budget in bytes for point arrays cached by GeneratePointArray.
+   * The least recently used point arrays are evicted until the cache fits.  Evicted
+   * arrays stay valid for the filters and mappers still using them.
+   * @param bytes
+   */
+  static void SetPointArrayCacheMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Removes every point array cached by GeneratePointArray
+   */
+  static void ClearPointArrayCache();
+
+  /**
+   * @brief Returns true if Vertex, Edge, Triangle, Quad, and Tetrahedral geometries are
+   * wrapped as vtkUnstructuredGrids with native cell arrays instead of mapped grids.
+   * @return
+   */
+  static bool GetNativeCellArraysEnabled();
+
+  /**
+   * @brief Sets whether unstructured geometries are wrapped with native cell arrays.
+   * Native cell arrays let VTK filters use their internal loops instead of calling
+   * GetCellPoints for every cell, at the cost of storing the connectivity in VTK's
+   * layout when it cannot be shared with SIMPLib.  Enabled by default with VTK 9 and
+   * later, where the element list can be shared in place.  VTK 8 copies every element
+   * list, so it is disabled there unless the SIMPLVtkLib_NATIVE_CELL_ARRAYS environment
+   * variable is set to 1.  Only geometries wrapped after the call are affected.
+   * @param enabled
+   */
+  static void SetNativeCellArraysEnabled(bool enabled);
+
   /**
    * @brief Creates and returns DataArrayImportSettings for the given array names
    * @param arrayNames
@@ -242,6 +295,19 @@ public:
    */
   static VTK_PTR(vtkDataArray) WrapVertices(SharedVertexList::Pointer vertexArray);
 
+  /**
+   * @brief Creates a vtkUnstructuredGrid using the wrapped vertices and a native vtkCellArray
+   * built from the SIMPLib element list.  With VTK 9 the element list is shared as the
+   * connectivity array when the index widths match.  Otherwise the connectivity is converted
+   * in parallel.  A nullptr element list creates one cell per vertex.
+   * @param vertices
+   * @param elements
+   * @param cellType
+   * @param cellSize
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) CreateNativeGrid(SharedVertexList::Pointer vertices, DataArray<MeshIndexType>::Pointer elements, int cellType, int cellSize);
+
   /**
    * @brief Creates and returns a vtkDataArray from SIMPLib's IDataArray
    * @param array
@@ -249,40 +315,31 @@ public:
    */
   static VTK_PTR(vtkDataArray) WrapIDataArray(IDataArray::Pointer array);
 
-  template <typename T> static VTK_PTR(T) WrapIDataArrayTemplate(IDataArray::Pointer array)
+  /**
+   * @brief Wraps a SIMPLib DataArray in a SIMPLVtkArray that shares ownership of the
+   * DataArray instead of borrowing a raw pointer to its memory.  Returns nullptr if
+   * the IDataArray is not a DataArray<SIMPLValueT>.
+   * @param array
+   * @return
+   */
+  template <typename SIMPLValueT, typename ValueT = SIMPLValueT> static VTK_PTR(vtkDataArray) WrapIDataArrayTemplate(IDataArray::Pointer array)
   {
-    VTK_NEW(T, vtkArray);
-    vtkArray->SetNumberOfComponents(array->getNumberOfComponents());
-    vtkArray->SetNumberOfTuples(array->getNumberOfTuples());
-
-    vtkArray->SetVoidArray(array->getVoidPointer(0), array->getSize(), 1);
+    using ArrayType = SIMPLVtkArray<SIMPLValueT, ValueT>;
 
-    int numComp = vtkArray->GetNumberOfComponents();
-    bool isCharArray = vtkArray->IsA("vtkUnsignedCharArray");
-    bool isFloatArray = vtkArray->IsA("vtkFloatArray");
-    if(isCharArray && numComp == 3)
+    typename DataArray<SIMPLValueT>::Pointer typedArray = std::dynamic_pointer_cast<DataArray<SIMPLValueT>>(array);
+    if(nullptr == typedArray)
     {
-      QString arrayName = array->getName();
-      vtkArray->SetComponentName(0, qPrintable(arrayName + " R"));
-      vtkArray->SetComponentName(1, qPrintable(arrayName + " G"));
-      vtkArray->SetComponentName(2, qPrintable(arrayName + " B"));
-    }
-    else if(isFloatArray && numComp == 3)
-    {
-      QString arrayName = array->getName();
-      vtkArray->SetComponentName(0, qPrintable(arrayName + " X"));
-      vtkArray->SetComponentName(1, qPrintable(arrayName + " Y"));
-      vtkArray->SetComponentName(2, qPrintable(arrayName + " Z"));
-    }
-    else
-    {
-      for(int i = 0; i < numComp; i++)
-      {
-        QString compName = array->getName() + " Comp_" + QString::number(i + 1);
-        vtkArray->SetComponentName(i, qPrintable(compName));
-      }
+      return nullptr;
     }
 
+    VTK_NEW(ArrayType, vtkArray);
+    vtkArray->SetName(qPrintable(array->getName()));
+    vtkArray->SetDataArray(typedArray);
+
+    bool isCharArray = std::is_same<SIMPLValueT, uint8_t>::value;
+    bool isFloatArray = std::is_same<SIMPLValueT, float>::value;
+    SetComponentNames(vtkArray, array->getName(), isCharArray, isFloatArray);
+
     return vtkArray;
   }
 
@@ -292,6 +349,16 @@ protected:
    */
   SIMPLVtkBridge();
 
+  /**
+   * @brief Sets the component names for a wrapped vtkDataArray.  Three component
+   * char arrays are named as RGB values and three component float arrays as XYZ values.
+   * @param vtkArray
+   * @param arrayName
+   * @param isCharArray
+   * @param isFloatArray
+   */
+  static void SetComponentNames(vtkDataArray* vtkArray, const QString& arrayName, bool isCharArray, bool isFloatArray);
+
   /**
    * @brief Appends the AttributeMatrix name to the wrapped DataArray names
    * @param wrappedArrays
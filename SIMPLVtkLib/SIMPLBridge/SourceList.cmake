@@ -1,7 +1,11 @@
 
 set(VS_SIMPLBridge_SRCS
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSHyperslabCropReader.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSQuadGeom.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTriangleGeom.cpp
@@ -9,9 +13,13 @@ set(VS_SIMPLBridge_SRCS
 )
 
 set(VS_SIMPLBridge_HDRS
-	#${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkArray.hpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkArray.hpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSHyperslabCropReader.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSQuadGeom.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTriangleGeom.h
@@ -0,0 +1,563 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSArrayStatisticsCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+
+namespace
+{
+// Fine enough for VSHistogram to merge into coarser fixed or adaptive bins
+const int DefaultNumberOfBins = 1024;
+
+/**
+ * @brief Computes the per-component ranges, magnitude range, and NaN counts of a
+ * contiguous array with one pass over the values
+ */
+template <typename T> class RangeFunctor
+{
+public:
+  RangeFunctor(const T* values, int numComps)
+  : m_Values(values)
+  , m_NumComps(numComps)
+  , m_Ranges(2 * (numComps + 1))
+  , m_NaNCounts(numComps + 1, 0)
+  {
+    resetRanges(m_Ranges);
+  }
+
+  void Initialize()
+  {
+    std::vector<double>& ranges = m_LocalRanges.Local();
+    ranges.resize(m_Ranges.size());
+    resetRanges(ranges);
+    m_LocalNaNCounts.Local().assign(m_NaNCounts.size(), 0);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<double>& ranges = m_LocalRanges.Local();
+    std::vector<vtkIdType>& nanCounts = m_LocalNaNCounts.Local();
+    double* magRange = ranges.data() + 2 * m_NumComps;
+
+    for(vtkIdType tuple = begin; tuple < end; tuple++)
+    {
+      const T* tupleValues = m_Values + tuple * m_NumComps;
+      double magnitude = 0.0;
+      bool validTuple = true;
+      for(int comp = 0; comp < m_NumComps; comp++)
+      {
+        double value = static_cast<double>(tupleValues[comp]);
+        if(std::isnan(value))
+        {
+          nanCounts[comp]++;
+          validTuple = false;
+          continue;
+        }
+
+        ranges[2 * comp] = std::min(ranges[2 * comp], value);
+        ranges[2 * comp + 1] = std::max(ranges[2 * comp + 1], value);
+        magnitude += value * value;
+      }
+
+      if(!validTuple)
+      {
+        nanCounts[m_NumComps]++;
+        continue;
+      }
+
+      magnitude = std::sqrt(magnitude);
+      magRange[0] = std::min(magRange[0], magnitude);
+      magRange[1] = std::max(magRange[1], magnitude);
+    }
+  }
+
+  void Reduce()
+  {
+    for(auto iter = m_LocalRanges.begin(); iter != m_LocalRanges.end(); ++iter)
+    {
+      for(size_t i = 0; i < m_Ranges.size(); i += 2)
+      {
+        m_Ranges[i] = std::min(m_Ranges[i], (*iter)[i]);
+        m_Ranges[i + 1] = std::max(m_Ranges[i + 1], (*iter)[i + 1]);
+      }
+    }
+
+    for(auto iter = m_LocalNaNCounts.begin(); iter != m_LocalNaNCounts.end(); ++iter)
+    {
+      for(size_t i = 0; i < m_NaNCounts.size(); i++)
+      {
+        m_NaNCounts[i] += (*iter)[i];
+      }
+    }
+
+    // Components without any valid values report an empty range
+    for(size_t i = 0; i < m_Ranges.size(); i += 2)
+    {
+      if(m_Ranges[i] > m_Ranges[i + 1])
+      {
+        m_Ranges[i] = 0.0;
+        m_Ranges[i + 1] = 0.0;
+      }
+    }
+  }
+
+  const std::vector<double>& getRanges() const
+  {
+    return m_Ranges;
+  }
+
+  const std::vector<vtkIdType>& getNaNCounts() const
+  {
+    return m_NaNCounts;
+  }
+
+private:
+  static void resetRanges(std::vector<double>& ranges)
+  {
+    for(size_t i = 0; i < ranges.size(); i += 2)
+    {
+      ranges[i] = std::numeric_limits<double>::max();
+      ranges[i + 1] = std::numeric_limits<double>::lowest();
+    }
+  }
+
+  const T* m_Values;
+  int m_NumComps;
+  std::vector<double> m_Ranges;
+  std::vector<vtkIdType> m_NaNCounts;
+  vtkSMPThreadLocal<std::vector<double>> m_LocalRanges;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> m_LocalNaNCounts;
+};
+
+/**
+ * @brief Bins each component and the tuple magnitude over the ranges computed by RangeFunctor
+ */
+template <typename T> class HistogramFunctor
+{
+public:
+  HistogramFunctor(const T* values, int numComps, const std::vector<double>& ranges, int numBins)
+  : m_Values(values)
+  , m_NumComps(numComps)
+  , m_NumBins(numBins)
+  , m_Ranges(ranges)
+  , m_Scales(numComps + 1)
+  , m_Counts((numComps + 1) * numBins, 0)
+  {
+    for(int i = 0; i <= numComps; i++)
+    {
+      double width = ranges[2 * i + 1] - ranges[2 * i];
+      m_Scales[i] = width > 0.0 ? numBins / width : 0.0;
+    }
+  }
+
+  void Initialize()
+  {
+    m_LocalCounts.Local().assign(m_Counts.size(), 0);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<vtkIdType>& counts = m_LocalCounts.Local();
+
+    for(vtkIdType tuple = begin; tuple < end; tuple++)
+    {
+      const T* tupleValues = m_Values + tuple * m_NumComps;
+      double magnitude = 0.0;
+      bool validTuple = true;
+      for(int comp = 0; comp < m_NumComps; comp++)
+      {
+        double value = static_cast<double>(tupleValues[comp]);
+        if(std::isnan(value))
+        {
+          validTuple = false;
+          continue;
+        }
+
+        counts[comp * m_NumBins + binIndex(comp, value)]++;
+        magnitude += value * value;
+      }
+
+      if(validTuple)
+      {
+        counts[m_NumComps * m_NumBins + binIndex(m_NumComps, std::sqrt(magnitude))]++;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for(auto iter = m_LocalCounts.begin(); iter != m_LocalCounts.end(); ++iter)
+    {
+      for(size_t i = 0; i < m_Counts.size(); i++)
+      {
+        m_Counts[i] += (*iter)[i];
+      }
+    }
+  }
+
+  const std::vector<vtkIdType>& getCounts() const
+  {
+    return m_Counts;
+  }
+
+private:
+  int binIndex(int comp, double value) const
+  {
+    int bin = static_cast<int>((value - m_Ranges[2 * comp]) * m_Scales[comp]);
+    return std::min(std::max(bin, 0), m_NumBins - 1);
+  }
+
+  const T* m_Values;
+  int m_NumComps;
+  int m_NumBins;
+  const std::vector<double>& m_Ranges;
+  std::vector<double> m_Scales;
+  std::vector<vtkIdType> m_Counts;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> m_LocalCounts;
+};
+
+/**
+ * @brief Computes the ranges and NaN counts for a typed array
+ * @param values
+ * @param numTuples
+ * @param numComps
+ * @param ranges
+ * @param nanCounts
+ */
+template <typename T> void computeRanges(const T* values, vtkIdType numTuples, int numComps, std::vector<double>& ranges, std::vector<vtkIdType>& nanCounts)
+{
+  RangeFunctor<T> rangeFunctor(values, numComps);
+  vtkSMPTools::For(0, numTuples, rangeFunctor);
+  ranges = rangeFunctor.getRanges();
+  nanCounts = rangeFunctor.getNaNCounts();
+}
+
+/**
+ * @brief Computes the histograms for a typed array over the given ranges
+ * @param values
+ * @param numTuples
+ * @param numComps
+ * @param numBins
+ * @param ranges
+ * @param counts
+ */
+template <typename T> void computeCounts(const T* values, vtkIdType numTuples, int numComps, int numBins, const std::vector<double>& ranges, std::vector<vtkIdType>& counts)
+{
+  HistogramFunctor<T> histogramFunctor(values, numComps, ranges, numBins);
+  vtkSMPTools::For(0, numTuples, histogramFunctor);
+  counts = histogramFunctor.getCounts();
+}
+
+/**
+ * @brief Computes the histograms of arrays without a contiguous typed buffer, such as
+ * vtkBitArray, through the generic vtkDataArray interface
+ * @param array
+ * @param numComps
+ * @param numBins
+ * @param ranges
+ * @param counts
+ */
+void computeGenericCounts(vtkDataArray* array, int numComps, int numBins, const std::vector<double>& ranges, std::vector<vtkIdType>& counts)
+{
+  counts.assign((numComps + 1) * numBins, 0);
+  auto binIndex = [&](int comp, double value) {
+    double width = ranges[2 * comp + 1] - ranges[2 * comp];
+    int bin = width > 0.0 ? static_cast<int>((value - ranges[2 * comp]) * numBins / width) : 0;
+    return std::min(std::max(bin, 0), numBins - 1);
+  };
+
+  vtkIdType numTuples = array->GetNumberOfTuples();
+  for(vtkIdType tuple = 0; tuple < numTuples; tuple++)
+  {
+    double magnitude = 0.0;
+    for(int comp = 0; comp < numComps; comp++)
+    {
+      double value = array->GetComponent(tuple, comp);
+      counts[comp * numBins + binIndex(comp, value)]++;
+      magnitude += value * value;
+    }
+    counts[numComps * numBins + binIndex(numComps, std::sqrt(magnitude))]++;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatistics::VSArrayStatistics(vtkDataArray* array, int numBins)
+: m_Array(array)
+, m_ArrayMTime(array->GetMTime())
+, m_NumComponents(std::max(array->GetNumberOfComponents(), 1))
+, m_NumTuples(array->GetNumberOfTuples())
+, m_NumBins(std::max(numBins, 1))
+, m_Ranges(2 * (m_NumComponents + 1), 0.0)
+, m_NaNCounts(m_NumComponents + 1, 0)
+{
+  if(m_NumTuples == 0)
+  {
+    return;
+  }
+
+  switch(array->GetDataType())
+  {
+    vtkTemplateMacro(computeRanges(static_cast<const VTK_TT*>(array->GetVoidPointer(0)), m_NumTuples, m_NumComponents, m_Ranges, m_NaNCounts));
+  default:
+    // Types such as VTK_BIT cannot be read as a typed buffer and never contain NaN
+    for(int i = 0; i < m_NumComponents; i++)
+    {
+      array->GetRange(m_Ranges.data() + 2 * i, i);
+    }
+    array->GetRange(m_Ranges.data() + 2 * m_NumComponents, -1);
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatistics::computeHistograms() const
+{
+  m_Histograms.assign(m_NumComponents + 1, std::vector<vtkIdType>(m_NumBins, 0));
+
+  vtkDataArray* array = m_Array;
+  if(nullptr == array || m_NumTuples == 0 || array->GetMTime() != m_ArrayMTime)
+  {
+    return;
+  }
+
+  std::vector<vtkIdType> counts;
+  switch(array->GetDataType())
+  {
+    vtkTemplateMacro(computeCounts(static_cast<const VTK_TT*>(array->GetVoidPointer(0)), m_NumTuples, m_NumComponents, m_NumBins, m_Ranges, counts));
+  default:
+    computeGenericCounts(array, m_NumComponents, m_NumBins, m_Ranges, counts);
+    break;
+  }
+
+  for(int i = 0; i <= m_NumComponents; i++)
+  {
+    std::copy(counts.begin() + i * m_NumBins, counts.begin() + (i + 1) * m_NumBins, m_Histograms[i].begin());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSArrayStatistics::getNumberOfComponents() const
+{
+  return m_NumComponents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSArrayStatistics::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSArrayStatistics::componentIndex(int component) const
+{
+  if(component < 0 || component >= m_NumComponents)
+  {
+    return m_NumComponents;
+  }
+
+  return component;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const double* VSArrayStatistics::getRange(int component) const
+{
+  return m_Ranges.data() + 2 * componentIndex(component);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatistics::getRange(int component, double range[2]) const
+{
+  const double* values = getRange(component);
+  range[0] = values[0];
+  range[1] = values[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSArrayStatistics::getNaNCount(int component) const
+{
+  return m_NaNCounts[componentIndex(component)];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSArrayStatistics::getNumberOfBins() const
+{
+  return m_NumBins;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<vtkIdType>& VSArrayStatistics::getHistogram(int component) const
+{
+  std::call_once(m_HistogramFlag, [this]() { computeHistograms(); });
+  return m_Histograms[componentIndex(component)];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatisticsCache::VSArrayStatisticsCache()
+: m_NumBins(DefaultNumberOfBins)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatisticsCache* VSArrayStatisticsCache::Instance()
+{
+  static VSArrayStatisticsCache cache;
+  return &cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatisticsCache::StatisticsPtr VSArrayStatisticsCache::getStatistics(vtkDataArray* array)
+{
+  if(nullptr == array)
+  {
+    return nullptr;
+  }
+
+  int numBins = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // Arrays are identified by address.  The weak pointer detects a new array
+    // allocated at the address of a deleted one.
+    auto iter = m_Entries.find(array);
+    if(iter != m_Entries.end())
+    {
+      const CacheEntry& entry = iter->second;
+      if(entry.m_Array.GetPointer() == array && entry.m_MTime == array->GetMTime())
+      {
+        return entry.m_Statistics;
+      }
+    }
+
+    numBins = m_NumBins;
+  }
+
+  // Large arrays take a while to scan, so other arrays remain available in the meantime
+  vtkMTimeType mTime = array->GetMTime();
+  StatisticsPtr statistics = std::make_shared<const VSArrayStatistics>(array, numBins);
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  removeExpiredEntries();
+  if(numBins == m_NumBins)
+  {
+    CacheEntry& entry = m_Entries[array];
+    entry.m_Array = array;
+    entry.m_MTime = mTime;
+    entry.m_Statistics = statistics;
+  }
+
+  return statistics;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSArrayStatisticsCache::getNumberOfBins() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_NumBins;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatisticsCache::setNumberOfBins(int numBins)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  numBins = std::max(numBins, 1);
+  if(numBins != m_NumBins)
+  {
+    m_NumBins = numBins;
+    m_Entries.clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatisticsCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Entries.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatisticsCache::removeExpiredEntries()
+{
+  for(auto iter = m_Entries.begin(); iter != m_Entries.end();)
+  {
+    if(nullptr == iter->second.m_Array.GetPointer())
+    {
+      iter = m_Entries.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
@@ -0,0 +1,201 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vtkDataArray.h>
+#include <vtkType.h>
+#include <vtkWeakPointer.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSArrayStatistics VSArrayStatisticsCache.h SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.h
+ * @brief This class stores the per-component value ranges, NaN counts, and histograms
+ * of a vtkDataArray.  Component -1 refers to the tuple magnitude.  NaN values are
+ * excluded from the ranges and histograms.  Histograms are only binned the first time
+ * one is requested.
+ */
+class SIMPLVtkLib_EXPORT VSArrayStatistics
+{
+public:
+  /**
+   * @brief Computes the ranges and NaN counts for the given array in parallel
+   * @param array
+   * @param numBins
+   */
+  VSArrayStatistics(vtkDataArray* array, int numBins);
+
+  /**
+   * @brief Returns the number of components in the array
+   * @return
+   */
+  int getNumberOfComponents() const;
+
+  /**
+   * @brief Returns the number of tuples in the array
+   * @return
+   */
+  vtkIdType getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the value range for the given component or the magnitude range
+   * for component -1.  Arrays without any valid values return a range of [0, 0].
+   * @param component
+   * @return
+   */
+  const double* getRange(int component) const;
+
+  /**
+   * @brief Copies the value range for the given component into the range parameter
+   * @param component
+   * @param range
+   */
+  void getRange(int component, double range[2]) const;
+
+  /**
+   * @brief Returns the number of NaN values in the given component or the number of
+   * tuples containing a NaN value for component -1
+   * @param component
+   * @return
+   */
+  vtkIdType getNaNCount(int component) const;
+
+  /**
+   * @brief Returns the number of histogram bins
+   * @return
+   */
+  int getNumberOfBins() const;
+
+  /**
+   * @brief Returns the histogram of the given component over its value range.  All
+   * histograms are computed on the first call.  Bins are empty if the array has since
+   * been deleted or modified.
+   * @param component
+   * @return
+   */
+  const std::vector<vtkIdType>& getHistogram(int component) const;
+
+private:
+  /**
+   * @brief Returns the storage index for the given component
+   * @param component
+   * @return
+   */
+  size_t componentIndex(int component) const;
+
+  /**
+   * @brief Bins every component and the tuple magnitude of the array over the computed ranges
+   */
+  void computeHistograms() const;
+
+  vtkWeakPointer<vtkDataArray> m_Array;
+  vtkMTimeType m_ArrayMTime = 0;
+  int m_NumComponents = 0;
+  vtkIdType m_NumTuples = 0;
+  int m_NumBins = 0;
+  std::vector<double> m_Ranges;
+  std::vector<vtkIdType> m_NaNCounts;
+  mutable std::once_flag m_HistogramFlag;
+  mutable std::vector<std::vector<vtkIdType>> m_Histograms;
+};
+
+/**
+ * @class VSArrayStatisticsCache VSArrayStatisticsCache.h SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.h
+ * @brief This class shares VSArrayStatistics between every view and widget requesting
+ * information about the same vtkDataArray.  Statistics are computed on first use and
+ * recomputed when the array's MTime changes.
+ */
+class SIMPLVtkLib_EXPORT VSArrayStatisticsCache
+{
+public:
+  using StatisticsPtr = std::shared_ptr<const VSArrayStatistics>;
+
+  /**
+   * @brief Returns the application-wide array statistics cache
+   * @return
+   */
+  static VSArrayStatisticsCache* Instance();
+
+  virtual ~VSArrayStatisticsCache() = default;
+
+  /**
+   * @brief Returns the statistics for the given array, computing them if required
+   * @param array
+   * @return
+   */
+  StatisticsPtr getStatistics(vtkDataArray* array);
+
+  /**
+   * @brief Returns the number of histogram bins used for new statistics
+   * @return
+   */
+  int getNumberOfBins() const;
+
+  /**
+   * @brief Sets the number of histogram bins and removes statistics using a different count
+   * @param numBins
+   */
+  void setNumberOfBins(int numBins);
+
+  /**
+   * @brief Removes all cached statistics
+   */
+  void clear();
+
+protected:
+  VSArrayStatisticsCache();
+
+  /**
+   * @brief Removes the statistics of arrays that have been deleted
+   */
+  void removeExpiredEntries();
+
+private:
+  struct CacheEntry
+  {
+    vtkWeakPointer<vtkDataArray> m_Array;
+    vtkMTimeType m_MTime = 0;
+    StatisticsPtr m_Statistics;
+  };
+
+  std::map<const vtkDataArray*, CacheEntry> m_Entries;
+  int m_NumBins;
+  mutable std::mutex m_Mutex;
+};
@@ -0,0 +1,387 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSCellLinksCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include <vtkIdList.h>
+#include <vtkSMPTools.h>
+
+namespace
+{
+const size_t DefaultMemoryBudget = 1024 * 1024 * 1024;
+
+/**
+ * @brief Counts the number of cells using each point
+ */
+class CountPointCellsFunctor
+{
+public:
+  CountPointCellsFunctor(const MeshIndexType* elements, int cellSize, std::vector<std::atomic<vtkIdType>>& counts)
+  : m_Elements(elements)
+  , m_CellSize(cellSize)
+  , m_Counts(counts)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    for(vtkIdType i = begin * m_CellSize; i < end * m_CellSize; i++)
+    {
+      m_Counts[m_Elements[i]].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  const MeshIndexType* m_Elements;
+  int m_CellSize;
+  std::vector<std::atomic<vtkIdType>>& m_Counts;
+};
+
+/**
+ * @brief Writes each cell ID into the next free slot of every point it uses
+ */
+template <typename T> class FillPointCellsFunctor
+{
+public:
+  FillPointCellsFunctor(const MeshIndexType* elements, int cellSize, std::vector<std::atomic<vtkIdType>>& cursors, T* cells)
+  : m_Elements(elements)
+  , m_CellSize(cellSize)
+  , m_Cursors(cursors)
+  , m_Cells(cells)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    for(vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      const MeshIndexType* element = m_Elements + cellId * m_CellSize;
+      for(int i = 0; i < m_CellSize; i++)
+      {
+        vtkIdType index = m_Cursors[element[i]].fetch_add(1, std::memory_order_relaxed);
+        m_Cells[index] = static_cast<T>(cellId);
+      }
+    }
+  }
+
+private:
+  const MeshIndexType* m_Elements;
+  int m_CellSize;
+  std::vector<std::atomic<vtkIdType>>& m_Cursors;
+  T* m_Cells;
+};
+
+/**
+ * @brief Sorts the cell IDs of each point so the links do not depend on thread scheduling
+ */
+template <typename T> class SortPointCellsFunctor
+{
+public:
+  SortPointCellsFunctor(const std::vector<vtkIdType>& offsets, T* cells)
+  : m_Offsets(offsets)
+  , m_Cells(cells)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    for(vtkIdType ptId = begin; ptId < end; ptId++)
+    {
+      std::sort(m_Cells + m_Offsets[ptId], m_Cells + m_Offsets[ptId + 1]);
+    }
+  }
+
+private:
+  const std::vector<vtkIdType>& m_Offsets;
+  T* m_Cells;
+};
+
+/**
+ * @brief Fills the cell IDs for every point using the precomputed offsets
+ */
+template <typename T> void FillPointCells(const MeshIndexType* elements, size_t numCells, int cellSize, const std::vector<vtkIdType>& offsets, std::vector<T>& cells)
+{
+  size_t numPoints = offsets.size() - 1;
+  std::vector<std::atomic<vtkIdType>> cursors(numPoints);
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    cursors[i].store(offsets[i], std::memory_order_relaxed);
+  }
+
+  cells.resize(static_cast<size_t>(offsets.back()));
+  FillPointCellsFunctor<T> fillFunctor(elements, cellSize, cursors, cells.data());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numCells), fillFunctor);
+
+  SortPointCellsFunctor<T> sortFunctor(offsets, cells.data());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numPoints), sortFunctor);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCellLinks::VSCellLinks(const MeshIndexType* elements, size_t numCells, size_t numPoints, int cellSize)
+{
+  m_Offsets.resize(numPoints + 1, 0);
+  if(nullptr == elements || numPoints == 0)
+  {
+    return;
+  }
+
+  std::vector<std::atomic<vtkIdType>> counts(numPoints);
+  CountPointCellsFunctor countFunctor(elements, cellSize, counts);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numCells), countFunctor);
+
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    m_Offsets[i + 1] = m_Offsets[i] + counts[i].load(std::memory_order_relaxed);
+  }
+
+  if(numCells <= std::numeric_limits<uint32_t>::max())
+  {
+    FillPointCells(elements, numCells, cellSize, m_Offsets, m_Cells32);
+  }
+  else
+  {
+    FillPointCells(elements, numCells, cellSize, m_Offsets, m_Cells64);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSCellLinks::getNumberOfCells(vtkIdType ptId) const
+{
+  if(ptId < 0 || static_cast<size_t>(ptId) + 1 >= m_Offsets.size())
+  {
+    return 0;
+  }
+
+  return m_Offsets[ptId + 1] - m_Offsets[ptId];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCellLinks::getCells(vtkIdType ptId, vtkIdList* cellIds) const
+{
+  vtkIdType count = getNumberOfCells(ptId);
+  cellIds->SetNumberOfIds(count);
+  if(count == 0)
+  {
+    return;
+  }
+
+  vtkIdType offset = m_Offsets[ptId];
+  vtkIdType* ids = cellIds->GetPointer(0);
+  if(m_Cells64.empty())
+  {
+    std::copy(m_Cells32.begin() + offset, m_Cells32.begin() + offset + count, ids);
+  }
+  else
+  {
+    std::copy(m_Cells64.begin() + offset, m_Cells64.begin() + offset + count, ids);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSCellLinks::getMemorySize() const
+{
+  return m_Offsets.size() * sizeof(vtkIdType) + m_Cells32.size() * sizeof(uint32_t) + m_Cells64.size() * sizeof(vtkIdType);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCellLinksCache::VSCellLinksCache()
+: m_MemoryBudget(DefaultMemoryBudget)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCellLinksCache* VSCellLinksCache::Instance()
+{
+  static VSCellLinksCache cache;
+  return &cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCellLinksCache::CellLinksPtr VSCellLinksCache::getCellLinks(const ElementListType::Pointer& elements, size_t numPoints, int cellSize)
+{
+  if(nullptr == elements)
+  {
+    return nullptr;
+  }
+
+  // Element lists are identified by address.  The weak pointer detects a new list
+  // allocated at the address of a deleted one.
+  const IDataArray* key = elements.get();
+  size_t numTuples = elements->getNumberOfTuples();
+  std::promise<CellLinksPtr> buildPromise;
+  std::shared_future<CellLinksPtr> links;
+  bool buildLinks = false;
+  size_t buildId = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto iter = m_Entries.find(key);
+    if(iter != m_Entries.end())
+    {
+      CacheEntry& entry = iter->second;
+      if(entry.m_Elements.lock() == elements && entry.m_NumPoints == numPoints && entry.m_NumTuples == numTuples)
+      {
+        m_UsageOrder.splice(m_UsageOrder.begin(), m_UsageOrder, entry.m_UsageIter);
+        links = entry.m_Links;
+      }
+      else
+      {
+        removeEntry(key);
+      }
+    }
+
+    if(false == links.valid())
+    {
+      buildLinks = true;
+      buildId = ++m_LastBuildId;
+      links = buildPromise.get_future().share();
+      m_UsageOrder.push_front(key);
+
+      CacheEntry& entry = m_Entries[key];
+      entry.m_Elements = elements;
+      entry.m_NumPoints = numPoints;
+      entry.m_NumTuples = numTuples;
+      entry.m_Links = links;
+      entry.m_BuildId = buildId;
+      entry.m_UsageIter = m_UsageOrder.begin();
+    }
+  }
+
+  // Wait for the links outside of the lock if another thread is still building them
+  if(false == buildLinks)
+  {
+    return links.get();
+  }
+
+  // Other element lists can be looked up and built while these links are built
+  CellLinksPtr cellLinks = std::make_shared<VSCellLinks>(elements->getPointer(0), numTuples, numPoints, cellSize);
+  buildPromise.set_value(cellLinks);
+
+  // The entry is only counted if it was not evicted or replaced during the build
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  auto iter = m_Entries.find(key);
+  if(iter != m_Entries.end() && iter->second.m_BuildId == buildId)
+  {
+    iter->second.m_MemorySize = cellLinks->getMemorySize();
+    m_MemoryUsage += iter->second.m_MemorySize;
+    evictToBudget();
+  }
+
+  return cellLinks;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSCellLinksCache::getMemoryBudget() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCellLinksCache::setMemoryBudget(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_MemoryBudget = bytes;
+  evictToBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSCellLinksCache::getMemoryUsage() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MemoryUsage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCellLinksCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Entries.clear();
+  m_UsageOrder.clear();
+  m_MemoryUsage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCellLinksCache::evictToBudget()
+{
+  while(m_MemoryUsage > m_MemoryBudget && m_UsageOrder.size() > 1)
+  {
+    removeEntry(m_UsageOrder.back());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCellLinksCache::removeEntry(const IDataArray* key)
+{
+  auto iter = m_Entries.find(key);
+  if(iter == m_Entries.end())
+  {
+    return;
+  }
+
+  m_MemoryUsage -= iter->second.m_MemorySize;
+  m_UsageOrder.erase(iter->second.m_UsageIter);
+  m_Entries.erase(iter);
+}
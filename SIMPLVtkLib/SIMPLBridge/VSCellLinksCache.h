@@ -0,0 +1,186 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vtkType.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkIdList;
+
+/**
+ * @class VSCellLinks VSCellLinksCache.h SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h
+ * @brief This class stores the cells that use each point of a SIMPLib element list
+ * in compressed sparse row form.  Cell IDs are stored as 32-bit values whenever the
+ * element count allows it.
+ */
+class SIMPLVtkLib_EXPORT VSCellLinks
+{
+public:
+  /**
+   * @brief Builds the links for the given element list in parallel
+   * @param elements
+   * @param numCells
+   * @param numPoints
+   * @param cellSize
+   */
+  VSCellLinks(const MeshIndexType* elements, size_t numCells, size_t numPoints, int cellSize);
+
+  /**
+   * @brief Returns the number of cells using the given point
+   * @param ptId
+   * @return
+   */
+  vtkIdType getNumberOfCells(vtkIdType ptId) const;
+
+  /**
+   * @brief Copies the IDs of the cells using the given point into the vtkIdList
+   * @param ptId
+   * @param cellIds
+   */
+  void getCells(vtkIdType ptId, vtkIdList* cellIds) const;
+
+  /**
+   * @brief Returns the number of bytes used by the links
+   * @return
+   */
+  size_t getMemorySize() const;
+
+private:
+  std::vector<vtkIdType> m_Offsets;
+  std::vector<uint32_t> m_Cells32;
+  std::vector<vtkIdType> m_Cells64;
+};
+
+/**
+ * @class VSCellLinksCache VSCellLinksCache.h SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h
+ * @brief This class shares VSCellLinks between every wrapper of the same SIMPLib
+ * element list.  Links are built on first use without holding the cache lock, and
+ * callers requesting links that are still being built wait for that build.  The
+ * least recently used links are evicted when the memory budget is exceeded.  Evicted
+ * links stay valid for callers still holding them.
+ */
+class SIMPLVtkLib_EXPORT VSCellLinksCache
+{
+public:
+  using CellLinksPtr = std::shared_ptr<const VSCellLinks>;
+  using ElementListType = DataArray<MeshIndexType>;
+
+  /**
+   * @brief Returns the application-wide cell links cache
+   * @return
+   */
+  static VSCellLinksCache* Instance();
+
+  virtual ~VSCellLinksCache() = default;
+
+  /**
+   * @brief Returns the links for the given element list, building them if required.
+   * Callers should keep the returned links for as long as they need them.
+   * @param elements
+   * @param numPoints
+   * @param cellSize
+   * @return
+   */
+  CellLinksPtr getCellLinks(const ElementListType::Pointer& elements, size_t numPoints, int cellSize);
+
+  /**
+   * @brief Returns the memory budget in bytes
+   * @return
+   */
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Sets the memory budget in bytes and evicts links until the cache fits
+   * @param bytes
+   */
+  void setMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Returns the number of bytes used by the cached links
+   * @return
+   */
+  size_t getMemoryUsage() const;
+
+  /**
+   * @brief Removes all cached links
+   */
+  void clear();
+
+protected:
+  VSCellLinksCache();
+
+  /**
+   * @brief Evicts the least recently used links until the memory usage fits the budget.
+   * The most recently used links are never evicted.
+   */
+  void evictToBudget();
+
+private:
+  struct CacheEntry
+  {
+    std::weak_ptr<IDataArray> m_Elements;
+    size_t m_NumPoints = 0;
+    size_t m_NumTuples = 0;
+    std::shared_future<CellLinksPtr> m_Links;
+    size_t m_BuildId = 0;
+    size_t m_MemorySize = 0;
+    std::list<const IDataArray*>::iterator m_UsageIter;
+  };
+
+  /**
+   * @brief Removes the entry for the given key
+   * @param key
+   */
+  void removeEntry(const IDataArray* key);
+
+  std::map<const IDataArray*, CacheEntry> m_Entries;
+  std::list<const IDataArray*> m_UsageOrder;
+  size_t m_MemoryBudget;
+  size_t m_MemoryUsage = 0;
+  size_t m_LastBuildId = 0;
+  mutable std::mutex m_Mutex;
+};
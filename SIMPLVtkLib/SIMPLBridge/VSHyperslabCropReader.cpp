@@ -0,0 +1,561 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSHyperslabCropReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <hdf5.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMutexLocker>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkFieldData.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkType.h>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+vtkStandardNewMacro(VSHyperslabCropReader);
+
+namespace
+{
+// Cap the values read per hyperslab so that progress and aborts stay responsive
+const hsize_t MaxValuesPerRead = 1 << 24;
+
+/**
+ * @class ScopedH5Id
+ * @brief Closes an HDF5 identifier when it goes out of scope
+ */
+class ScopedH5Id
+{
+public:
+  using CloseFunction = herr_t (*)(hid_t);
+
+  ScopedH5Id(hid_t id, CloseFunction closeFunction)
+  : m_Id(id)
+  , m_Close(closeFunction)
+  {
+  }
+
+  ~ScopedH5Id()
+  {
+    if(m_Id >= 0)
+    {
+      m_Close(m_Id);
+    }
+  }
+
+  ScopedH5Id(const ScopedH5Id&) = delete;
+  ScopedH5Id& operator=(const ScopedH5Id&) = delete;
+
+  hid_t get() const
+  {
+    return m_Id;
+  }
+
+  bool isValid() const
+  {
+    return m_Id >= 0;
+  }
+
+private:
+  hid_t m_Id;
+  CloseFunction m_Close;
+};
+
+/**
+ * @brief Returns true if the group contains a link with the given name
+ * @param groupId
+ * @param name
+ * @return
+ */
+bool hasLink(hid_t groupId, const std::string& name)
+{
+  return H5Lexists(groupId, name.c_str(), H5P_DEFAULT) > 0;
+}
+
+/**
+ * @brief Returns the names of the group's children that are HDF5 objects of the given type
+ * @param groupId
+ * @param type
+ * @return
+ */
+std::vector<std::string> getChildNames(hid_t groupId, H5I_type_t type)
+{
+  std::vector<std::string> names;
+  H5G_info_t groupInfo;
+  if(H5Gget_info(groupId, &groupInfo) < 0)
+  {
+    return names;
+  }
+
+  for(hsize_t i = 0; i < groupInfo.nlinks; i++)
+  {
+    ssize_t length = H5Lget_name_by_idx(groupId, ".", H5_INDEX_NAME, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
+    if(length <= 0)
+    {
+      continue;
+    }
+
+    std::string name(static_cast<size_t>(length) + 1, '\0');
+    H5Lget_name_by_idx(groupId, ".", H5_INDEX_NAME, H5_ITER_INC, i, &name[0], name.size(), H5P_DEFAULT);
+    name.resize(static_cast<size_t>(length));
+
+    ScopedH5Id objectId(H5Oopen(groupId, name.c_str(), H5P_DEFAULT), H5Oclose);
+    if(objectId.isValid() && H5Iget_type(objectId.get()) == type)
+    {
+      names.push_back(name);
+    }
+  }
+
+  return names;
+}
+
+/**
+ * @brief Returns true if the group is a SIMPL attribute matrix of cell type
+ * @param groupId
+ * @return
+ */
+bool isCellAttributeMatrix(hid_t groupId)
+{
+  QByteArray typeName = SIMPL::StringConstants::AttributeMatrixType.toLatin1();
+  if(H5Aexists(groupId, typeName.constData()) <= 0)
+  {
+    return false;
+  }
+
+  ScopedH5Id attributeId(H5Aopen(groupId, typeName.constData(), H5P_DEFAULT), H5Aclose);
+  uint32_t amType = 0;
+  if(!attributeId.isValid() || H5Aread(attributeId.get(), H5T_NATIVE_UINT32, &amType) < 0)
+  {
+    return false;
+  }
+
+  return amType == static_cast<uint32_t>(AttributeMatrix::Type::Cell);
+}
+
+/**
+ * @brief Returns the VTK type that holds values of the HDF5 type or -1 if the type is not numeric
+ * @param typeId
+ * @return
+ */
+int getVtkType(hid_t typeId)
+{
+  size_t size = H5Tget_size(typeId);
+  switch(H5Tget_class(typeId))
+  {
+  case H5T_FLOAT:
+    return size == 4 ? VTK_FLOAT : (size == 8 ? VTK_DOUBLE : -1);
+  case H5T_INTEGER:
+  {
+    bool isSigned = H5Tget_sign(typeId) == H5T_SGN_2;
+    switch(size)
+    {
+    case 1:
+      return isSigned ? VTK_SIGNED_CHAR : VTK_UNSIGNED_CHAR;
+    case 2:
+      return isSigned ? VTK_SHORT : VTK_UNSIGNED_SHORT;
+    case 4:
+      return isSigned ? VTK_INT : VTK_UNSIGNED_INT;
+    case 8:
+      return isSigned ? VTK_LONG_LONG : VTK_UNSIGNED_LONG_LONG;
+    default:
+      return -1;
+    }
+  }
+  default:
+    return -1;
+  }
+}
+
+/**
+ * @brief Returns the native HDF5 memory type for the VTK type
+ * @param vtkType
+ * @return
+ */
+hid_t getNativeType(int vtkType)
+{
+  switch(vtkType)
+  {
+  case VTK_SIGNED_CHAR:
+    return H5T_NATIVE_SCHAR;
+  case VTK_UNSIGNED_CHAR:
+    return H5T_NATIVE_UCHAR;
+  case VTK_SHORT:
+    return H5T_NATIVE_SHORT;
+  case VTK_UNSIGNED_SHORT:
+    return H5T_NATIVE_USHORT;
+  case VTK_INT:
+    return H5T_NATIVE_INT;
+  case VTK_UNSIGNED_INT:
+    return H5T_NATIVE_UINT;
+  case VTK_LONG_LONG:
+    return H5T_NATIVE_LLONG;
+  case VTK_UNSIGNED_LONG_LONG:
+    return H5T_NATIVE_ULLONG;
+  case VTK_FLOAT:
+    return H5T_NATIVE_FLOAT;
+  default:
+    return H5T_NATIVE_DOUBLE;
+  }
+}
+
+/**
+ * @brief Reads the strided block of cells from a SIMPL cell array.  SIMPL stores cell
+ * arrays with the tuple dimensions reversed followed by the component dimensions, so the
+ * hyperslab is ordered Z, Y, X, components.  Returns nullptr if the dataset is not a
+ * numeric array matching the image or the read was aborted.
+ * @param reader
+ * @param datasetId
+ * @param name
+ * @param cellDims
+ * @param cellStart
+ * @param cellCount
+ * @param sampleRate
+ * @param progressStart
+ * @param progressScale
+ * @param hdf5Lock
+ * @return
+ */
+VTK_PTR(vtkDataArray) readHyperslab(VSHyperslabCropReader* reader, QMutexLocker& hdf5Lock, hid_t datasetId, const std::string& name, const int cellDims[3], const int cellStart[3], const int cellCount[3], const int sampleRate[3], double progressStart, double progressScale)
+{
+  ScopedH5Id fileTypeId(H5Dget_type(datasetId), H5Tclose);
+  ScopedH5Id fileSpaceId(H5Dget_space(datasetId), H5Sclose);
+  if(!fileTypeId.isValid() || !fileSpaceId.isValid())
+  {
+    return nullptr;
+  }
+
+  int vtkType = getVtkType(fileTypeId.get());
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId.get());
+  if(vtkType < 0 || rank < 3)
+  {
+    return nullptr;
+  }
+
+  std::vector<hsize_t> dims(static_cast<size_t>(rank));
+  H5Sget_simple_extent_dims(fileSpaceId.get(), dims.data(), nullptr);
+  if(dims[0] != static_cast<hsize_t>(cellDims[2]) || dims[1] != static_cast<hsize_t>(cellDims[1]) || dims[2] != static_cast<hsize_t>(cellDims[0]))
+  {
+    return nullptr;
+  }
+
+  hsize_t numComponents = 1;
+  for(int i = 3; i < rank; i++)
+  {
+    numComponents *= dims[i];
+  }
+
+  VTK_PTR(vtkDataArray) dataArray;
+  dataArray.TakeReference(vtkDataArray::CreateDataArray(vtkType));
+  dataArray->SetName(name.c_str());
+  dataArray->SetNumberOfComponents(static_cast<int>(numComponents));
+  dataArray->SetNumberOfTuples(static_cast<vtkIdType>(cellCount[0]) * cellCount[1] * cellCount[2]);
+
+  // Read whole Z layers per hyperslab
+  hsize_t valuesPerLayer = static_cast<hsize_t>(cellCount[0]) * cellCount[1] * numComponents;
+  hsize_t layersPerRead = std::max<hsize_t>(1, MaxValuesPerRead / std::max<hsize_t>(valuesPerLayer, 1));
+
+  std::vector<hsize_t> start(static_cast<size_t>(rank), 0);
+  std::vector<hsize_t> stride(static_cast<size_t>(rank), 1);
+  std::vector<hsize_t> count(dims);
+  for(int i = 0; i < 3; i++)
+  {
+    start[i] = static_cast<hsize_t>(cellStart[2 - i]);
+    stride[i] = static_cast<hsize_t>(sampleRate[2 - i]);
+    count[i] = static_cast<hsize_t>(cellCount[2 - i]);
+  }
+
+  unsigned char* buffer = static_cast<unsigned char*>(dataArray->GetVoidPointer(0));
+  size_t valueSize = static_cast<size_t>(dataArray->GetDataTypeSize());
+  hsize_t numLayers = static_cast<hsize_t>(cellCount[2]);
+  for(hsize_t layer = 0; layer < numLayers; layer += layersPerRead)
+  {
+    if(reader->GetAbortExecute())
+    {
+      return nullptr;
+    }
+
+    hsize_t blockLayers = std::min(layersPerRead, numLayers - layer);
+    start[0] = static_cast<hsize_t>(cellStart[2]) + layer * stride[0];
+    count[0] = blockLayers;
+
+    hsize_t numValues = blockLayers * valuesPerLayer;
+    ScopedH5Id memorySpaceId(H5Screate_simple(1, &numValues, nullptr), H5Sclose);
+    if(H5Sselect_hyperslab(fileSpaceId.get(), H5S_SELECT_SET, start.data(), stride.data(), count.data(), nullptr) < 0 ||
+       H5Dread(datasetId, getNativeType(vtkType), memorySpaceId.get(), fileSpaceId.get(), H5P_DEFAULT, buffer + layer * valuesPerLayer * valueSize) < 0)
+    {
+      return nullptr;
+    }
+
+    // Let other threads read from HDF5 between blocks
+    hdf5Lock.unlock();
+    reader->UpdateProgress(progressStart + progressScale * (layer + blockLayers) / numLayers);
+    hdf5Lock.relock();
+  }
+
+  return dataArray;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHyperslabCropReader::VSHyperslabCropReader()
+: FileName(nullptr)
+, DataContainerName(nullptr)
+, AttributeMatrixName(nullptr)
+, HDF5Mutex(nullptr)
+{
+  for(int i = 0; i < 3; i++)
+  {
+    VOI[2 * i] = 0;
+    VOI[2 * i + 1] = VTK_INT_MAX;
+    SampleRate[i] = 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHyperslabCropReader::~VSHyperslabCropReader()
+{
+  SetFileName(nullptr);
+  SetDataContainerName(nullptr);
+  SetAttributeMatrixName(nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHyperslabCropReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (FileName ? FileName : "(none)") << "\n";
+  os << indent << "DataContainerName: " << (DataContainerName ? DataContainerName : "(none)") << "\n";
+  os << indent << "AttributeMatrixName: " << (AttributeMatrixName ? AttributeMatrixName : "(none)") << "\n";
+  os << indent << "VOI: " << VOI[0] << ", " << VOI[1] << ", " << VOI[2] << ", " << VOI[3] << ", " << VOI[4] << ", " << VOI[5] << "\n";
+  os << indent << "SampleRate: " << SampleRate[0] << ", " << SampleRate[1] << ", " << SampleRate[2] << "\n";
+  os << indent << "ArrayNames: " << ArrayNames.size() << "\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHyperslabCropReader::SetArrayNames(const std::vector<std::string>& arrayNames)
+{
+  if(ArrayNames != arrayNames)
+  {
+    ArrayNames = arrayNames;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<std::string>& VSHyperslabCropReader::GetArrayNames() const
+{
+  return ArrayNames;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHyperslabCropReader::SetHDF5Mutex(QMutex* mutex)
+{
+  HDF5Mutex = mutex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSHyperslabCropReader::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSHyperslabCropReader::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkImageData* output = vtkImageData::GetData(outputVector);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+  if(nullptr == FileName || nullptr == DataContainerName)
+  {
+    vtkErrorMacro(<< "A file name and data container name are required");
+    return 0;
+  }
+
+  // Clamp the volume of interest to the cells of the input like vtkExtractVOI
+  int extent[6];
+  input->GetExtent(extent);
+  int cellDims[3];
+  int cellStart[3];
+  int cellCount[3];
+  int sampleRate[3];
+  for(int i = 0; i < 3; i++)
+  {
+    cellDims[i] = std::max(extent[2 * i + 1] - extent[2 * i], 1);
+    sampleRate[i] = std::max(SampleRate[i], 1);
+
+    int lower = std::min(std::max(VOI[2 * i], extent[2 * i]), extent[2 * i + 1]) - extent[2 * i];
+    int upper = std::min(std::max(VOI[2 * i + 1], extent[2 * i]), extent[2 * i + 1]) - extent[2 * i];
+    cellStart[i] = std::min(std::min(lower, upper), cellDims[i] - 1);
+    int span = std::abs(upper - lower);
+    cellCount[i] = std::max(span / sampleRate[i], 1);
+    cellCount[i] = std::min(cellCount[i], (cellDims[i] - 1 - cellStart[i]) / sampleRate[i] + 1);
+  }
+
+  double origin[3];
+  double spacing[3];
+  input->GetOrigin(origin);
+  input->GetSpacing(spacing);
+  for(int i = 0; i < 3; i++)
+  {
+    origin[i] += (extent[2 * i] + cellStart[i]) * spacing[i];
+    spacing[i] *= sampleRate[i];
+  }
+
+  output->SetExtent(0, cellCount[0], 0, cellCount[1], 0, cellCount[2]);
+  output->SetOrigin(origin);
+  output->SetSpacing(spacing);
+  output->GetFieldData()->ShallowCopy(input->GetFieldData());
+
+  // HDF5 calls are only made while holding the lock.  readHyperslab releases it between
+  // blocks while the identifiers below are still open, which is safe because they are
+  // never used without the lock and are closed before it is finally released.
+  QMutexLocker hdf5Lock(HDF5Mutex);
+  if(H5Fis_hdf5(FileName) <= 0)
+  {
+    // Files that are not HDF5 have no arrays to read
+    vtkWarningMacro(<< FileName << " is not an HDF5 file");
+    return 1;
+  }
+
+  ScopedH5Id fileId(H5Fopen(FileName, H5F_ACC_RDONLY, H5P_DEFAULT), H5Fclose);
+  if(!fileId.isValid())
+  {
+    vtkErrorMacro(<< "Could not open " << FileName);
+    return 0;
+  }
+
+  std::string dcPath = SIMPL::StringConstants::DataContainerGroupName.toStdString() + "/" + DataContainerName;
+  ScopedH5Id dcGroupId(hasLink(fileId.get(), SIMPL::StringConstants::DataContainerGroupName.toStdString()) && H5Lexists(fileId.get(), dcPath.c_str(), H5P_DEFAULT) > 0 ? H5Gopen(fileId.get(), dcPath.c_str(), H5P_DEFAULT) : -1, H5Gclose);
+  if(!dcGroupId.isValid())
+  {
+    vtkErrorMacro(<< "Data container " << DataContainerName << " does not exist in " << FileName);
+    return 0;
+  }
+
+  // Find the attribute matrix holding the image cells
+  std::string amName = AttributeMatrixName ? AttributeMatrixName : "";
+  if(amName.empty())
+  {
+    for(const std::string& groupName : getChildNames(dcGroupId.get(), H5I_GROUP))
+    {
+      ScopedH5Id groupId(H5Gopen(dcGroupId.get(), groupName.c_str(), H5P_DEFAULT), H5Gclose);
+      if(groupId.isValid() && isCellAttributeMatrix(groupId.get()))
+      {
+        amName = groupName;
+        break;
+      }
+    }
+  }
+
+  ScopedH5Id amGroupId(!amName.empty() && hasLink(dcGroupId.get(), amName) ? H5Gopen(dcGroupId.get(), amName.c_str(), H5P_DEFAULT) : -1, H5Gclose);
+  if(!amGroupId.isValid())
+  {
+    // Images without cell arrays still produce the cropped geometry
+    return 1;
+  }
+
+  std::vector<std::string> arrayNames = ArrayNames.empty() ? getChildNames(amGroupId.get(), H5I_DATASET) : ArrayNames;
+  vtkCellData* cellData = output->GetCellData();
+  for(size_t i = 0; i < arrayNames.size(); i++)
+  {
+    if(GetAbortExecute())
+    {
+      return 0;
+    }
+
+    const std::string& arrayName = arrayNames[i];
+    if(false == hasLink(amGroupId.get(), arrayName))
+    {
+      vtkWarningMacro(<< "Array " << arrayName << " does not exist in " << amName);
+      continue;
+    }
+
+    ScopedH5Id datasetId(H5Dopen(amGroupId.get(), arrayName.c_str(), H5P_DEFAULT), H5Dclose);
+    if(!datasetId.isValid())
+    {
+      continue;
+    }
+
+    double progressScale = 1.0 / arrayNames.size();
+    VTK_PTR(vtkDataArray) dataArray = readHyperslab(this, hdf5Lock, datasetId.get(), arrayName, cellDims, cellStart, cellCount, sampleRate, i * progressScale, progressScale);
+    if(dataArray)
+    {
+      cellData->AddArray(dataArray);
+    }
+  }
+
+  if(GetAbortExecute())
+  {
+    return 0;
+  }
+
+  if(cellData->GetNumberOfArrays() > 0)
+  {
+    cellData->SetActiveScalars(cellData->GetArray(0)->GetName());
+  }
+
+  return 1;
+}
@@ -0,0 +1,139 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <QtCore/QMutex>
+
+#include <vtkDataSetAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSHyperslabCropReader VSHyperslabCropReader.h
+ * SIMPLVtkLib/SIMPLBridge/VSHyperslabCropReader.h
+ * @brief This vtkAlgorithm crops image data like vtkExtractVOI, but reads the cell
+ * arrays of the cropped region from the .dream3d file with HDF5 hyperslab selections
+ * instead of copying them from memory.  The input only provides the image geometry,
+ * so a data container can be imported without its arrays and cropped to a region of
+ * interest that fits in memory.  Arrays are read in blocks of Z layers so the read
+ * reports progress and can be aborted.
+ */
+class SIMPLVtkLib_EXPORT VSHyperslabCropReader : public vtkDataSetAlgorithm
+{
+public:
+  static VSHyperslabCropReader* New();
+  vtkTypeMacro(VSHyperslabCropReader, vtkDataSetAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  vtkSetStringMacro(FileName)
+  vtkGetStringMacro(FileName)
+
+  vtkSetStringMacro(DataContainerName)
+  vtkGetStringMacro(DataContainerName)
+
+  /**
+   * @brief Name of the cell attribute matrix to read.  The first cell attribute matrix
+   * of the data container is used if no name is set.
+   */
+  vtkSetStringMacro(AttributeMatrixName)
+  vtkGetStringMacro(AttributeMatrixName)
+
+  /**
+   * @brief Volume of interest in the structured coordinates of the input, as in vtkExtractVOI
+   */
+  vtkSetVector6Macro(VOI, int)
+  vtkGetVector6Macro(VOI, int)
+
+  vtkSetVector3Macro(SampleRate, int)
+  vtkGetVector3Macro(SampleRate, int)
+
+  /**
+   * @brief Sets the cell arrays to read.  Every numeric array of the attribute matrix
+   * is read if no names are set.
+   * @param arrayNames
+   */
+  void SetArrayNames(const std::vector<std::string>& arrayNames);
+
+  /**
+   * @brief Returns the cell arrays to read
+   * @return
+   */
+  const std::vector<std::string>& GetArrayNames() const;
+
+  /**
+   * @brief Sets the mutex held while calling into HDF5.  The HDF5 library is not
+   * thread-safe, so reads on a worker thread must be serialized with every other
+   * HDF5 access in the application.  The mutex is released between blocks of Z
+   * layers so other reads are not blocked for the whole crop.
+   * @param mutex
+   */
+  void SetHDF5Mutex(QMutex* mutex);
+
+protected:
+  VSHyperslabCropReader();
+  ~VSHyperslabCropReader() override;
+
+  /**
+   * @brief Computes the cropped geometry and reads its arrays from the file
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Requires vtkImageData input
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  char* FileName;
+  char* DataContainerName;
+  char* AttributeMatrixName;
+  int VOI[6];
+  int SampleRate[3];
+  std::vector<std::string> ArrayNames;
+  QMutex* HDF5Mutex;
+
+private:
+  VSHyperslabCropReader(const VSHyperslabCropReader&) = delete;
+  void operator=(const VSHyperslabCropReader&) = delete;
+};
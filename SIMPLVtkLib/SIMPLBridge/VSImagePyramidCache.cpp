@@ -0,0 +1,534 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSImagePyramidCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+
+#include <QtConcurrent>
+
+#include <vtkCellData.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
+
+namespace
+{
+const size_t DefaultMemoryBudget = 1024 * 1024 * 1024;
+const size_t MaximumAutomaticMemoryBudget = size_t(4) * DefaultMemoryBudget;
+
+/**
+ * @brief Averages 2x2x2 blocks of the input grid into each value of the output grid.
+ * Blocks are truncated along the upper edges of odd-sized axes and along flat axes.
+ */
+template <typename T> class BoxFilterFunctor
+{
+public:
+  BoxFilterFunctor(const T* input, T* output, const int inDims[3], const int outDims[3], int numComps)
+  : m_Input(input)
+  , m_Output(output)
+  , m_NumComps(numComps)
+  {
+    std::copy(inDims, inDims + 3, m_InDims);
+    std::copy(outDims, outDims + 3, m_OutDims);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<double> sums(m_NumComps);
+    for(vtkIdType row = begin; row < end; row++)
+    {
+      int y = static_cast<int>(row % m_OutDims[1]);
+      int z = static_cast<int>(row / m_OutDims[1]);
+      int yEnd = std::min(2 * y + 2, m_InDims[1]);
+      int zEnd = std::min(2 * z + 2, m_InDims[2]);
+
+      T* output = m_Output + row * m_OutDims[0] * m_NumComps;
+      for(int x = 0; x < m_OutDims[0]; x++)
+      {
+        int xEnd = std::min(2 * x + 2, m_InDims[0]);
+        std::fill(sums.begin(), sums.end(), 0.0);
+        int count = 0;
+        for(int inZ = 2 * z; inZ < zEnd; inZ++)
+        {
+          for(int inY = 2 * y; inY < yEnd; inY++)
+          {
+            const T* input = m_Input + ((static_cast<vtkIdType>(inZ) * m_InDims[1] + inY) * m_InDims[0] + 2 * x) * m_NumComps;
+            for(int inX = 2 * x; inX < xEnd; inX++)
+            {
+              for(int comp = 0; comp < m_NumComps; comp++)
+              {
+                sums[comp] += static_cast<double>(*input++);
+              }
+              count++;
+            }
+          }
+        }
+
+        for(int comp = 0; comp < m_NumComps; comp++)
+        {
+          double average = sums[comp] / count;
+          *output++ = static_cast<T>(std::is_integral<T>::value ? std::floor(average + 0.5) : average);
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Input;
+  T* m_Output;
+  int m_InDims[3];
+  int m_OutDims[3];
+  int m_NumComps;
+};
+
+/**
+ * @brief Runs the box filter for a typed array
+ * @param input
+ * @param output
+ * @param inDims
+ * @param outDims
+ * @param numComps
+ */
+template <typename T> void boxFilter(const T* input, T* output, const int inDims[3], const int outDims[3], int numComps)
+{
+  BoxFilterFunctor<T> functor(input, output, inDims, outDims, numComps);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(outDims[1]) * outDims[2], functor);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImagePyramid::VSImagePyramid(vtkImageData* image)
+{
+  m_Scalars = VSImagePyramidCache::GetTextureScalars(image);
+  if(nullptr == m_Scalars)
+  {
+    return;
+  }
+
+  image->GetDimensions(m_PointDims);
+  image->GetOrigin(m_Origin);
+  image->GetSpacing(m_Spacing);
+  m_CellScalars = (image->GetPointData()->GetScalars() != m_Scalars);
+  for(int i = 0; i < 3; i++)
+  {
+    m_Dims[i] = m_CellScalars ? std::max(m_PointDims[i] - 1, 1) : m_PointDims[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramid::build()
+{
+  if(nullptr == m_Scalars || false == m_Levels.empty())
+  {
+    return;
+  }
+
+  vtkDataArray* input = m_Scalars;
+  int inDims[3] = {m_Dims[0], m_Dims[1], m_Dims[2]};
+  int numComps = m_Scalars->GetNumberOfComponents();
+  while(std::max({inDims[0], inDims[1], inDims[2]}) > 1)
+  {
+    int outDims[3];
+    for(int i = 0; i < 3; i++)
+    {
+      outDims[i] = (inDims[i] + 1) / 2;
+    }
+
+    VTK_PTR(vtkDataArray) levelScalars;
+    levelScalars.TakeReference(vtkDataArray::CreateDataArray(m_Scalars->GetDataType()));
+    levelScalars->SetName(m_Scalars->GetName());
+    levelScalars->SetNumberOfComponents(numComps);
+    levelScalars->SetNumberOfTuples(static_cast<vtkIdType>(outDims[0]) * outDims[1] * outDims[2]);
+
+    switch(m_Scalars->GetDataType())
+    {
+      vtkTemplateMacro(boxFilter(static_cast<const VTK_TT*>(input->GetVoidPointer(0)), static_cast<VTK_TT*>(levelScalars->GetVoidPointer(0)), inDims, outDims, numComps));
+    default:
+      m_Levels.clear();
+      m_Scalars = nullptr;
+      return;
+    }
+
+    // Spread the level over the bounds of the source image
+    VTK_NEW(vtkImageData, levelImage);
+    int pointDims[3];
+    double spacing[3];
+    for(int i = 0; i < 3; i++)
+    {
+      pointDims[i] = (m_CellScalars && m_PointDims[i] > 1) ? outDims[i] + 1 : outDims[i];
+      spacing[i] = m_Spacing[i] * m_Dims[i] / outDims[i];
+    }
+    levelImage->SetDimensions(pointDims);
+    levelImage->SetOrigin(m_Origin);
+    levelImage->SetSpacing(spacing);
+    if(m_CellScalars)
+    {
+      levelImage->GetCellData()->SetScalars(levelScalars);
+    }
+    else
+    {
+      levelImage->GetPointData()->SetScalars(levelScalars);
+    }
+
+    m_Levels.push_back(levelImage);
+    input = levelScalars;
+    std::copy(outDims, outDims + 3, inDims);
+  }
+
+  // Only the levels are kept
+  m_Scalars = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImagePyramid::getNumberOfLevels() const
+{
+  return static_cast<int>(m_Levels.size()) + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSImagePyramid::getLevel(int level) const
+{
+  if(level <= 0 || m_Levels.empty())
+  {
+    return nullptr;
+  }
+
+  level = std::min(level, static_cast<int>(m_Levels.size()));
+  return m_Levels[level - 1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImagePyramid::getMemorySize() const
+{
+  size_t memorySize = 0;
+  for(const VTK_PTR(vtkImageData)& level : m_Levels)
+  {
+    memorySize += static_cast<size_t>(level->GetActualMemorySize()) * 1024;
+  }
+
+  return memorySize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImagePyramid::LevelForSampleRate(int sampleRate)
+{
+  int level = 0;
+  while(sampleRate > 1)
+  {
+    sampleRate /= 2;
+    level++;
+  }
+
+  return level;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImagePyramidCache::VSImagePyramidCache()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImagePyramidCache* VSImagePyramidCache::Instance()
+{
+  static VSImagePyramidCache cache;
+  return &cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImagePyramidCache::~VSImagePyramidCache()
+{
+  std::vector<QFuture<void>> pendingBuilds;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    pendingBuilds.swap(m_PendingBuilds);
+  }
+
+  // Finished builds lock the mutex so they must be waited on without holding it
+  for(QFuture<void>& build : pendingBuilds)
+  {
+    build.waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataArray* VSImagePyramidCache::GetTextureScalars(vtkImageData* image)
+{
+  if(nullptr == image)
+  {
+    return nullptr;
+  }
+
+  // vtkTexture reads the point scalars and falls back to the cell scalars
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  if(nullptr == scalars)
+  {
+    scalars = image->GetCellData()->GetScalars();
+  }
+
+  return scalars;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImagePyramidCache::PyramidPtr VSImagePyramidCache::getPyramid(vtkImageData* image)
+{
+  vtkDataArray* scalars = GetTextureScalars(image);
+  if(nullptr == scalars)
+  {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  // Scalars are identified by address.  The weak pointer detects a new array
+  // allocated at the address of a deleted one.
+  auto iter = m_Entries.find(scalars);
+  if(iter != m_Entries.end())
+  {
+    CacheEntry& entry = iter->second;
+    if(entry.m_Scalars.GetPointer() == scalars && entry.m_MTime == scalars->GetMTime())
+    {
+      m_UsageOrder.remove(scalars);
+      m_UsageOrder.push_front(scalars);
+      if(false == entry.m_Build.isFinished())
+      {
+        return nullptr;
+      }
+
+      return entry.m_Pyramid;
+    }
+
+    // A running build keeps its own reference to the stale pyramid
+    removeEntry(scalars);
+  }
+
+  std::shared_ptr<VSImagePyramid> pyramid = std::make_shared<VSImagePyramid>(image);
+  CacheEntry& entry = m_Entries[scalars];
+  entry.m_Scalars = scalars;
+  entry.m_MTime = scalars->GetMTime();
+  entry.m_Pyramid = pyramid;
+  entry.m_Build = QtConcurrent::run([this, scalars, pyramid] {
+    pyramid->build();
+    buildFinished(scalars, pyramid.get());
+  });
+  m_UsageOrder.push_front(scalars);
+
+  // Builds capture this and are waited on by the destructor even if their entry is removed
+  m_PendingBuilds.erase(std::remove_if(m_PendingBuilds.begin(), m_PendingBuilds.end(), [](const QFuture<void>& build) { return build.isFinished(); }),
+                        m_PendingBuilds.end());
+  m_PendingBuilds.push_back(entry.m_Build);
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramidCache::buildFinished(const vtkDataArray* key, const VSImagePyramid* pyramid)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  // The entry may have been removed or replaced while the pyramid was built
+  auto iter = m_Entries.find(key);
+  if(iter == m_Entries.end() || iter->second.m_Pyramid.get() != pyramid)
+  {
+    return;
+  }
+
+  iter->second.m_MemorySize = pyramid->getMemorySize();
+  m_MemoryUsage += iter->second.m_MemorySize;
+  evictToBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QFuture<void> VSImagePyramidCache::getBuildFuture(vtkImageData* image) const
+{
+  vtkDataArray* scalars = GetTextureScalars(image);
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  auto iter = m_Entries.find(scalars);
+  if(nullptr == scalars || iter == m_Entries.end())
+  {
+    return QFuture<void>();
+  }
+
+  return iter->second.m_Build;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImagePyramidCache::getMemoryBudget() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return effectiveMemoryBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImagePyramidCache::effectiveMemoryBudget() const
+{
+  if(m_MemoryBudget > 0)
+  {
+    return m_MemoryBudget;
+  }
+
+  // The levels of a flat image add up to a third of its size.  Half leaves room for
+  // pyramids of tiles that were replaced but are still referenced.  Large montages
+  // are capped so the pyramids cannot grow with the dataset.
+  return std::min(std::max(DefaultMemoryBudget, m_SourceMemorySize / 2), MaximumAutomaticMemoryBudget);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramidCache::setMemoryBudget(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_MemoryBudget = bytes;
+  evictToBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramidCache::setSourceMemorySize(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_SourceMemorySize = bytes;
+  evictToBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImagePyramidCache::getMemoryUsage() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MemoryUsage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramidCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Entries.clear();
+  m_UsageOrder.clear();
+  m_MemoryUsage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramidCache::removeEntry(const vtkDataArray* key)
+{
+  auto iter = m_Entries.find(key);
+  if(iter == m_Entries.end())
+  {
+    return;
+  }
+
+  m_MemoryUsage -= iter->second.m_MemorySize;
+  m_UsageOrder.remove(key);
+  m_Entries.erase(iter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImagePyramidCache::evictToBudget()
+{
+  // Pyramids still being built have no memory counted yet and are left for buildFinished
+  std::vector<const vtkDataArray*> expiredKeys;
+  for(const auto& entry : m_Entries)
+  {
+    if(nullptr == entry.second.m_Scalars && entry.second.m_Build.isFinished())
+    {
+      expiredKeys.push_back(entry.first);
+    }
+  }
+  for(const vtkDataArray* key : expiredKeys)
+  {
+    removeEntry(key);
+  }
+
+  size_t memoryBudget = effectiveMemoryBudget();
+  auto iter = m_UsageOrder.end();
+  while(m_MemoryUsage > memoryBudget && iter != m_UsageOrder.begin())
+  {
+    auto candidate = std::prev(iter);
+    if(candidate == m_UsageOrder.begin())
+    {
+      break;
+    }
+
+    if(false == m_Entries[*candidate].m_Build.isFinished())
+    {
+      iter = candidate;
+      continue;
+    }
+
+    // iter stays valid when removeEntry erases the candidate from the usage order
+    removeEntry(*candidate);
+  }
+}
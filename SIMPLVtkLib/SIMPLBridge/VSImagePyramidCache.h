@@ -0,0 +1,238 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QFuture>
+
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkType.h>
+#include <vtkWeakPointer.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImagePyramid VSImagePyramidCache.h SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.h
+ * @brief This class stores successively halved copies of the scalars a vtkTexture reads
+ * from a vtkImageData.  Each level averages 2x2 blocks of the previous level.  Level 0
+ * is the source image itself and is not stored.
+ */
+class SIMPLVtkLib_EXPORT VSImagePyramid
+{
+public:
+  /**
+   * @brief Prepares a pyramid for the given image's texture scalars.  Call build to
+   * compute the levels.
+   * @param image
+   */
+  VSImagePyramid(vtkImageData* image);
+
+  /**
+   * @brief Computes every level down to a single pixel.  The box filter for each level
+   * runs in parallel.  Safe to call from a worker thread.
+   */
+  void build();
+
+  /**
+   * @brief Returns the number of levels including the source image
+   * @return
+   */
+  int getNumberOfLevels() const;
+
+  /**
+   * @brief Returns the image for the given level.  Levels past the coarsest are clamped.
+   * Level 0 returns nullptr because the source image is not stored.
+   * @param level
+   * @return
+   */
+  VTK_PTR(vtkImageData) getLevel(int level) const;
+
+  /**
+   * @brief Returns the number of bytes used by the stored levels
+   * @return
+   */
+  size_t getMemorySize() const;
+
+  /**
+   * @brief Returns the level whose resolution matches the given subsampling rate
+   * @param sampleRate
+   * @return
+   */
+  static int LevelForSampleRate(int sampleRate);
+
+private:
+  VTK_PTR(vtkDataArray) m_Scalars;
+  int m_Dims[3] = {1, 1, 1};
+  int m_PointDims[3] = {1, 1, 1};
+  double m_Origin[3] = {0.0, 0.0, 0.0};
+  double m_Spacing[3] = {1.0, 1.0, 1.0};
+  bool m_CellScalars = false;
+  std::vector<VTK_PTR(vtkImageData)> m_Levels;
+};
+
+/**
+ * @class VSImagePyramidCache VSImagePyramidCache.h SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.h
+ * @brief This class shares VSImagePyramids between every view of the same image.  Pyramids
+ * are built on a worker thread when first requested and rebuilt when the texture scalars
+ * change.  The least recently used pyramids are evicted when the memory budget is
+ * exceeded.  Evicted levels stay valid for textures still using them.
+ */
+class SIMPLVtkLib_EXPORT VSImagePyramidCache
+{
+public:
+  using PyramidPtr = std::shared_ptr<const VSImagePyramid>;
+
+  /**
+   * @brief Returns the application-wide image pyramid cache
+   * @return
+   */
+  static VSImagePyramidCache* Instance();
+
+  /**
+   * @brief Waits for the pyramids still being built since their builds reference the cache
+   */
+  virtual ~VSImagePyramidCache();
+
+  /**
+   * @brief Returns the pyramid for the given image if it has been built.  Otherwise
+   * starts building it in the background and returns nullptr.
+   * @param image
+   * @return
+   */
+  PyramidPtr getPyramid(vtkImageData* image);
+
+  /**
+   * @brief Returns the future of the build started for the given image by getPyramid
+   * @param image
+   * @return
+   */
+  QFuture<void> getBuildFuture(vtkImageData* image) const;
+
+  /**
+   * @brief Returns the memory budget in bytes
+   * @return
+   */
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Sets the memory budget in bytes and evicts pyramids until the cache fits.
+   * A budget of 0 sizes the budget from the displayed tiles.
+   * @param bytes
+   */
+  void setMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Sets the combined size of the texture scalars of every displayed tile.
+   * Unless a budget has been set, the budget is sized to hold a pyramid for every
+   * tile and is kept between 1 GiB and 4 GiB.
+   * @param bytes
+   */
+  void setSourceMemorySize(size_t bytes);
+
+  /**
+   * @brief Returns the number of bytes used by the built pyramids
+   * @return
+   */
+  size_t getMemoryUsage() const;
+
+  /**
+   * @brief Removes all cached pyramids
+   */
+  void clear();
+
+  /**
+   * @brief Returns the scalars a vtkTexture reads from the given image
+   * @param image
+   * @return
+   */
+  static vtkDataArray* GetTextureScalars(vtkImageData* image);
+
+protected:
+  VSImagePyramidCache();
+
+  /**
+   * @brief Removes the pyramids of deleted scalars and evicts the least recently used
+   * pyramids until the memory usage fits the budget.  The most recently used pyramid
+   * and pyramids still being built are never evicted.
+   */
+  void evictToBudget();
+
+  /**
+   * @brief Returns the budget set by setMemoryBudget or the budget sized from the
+   * displayed tiles if none was set
+   * @return
+   */
+  size_t effectiveMemoryBudget() const;
+
+  /**
+   * @brief Counts the memory of a finished pyramid and evicts pyramids until the
+   * cache fits.  Called on the worker thread that built the pyramid.
+   * @param key
+   * @param pyramid
+   */
+  void buildFinished(const vtkDataArray* key, const VSImagePyramid* pyramid);
+
+private:
+  struct CacheEntry
+  {
+    vtkWeakPointer<vtkDataArray> m_Scalars;
+    vtkMTimeType m_MTime = 0;
+    std::shared_ptr<VSImagePyramid> m_Pyramid;
+    QFuture<void> m_Build;
+    size_t m_MemorySize = 0;
+  };
+
+  /**
+   * @brief Removes the entry for the given key
+   * @param key
+   */
+  void removeEntry(const vtkDataArray* key);
+
+  std::map<const vtkDataArray*, CacheEntry> m_Entries;
+  std::list<const vtkDataArray*> m_UsageOrder;
+  std::vector<QFuture<void>> m_PendingBuilds;
+  size_t m_MemoryBudget = 0;
+  size_t m_SourceMemorySize = 0;
+  size_t m_MemoryUsage = 0;
+  mutable std::mutex m_Mutex;
+};
@@ -42,6 +42,8 @@
 #include <vtkIdTypeArray.h>
 #include <vtkPoints.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h"
+
 const int CELL_TYPE = VTK_QUAD;
 
 // -----------------------------------------------------------------------------
@@ -86,7 +88,7 @@ VSQuadGeom::VSQuadGeom()
 void VSQuadGeom::SetGeometry(QuadGeom::Pointer geom)
 {
   m_Geom = geom;
-  m_Geom->findElementsContainingVert();
+  m_CellLinks.reset();
 }
 
 // -----------------------------------------------------------------------------
@@ -138,15 +140,32 @@ void VSQuadGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSQuadGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
+  if(ptId < 0 || ptId >= static_cast<vtkIdType>(m_Geom->getNumberOfVertices()))
+  {
+    cellIds->Reset();
+    return;
+  }
 
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
+  // The links are shared with every wrapper of this geometry through the cache.  Only a
+  // weak reference is kept so evicted links are freed once no lookup is using them.
+  VSCellLinksCache::CellLinksPtr cellLinks;
+  {
+    std::lock_guard<std::mutex> lock(m_CellLinksMutex);
+    cellLinks = m_CellLinks.lock();
+    if(nullptr == cellLinks)
+    {
+      cellLinks = VSCellLinksCache::Instance()->getCellLinks(m_Geom->getQuads(), m_Geom->getNumberOfVertices(), 4);
+      m_CellLinks = cellLinks;
+    }
+  }
 
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == cellLinks)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->Reset();
+    return;
   }
+
+  cellLinks->getCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
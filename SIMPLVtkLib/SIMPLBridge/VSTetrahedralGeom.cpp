@@ -41,6 +41,8 @@
 #include <vtkIdTypeArray.h>
 #include <vtkPoints.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -83,6 +85,7 @@ VSTetrahedralGeom::VSTetrahedralGeom()
 void VSTetrahedralGeom::SetGeometry(TetrahedralGeom::Pointer geom)
 {
   m_Geom = geom;
+  m_CellLinks.reset();
 }
 
 // -----------------------------------------------------------------------------
@@ -134,15 +137,32 @@ void VSTetrahedralGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSTetrahedralGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
+  if(ptId < 0 || ptId >= static_cast<vtkIdType>(m_Geom->getNumberOfVertices()))
+  {
+    cellIds->Reset();
+    return;
+  }
 
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
+  // The links are shared with every wrapper of this geometry through the cache.  Only a
+  // weak reference is kept so evicted links are freed once no lookup is using them.
+  VSCellLinksCache::CellLinksPtr cellLinks;
+  {
+    std::lock_guard<std::mutex> lock(m_CellLinksMutex);
+    cellLinks = m_CellLinks.lock();
+    if(nullptr == cellLinks)
+    {
+      cellLinks = VSCellLinksCache::Instance()->getCellLinks(m_Geom->getTetrahedra(), m_Geom->getNumberOfVertices(), 4);
+      m_CellLinks = cellLinks;
+    }
+  }
 
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == cellLinks)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->Reset();
+    return;
   }
+
+  cellLinks->getCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -35,12 +35,16 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include <vtkCellType.h>
 #include <vtkIdTypeArray.h>
 #include <vtkMappedUnstructuredGrid.h>
 
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
 
+#include "SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h"
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 /**
@@ -161,6 +165,8 @@ protected:
 private:
   TetrahedralGeom::Pointer m_Geom = nullptr;
   float m_MaxCellSize = 0.0f;
+  std::weak_ptr<const VSCellLinks> m_CellLinks;
+  std::mutex m_CellLinksMutex;
 
   const int CELL_TYPE = VTK_TETRA;
 };
@@ -41,6 +41,8 @@
 #include <vtkCellTypes.h>
 #include <vtkIdTypeArray.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h"
+
 const int CELL_TYPE = VTK_TRIANGLE;
 
 // -----------------------------------------------------------------------------
@@ -86,7 +88,7 @@ VSTriangleGeom::VSTriangleGeom()
 void VSTriangleGeom::SetGeometry(TriangleGeom::Pointer geom)
 {
   m_Geom = geom;
-  geom->findElementsContainingVert();
+  m_CellLinks.reset();
   geom->findElementSizes();
 }
 
@@ -139,15 +141,32 @@ void VSTriangleGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSTriangleGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
+  if(ptId < 0 || ptId >= static_cast<vtkIdType>(m_Geom->getNumberOfVertices()))
+  {
+    cellIds->Reset();
+    return;
+  }
 
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
+  // The links are shared with every wrapper of this geometry through the cache.  Only a
+  // weak reference is kept so evicted links are freed once no lookup is using them.
+  VSCellLinksCache::CellLinksPtr cellLinks;
+  {
+    std::lock_guard<std::mutex> lock(m_CellLinksMutex);
+    cellLinks = m_CellLinks.lock();
+    if(nullptr == cellLinks)
+    {
+      cellLinks = VSCellLinksCache::Instance()->getCellLinks(m_Geom->getTriangles(), m_Geom->getNumberOfVertices(), 3);
+      m_CellLinks = cellLinks;
+    }
+  }
 
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == cellLinks)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->Reset();
+    return;
   }
+
+  cellLinks->getCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -35,11 +35,15 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include <vtkIdTypeArray.h>
 #include <vtkMappedUnstructuredGrid.h>
 
 #include "SIMPLib/Geometry/TriangleGeom.h"
 
+#include "SIMPLVtkLib/SIMPLBridge/VSCellLinksCache.h"
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 /**
@@ -160,6 +164,8 @@ protected:
 private:
   TriangleGeom::Pointer m_Geom = nullptr;
   float m_MaxCellSize = 0.0f;
+  std::weak_ptr<const VSCellLinks> m_CellLinks;
+  std::mutex m_CellLinksMutex;
 };
 
 vtkMakeMappedUnstructuredGrid(VtkTriangleGrid, VSTriangleGeom)
@@ -130,13 +130,9 @@ void VSVertexGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSVertexGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  // No implementation in VertexGeom
-  int count = m_Geom->getVertices()->getNumberOfTuples();
-
-  for(int i = 0; i < count; i++)
-  {
-    cellIds->SetId(i, i);
-  }
+  // Each vertex cell only uses the point with the same ID
+  cellIds->SetNumberOfIds(1);
+  cellIds->SetId(0, ptId);
 }
 
 // -----------------------------------------------------------------------------
@@ -35,9 +35,12 @@
 
 #include "VSConcurrentImport.h"
 
+#include <algorithm>
+
 #include <QtConcurrent>
-#include <QtCore/QFutureWatcher>
+#include <QtCore/QThread>
 
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
@@ -48,33 +51,42 @@
 VSConcurrentImport::VSConcurrentImport(VSController* controller)
 : QObject(controller)
 , m_Controller(controller)
-, m_ImportDataContainerOrderLock(1)
-, m_UnappliedDataFilterLock(1)
-, m_AppliedDataFilterLock(1)
-, m_FilterLock(1)
-, m_WrappedDcLock(1)
-, m_PartialWrappingThreadCountLock(1)
-, m_AppliedThreadCountLock(1)
-, m_AppliedFilterCountLock(1)
+, m_TasksRemaining(0)
+, m_AppliedFilterCount(0)
 {
   if(controller && controller->getFilterModel())
   {
     connect(this, SIGNAL(importedFilter(VSAbstractFilter*, bool)), controller->getFilterModel(), SLOT(addFilter(VSAbstractFilter*, bool)));
   }
 
-  connect(this, SIGNAL(finishedPartialWrapping()), this, SLOT(partialWrappingThreadFinished()));
-  connect(this, SIGNAL(finishedApplying()), this, SLOT(applyDataFiltersThreadFinished()));
+  // Worker threads emit these signals, so the slots are always queued to the main thread
+  connect(this, SIGNAL(dataContainerWrapped(int)), this, SLOT(createWrappedFilters(int)), Qt::QueuedConnection);
+  connect(this, SIGNAL(finishedApplying()), this, SLOT(importFinished()), Qt::QueuedConnection);
 
-  int threadsUsed = 2;
-  m_ThreadCount = QThreadPool::globalInstance()->maxThreadCount();
-  if(m_ThreadCount > threadsUsed)
-  {
-    m_ThreadCount -= threadsUsed;
-  }
-  else
-  {
-    m_ThreadCount = 1;
-  }
+  // The import runs in its own pool so idle workers never block QtConcurrent tasks
+  // on the global pool.  The main thread only creates filters and does not need a core.
+  m_ThreadCount = std::max(QThread::idealThreadCount(), 1);
+  m_ThreadPool.setMaxThreadCount(m_ThreadCount);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSConcurrentImport::~VSConcurrentImport()
+{
+  m_TasksRemaining = 0;
+  m_IdleCondition.wakeAll();
+  m_ThreadPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMutex* VSConcurrentImport::HDF5Mutex()
+{
+  // Reloading a data container opens its file again while the file is still open
+  static QMutex mutex(QMutex::Recursive);
+  return &mutex;
 }
 
 // -----------------------------------------------------------------------------
@@ -124,202 +136,274 @@ void VSConcurrentImport::addDataContainerArray(DcaGenericPair fileDcPair)
 // -----------------------------------------------------------------------------
 void VSConcurrentImport::run()
 {
-  while(m_WrappedList.size() > 0)
+  if(m_Importing || m_WrappedList.empty())
   {
-    DcaGenericPair filePair = m_WrappedList.front();
-    importDataContainerArray(filePair);
-
-    m_WrappedList.pop_front();
+    return;
   }
+
+  // DataContainers from every queued item share the same task pool so that many
+  // small files keep every worker busy the same way a single large file does.
+  std::list<DcaGenericPair> dcaPairs;
+  dcaPairs.swap(m_WrappedList);
+
+  importDataContainerArrays(dcaPairs);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::importDataContainerArray(DcaGenericPair genericPair)
+void VSConcurrentImport::importDataContainerArrays(std::list<DcaGenericPair> dcaPairs)
 {
-  m_DataParentFilter = genericPair.first;
-  DataContainerArray::Pointer dca = genericPair.second;
-
+  VS_TRACE_SCOPE("Import", "Queue Import Tasks");
   VSFilterModel* filterModel = m_Controller->getFilterModel();
 
-  auto currentFilters = filterModel->getAllFilters();
-  bool parentFilterFound = (std::find(currentFilters.begin(), currentFilters.end(), m_DataParentFilter) != currentFilters.end());
-  if(!parentFilterFound)
+  m_ImportFiles.clear();
+  m_ImportTasks.clear();
+
+  for(const DcaGenericPair& genericPair : dcaPairs)
   {
-    filterModel->addFilter(m_DataParentFilter);
-  }
+    VSTextFilter* parentFilter = genericPair.first;
+    auto currentFilters = filterModel->getAllFilters();
+    bool parentFilterFound = (std::find(currentFilters.begin(), currentFilters.end(), parentFilter) != currentFilters.end());
+    if(!parentFilterFound)
+    {
+      filterModel->addFilter(parentFilter);
+    }
+
+    ImportFile importFile;
+    importFile.m_ParentFilter = parentFilter;
+    importFile.m_FirstTaskId = static_cast<int>(m_ImportTasks.size());
+    importFile.m_NextFilterTaskId = importFile.m_FirstTaskId;
+
+    DataContainerArray::Container dcs = genericPair.second->getDataContainers();
+    for(DataContainer::Pointer dc : dcs)
+    {
+      ImportTask importTask;
+      importTask.m_FileIndex = static_cast<int>(m_ImportFiles.size());
+      importTask.m_DataContainer = dc;
+      m_ImportTasks.push_back(importTask);
+    }
 
-  m_ImportDataContainerQueue = dca->getDataContainers();
+    importFile.m_TaskCount = static_cast<int>(dcs.size());
+    m_ImportFiles.push_back(importFile);
+  }
 
-  for(int i = 0; i < m_ImportDataContainerQueue.size(); i++)
+  // Task IDs [0, count) wrap the DataContainer geometry and task IDs [count, 2 * count)
+  // apply the VSSIMPLDataContainerFilter created for the same DataContainer.
+  int dcCount = static_cast<int>(m_ImportTasks.size());
+  if(dcCount == 0)
   {
-    DataContainer::Pointer dc = m_ImportDataContainerQueue[i];
-    m_DataContainerIndexMap.insert(dc, i);
+    m_ImportFiles.clear();
+    run();
+    return;
   }
 
-  m_WrappedDataContainers.resize(m_ImportDataContainerQueue.size());
-  m_UnappliedDataFilters.resize(m_ImportDataContainerQueue.size());
-  m_AppliedDataFilters.resize(m_ImportDataContainerQueue.size());
+  m_Importing = true;
+  m_TasksRemaining = 2 * dcCount;
+  m_AppliedFilterCount = 0;
+  m_FiltersRemaining = dcCount;
 
   emit blockRender(true);
+  emit applyingDataFilters(dcCount);
 
-  // Wait for the filter lock
-  m_FilterLock.acquire();
-
-  m_PartialWrappingThreadCountLock.acquire();
-  m_PartialWrappingThreadsRemaining = m_ThreadCount;
-  m_PartialWrappingThreadCountLock.release();
-  m_AppliedThreadCountLock.acquire();
-  m_AppliedThreadsRemaining = m_ThreadCount;
-  m_AppliedThreadCountLock.release();
+  // Deal the wrapping tasks round-robin and push them in reverse so that each worker
+  // pops its DataContainers in order and filters can be created as early as possible.
+  int workerCount = std::min(m_ThreadCount, dcCount);
+  m_WorkerQueues.resize(workerCount);
+  for(int i = 0; i < workerCount; i++)
+  {
+    size_t capacity = static_cast<size_t>((dcCount - i + workerCount - 1) / workerCount);
+    if(nullptr == m_WorkerQueues[i])
+    {
+      m_WorkerQueues[i] = std::unique_ptr<VSWorkStealingQueue>(new VSWorkStealingQueue(capacity));
+    }
+    else
+    {
+      m_WorkerQueues[i]->reset(capacity);
+    }
+  }
+  for(int taskId = dcCount - 1; taskId >= 0; taskId--)
+  {
+    m_WorkerQueues[taskId % workerCount]->push(taskId);
+  }
+  m_SubmittedQueue.reset(static_cast<size_t>(dcCount));
 
-  for(int i = 0; i < m_ThreadCount; i++)
+  for(int i = 0; i < workerCount; i++)
   {
-    QtConcurrent::run(this, &VSConcurrentImport::wrapDataContainer);
+    QtConcurrent::run(&m_ThreadPool, this, &VSConcurrentImport::processTasks, i);
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::partialWrappingThreadFinished()
+void VSConcurrentImport::processTasks(int workerIndex)
 {
-  // Threads remaining lock
-  m_PartialWrappingThreadCountLock.acquire();
-  m_PartialWrappingThreadsRemaining--;
-  if(m_PartialWrappingThreadsRemaining <= 0)
+  while(m_TasksRemaining > 0)
   {
-    m_PartialWrappingThreadCountLock.release();
-
-    for(SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc : m_WrappedDataContainers)
+    int taskId;
+    if(findTask(workerIndex, taskId))
     {
-      VSSIMPLDataContainerFilter* filter = new VSSIMPLDataContainerFilter(wrappedDc, m_DataParentFilter);
-      DataContainer::Pointer dataContainer = wrappedDc->m_DataContainer;
-      ImageGeom::Pointer imageGeom = dataContainer->getGeometryAs<ImageGeom>();
-      FloatVec3Type originTuple = imageGeom->getOrigin();
-      double origin[3];
-      origin[0] = originTuple[0];
-      origin[1] = originTuple[1];
-      origin[2] = originTuple[2];
-
-      filter->getTransform()->setLocalPosition(origin);
-      filter->getTransform()->setOriginPosition(origin);
-
-      // Attempting to run applyDataFilters requires the QSemaphore to lock when modifying this vector
-      m_UnappliedDataFilterLock.acquire();
-      int index = m_DataContainerIndexMap.value(filter->getWrappedDataContainer()->m_DataContainer);
-      m_UnappliedDataFilters[index] = filter;
-      m_UnappliedDataFilterLock.release();
+      int dcCount = static_cast<int>(m_ImportTasks.size());
+      if(taskId < dcCount)
+      {
+        wrapDataContainer(taskId);
+      }
+      else
+      {
+        applyDataFilter(taskId - dcCount);
+      }
+      continue;
     }
 
-    m_AppliedFilterCountLock.acquire();
-    m_AppliedFilterCount = 0;
-    m_AppliedFilterCountLock.release();
-    m_WrappedDataContainers.clear();
-    emit blockRender(false);
-    m_FilterLock.release();
-
-    m_UnappliedDataFilterLock.acquire();
-    emit applyingDataFilters(m_UnappliedDataFilters.size());
-    m_UnappliedDataFilterLock.release();
-
-    // Apply the filters only after all DataContainers for all files have been wrapped
-    if(m_WrappedList.size() == 0)
+    // Wait for the main thread to submit filters that are ready to be applied
+    VS_TRACE_SCOPE("Import", "Idle");
+    m_IdleMutex.lock();
+    if(m_TasksRemaining > 0)
     {
-      // Apply filters on multiple threads
-      for(int i = 0; i < m_ThreadCount; i++)
-      {
-        QFuture<void> future = QtConcurrent::run(this, &VSConcurrentImport::applyDataFilters);
-      }
+      m_IdleCondition.wait(&m_IdleMutex, 5);
     }
+    m_IdleMutex.unlock();
   }
-  m_PartialWrappingThreadCountLock.release();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::wrapDataContainer()
+bool VSConcurrentImport::findTask(int workerIndex, int& taskId)
 {
-  m_ImportDataContainerOrderLock.acquire();
-  while(m_ImportDataContainerQueue.size() > 0)
+  if(m_SubmittedQueue.steal(taskId))
+  {
+    return true;
+  }
+  if(m_WorkerQueues[workerIndex]->pop(taskId))
   {
-    DataContainer::Pointer dc = m_ImportDataContainerQueue.front();
-    m_ImportDataContainerQueue.erase(m_ImportDataContainerQueue.begin());
-    m_ImportDataContainerOrderLock.release();
+    return true;
+  }
 
-    SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = SIMPLVtkBridge::WrapGeometryPtr(dc);
-    if(wrappedDc)
+  int workerCount = static_cast<int>(m_WorkerQueues.size());
+  for(int i = 1; i < workerCount; i++)
+  {
+    if(m_WorkerQueues[(workerIndex + i) % workerCount]->steal(taskId))
     {
-      m_WrappedDcLock.acquire();
-      int index = m_DataContainerIndexMap.value(dc);
-      m_WrappedDataContainers[index] = wrappedDc;
-      m_WrappedDcLock.release();
+      return true;
     }
-
-    // Lock the semaphore before the while loop checks
-    m_ImportDataContainerOrderLock.acquire();
   }
-  m_ImportDataContainerOrderLock.release();
 
-  emit finishedPartialWrapping();
+  return false;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::applyDataFilters()
+void VSConcurrentImport::wrapDataContainer(int taskId)
 {
-  m_UnappliedDataFilterLock.acquire();
-  while(m_UnappliedDataFilters.size() > 0)
+  VS_TRACE_SCOPE("Import", "Wrap DataContainer Task");
+  ImportTask& importTask = m_ImportTasks[taskId];
+  importTask.m_WrappedDataContainer = SIMPLVtkBridge::WrapGeometryPtr(importTask.m_DataContainer);
+
+  emit dataContainerWrapped(taskId);
+  completeTask();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSConcurrentImport::createWrappedFilters(int taskId)
+{
+  m_ImportTasks[taskId].m_Wrapped = true;
+
+  // Filters are created in DataContainer order to keep the filter model ordered
+  ImportFile& importFile = m_ImportFiles[m_ImportTasks[taskId].m_FileIndex];
+  int lastTaskId = importFile.m_FirstTaskId + importFile.m_TaskCount;
+  while(importFile.m_NextFilterTaskId < lastTaskId && m_ImportTasks[importFile.m_NextFilterTaskId].m_Wrapped)
   {
-    VSSIMPLDataContainerFilter* filter = m_UnappliedDataFilters.front();
-    m_UnappliedDataFilters.erase(m_UnappliedDataFilters.begin());
-    m_UnappliedDataFilterLock.release();
+    createDataFilter(importFile.m_NextFilterTaskId);
+    importFile.m_NextFilterTaskId++;
+  }
+}
 
-    filter->finishWrapping();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSConcurrentImport::createDataFilter(int taskId)
+{
+  VS_TRACE_SCOPE("Import", "Create Data Filter");
+  ImportTask& importTask = m_ImportTasks[taskId];
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = importTask.m_WrappedDataContainer;
+  if(wrappedDc)
+  {
+    VSSIMPLDataContainerFilter* filter = new VSSIMPLDataContainerFilter(wrappedDc, m_ImportFiles[importTask.m_FileIndex].m_ParentFilter);
+    DataContainer::Pointer dataContainer = wrappedDc->m_DataContainer;
+    ImageGeom::Pointer imageGeom = dataContainer->getGeometryAs<ImageGeom>();
+    if(imageGeom)
+    {
+      FloatVec3Type originTuple = imageGeom->getOrigin();
+      double origin[3];
+      origin[0] = originTuple[0];
+      origin[1] = originTuple[1];
+      origin[2] = originTuple[2];
 
-    m_AppliedFilterCountLock.acquire();
-    emit dataFilterApplied(++m_AppliedFilterCount);
-    m_AppliedFilterCountLock.release();
+      filter->getTransform()->setLocalPosition(origin);
+      filter->getTransform()->setOriginPosition(origin);
+    }
 
-    m_AppliedDataFilterLock.acquire();
-    int index = m_DataContainerIndexMap.value(filter->getWrappedDataContainer()->m_DataContainer);
-    m_AppliedDataFilters[index] = filter;
-    m_AppliedDataFilterLock.release();
+    importTask.m_Filter = filter;
+    m_SubmittedQueue.push(static_cast<int>(m_ImportTasks.size()) + taskId);
+    m_IdleCondition.wakeAll();
+  }
+  else
+  {
+    // Nothing to apply for DataContainers that could not be wrapped
+    emit dataFilterApplied(++m_AppliedFilterCount);
+    completeTask();
+  }
 
-    // Lock semaphore before the while statement is checked again
-    m_UnappliedDataFilterLock.acquire();
+  m_FiltersRemaining--;
+  if(m_FiltersRemaining <= 0)
+  {
+    emit blockRender(false);
   }
-  m_UnappliedDataFilterLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSConcurrentImport::applyDataFilter(int taskId)
+{
+  VS_TRACE_SCOPE("Import", "Apply Data Filter Task");
+  m_ImportTasks[taskId].m_Filter->finishWrapping();
 
-  emit finishedApplying();
+  emit dataFilterApplied(++m_AppliedFilterCount);
+  completeTask();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::applyDataFiltersThreadFinished()
+void VSConcurrentImport::completeTask()
 {
-  // Threads remaining lock
-  m_AppliedThreadCountLock.acquire();
-  m_AppliedThreadsRemaining--;
-  if(m_AppliedThreadsRemaining <= 0)
+  if(m_TasksRemaining.fetch_sub(1) == 1)
   {
-    m_AppliedThreadCountLock.release();
+    m_IdleCondition.wakeAll();
+    emit finishedApplying();
+  }
+}
 
-    for(VSSIMPLDataContainerFilter* filter : m_AppliedDataFilters)
-    {
-      auto currentFilters = m_Controller->getFilterModel()->getAllFilters();
-      bool filterFound = (std::find(currentFilters.begin(), currentFilters.end(), m_DataParentFilter) != currentFilters.end());
-      if(!filterFound)
-      {
-        m_Controller->getFilterModel()->addFilter(filter, false);
-      }
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSConcurrentImport::importFinished()
+{
+  // Workers exit as soon as no tasks remain
+  m_ThreadPool.waitForDone();
 
-    m_AppliedDataFilters.clear();
-  }
-  m_AppliedThreadCountLock.release();
+  m_ImportFiles.clear();
+  m_ImportTasks.clear();
+  m_Importing = false;
+
+  // Write the trace after each import so production imports can be profiled
+  VS_TRACE_EXPORT();
+
+  run();
 }
@@ -35,16 +35,20 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
+#include <memory>
 #include <utility>
+#include <vector>
 
-#include <QtCore/QFutureWatcher>
-#include <QtCore/QSemaphore>
-#include <QtCore/QThread>
+#include <QtCore/QMutex>
+#include <QtCore/QThreadPool>
+#include <QtCore/QWaitCondition>
 
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSWorkStealingQueue.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSPipelineFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
@@ -54,6 +58,12 @@ class VSController;
 /**
  * @class VSConcurrentImport VSConcurrentImport.h SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h
  * @brief This class handles the multithreaded import process for VSSIMPLDataContainerFilters.
+ * Importing a DataContainer is split into two tasks.  The wrapping task creates the
+ * vtkDataSet for the DataContainer's geometry and the apply task finishes wrapping
+ * the DataContainer's arrays.  Both tasks are run by the same set of worker threads,
+ * each with its own VSWorkStealingQueue.  Filters are created on the main thread as
+ * soon as every DataContainer before them in the same file has been wrapped, and their apply tasks
+ * are scheduled immediately instead of waiting for every DataContainer to be wrapped.
  */
 class SIMPLVtkLib_EXPORT VSConcurrentImport : public QObject
 {
@@ -71,7 +81,7 @@ public:
   /**
    * @brief Deconstructor
    */
-  virtual ~VSConcurrentImport() = default;
+  virtual ~VSConcurrentImport();
 
   /**
    * @brief Add a DataContainerArray from the given FilterPipeline to the list of items to import
@@ -103,29 +113,42 @@ public:
 
   /**
    * @brief Performs the import process on as many threads as are available.
-   * This process is performed one file path at a time, meaning that many small files will
-   * be slower to import than a single large file if the amount of data is the same.
+   * The DataContainers from every queued item are imported together in a single
+   * task pool while filters are still added to the filter model in order for each item.
+   * Items added while an import is running are imported once it finishes.
    */
   void run();
 
+  /**
+   * @brief Returns the mutex that serializes HDF5 access.  The HDF5 library is not
+   * built thread-safe, so files read for an import and regions read by filters on
+   * worker threads must hold this mutex while calling into HDF5.  The mutex is
+   * recursive.
+   * @return
+   */
+  static QMutex* HDF5Mutex();
+
 signals:
   void importedFilter(VSAbstractFilter* filter, bool currentFilter = false);
   void blockRender(bool block = true);
   void applyingDataFilters(int count);
   void dataFilterApplied(int num);
-  void finishedPartialWrapping();
+  void dataContainerWrapped(int taskId);
   void finishedApplying();
 
 protected slots:
   /**
-   * @brief partialWrappingThreadFinished
+   * @brief Creates the filters for every DataContainer that has been wrapped along with
+   * every DataContainer before it in the same file.  This is called on the main thread.
+   * @param taskId
    */
-  void partialWrappingThreadFinished();
+  void createWrappedFilters(int taskId);
 
   /**
-   * @brief applyDataFiltersThreadFinished
+   * @brief Cleans up after the last task is completed and starts importing any items
+   * added since the import began.
    */
-  void applyDataFiltersThreadFinished();
+  void importFinished();
 
 protected:
   /**
@@ -135,42 +158,83 @@ protected:
   void addDataContainerArray(DcaGenericPair wrappedInputDc);
 
   /**
-   * @brief Begins importing the given DataContainerArray and parent filter pair
-   * @param dcaPair
+   * @brief Prepares the tasks for the given DataContainerArray and parent filter pairs
+   * and starts the worker threads
+   * @param dcaPairs
+   */
+  void importDataContainerArrays(std::list<DcaGenericPair> dcaPairs);
+
+  /**
+   * @brief Runs import tasks on a worker thread until every task has been completed
+   * @param workerIndex
+   */
+  void processTasks(int workerIndex);
+
+  /**
+   * @brief Finds the next task for the given worker.  Tasks submitted from the main
+   * thread are checked first, followed by the worker's own queue, before attempting
+   * to steal from another worker.  Returns false if no task was found.
+   * @param workerIndex
+   * @param taskId
+   * @return
+   */
+  bool findTask(int workerIndex, int& taskId);
+
+  /**
+   * @brief Wraps the geometry of the DataContainer for the given task
+   * @param taskId
    */
-  void importDataContainerArray(DcaGenericPair dcaPair);
+  void wrapDataContainer(int taskId);
 
   /**
-   * @brief Wraps the DataContainers in vtkDataSets and prepares to add the generated filters to the filter model
+   * @brief Finishes wrapping the VSSIMPLDataContainerFilter for the given task
+   * @param taskId
    */
-  void wrapDataContainer();
+  void applyDataFilter(int taskId);
 
   /**
-   * @brief Applies the unapplied DataContainer filters to finish the import process.
+   * @brief Creates the VSSIMPLDataContainerFilter for the given task and schedules it to be applied
+   * @param taskId
    */
-  void applyDataFilters();
+  void createDataFilter(int taskId);
+
+  /**
+   * @brief Marks a task as completed and emits finishedApplying() when no tasks remain
+   */
+  void completeTask();
 
 private:
+  struct ImportFile
+  {
+    VSTextFilter* m_ParentFilter = nullptr;
+    int m_FirstTaskId = 0;
+    int m_TaskCount = 0;
+    int m_NextFilterTaskId = 0;
+  };
+
+  struct ImportTask
+  {
+    int m_FileIndex = 0;
+    DataContainer::Pointer m_DataContainer = nullptr;
+    SIMPLVtkBridge::WrappedDataContainerPtr m_WrappedDataContainer = nullptr;
+    VSSIMPLDataContainerFilter* m_Filter = nullptr;
+    bool m_Wrapped = false;
+  };
+
   VSController* m_Controller;
   std::list<DcaGenericPair> m_WrappedList;
-  std::vector<VSSIMPLDataContainerFilter*> m_UnappliedDataFilters;
-  std::vector<VSSIMPLDataContainerFilter*> m_AppliedDataFilters;
-
-  DataContainerArray::Container m_ImportDataContainerQueue;
-  QMap<DataContainer::Pointer, int> m_DataContainerIndexMap;
-  QSemaphore m_ImportDataContainerOrderLock;
-  QSemaphore m_UnappliedDataFilterLock;
-  QSemaphore m_AppliedDataFilterLock;
-  QSemaphore m_FilterLock;
-  QSemaphore m_WrappedDcLock;
-  QSemaphore m_PartialWrappingThreadCountLock;
-  QSemaphore m_AppliedThreadCountLock;
-  QSemaphore m_AppliedFilterCountLock;
-  int m_NumOfFinishedImportDataContainerThreads = 0;
-  std::vector<SIMPLVtkBridge::WrappedDataContainerPtr> m_WrappedDataContainers;
-  VSTextFilter* m_DataParentFilter = nullptr;
+  bool m_Importing = false;
+
+  std::vector<ImportFile> m_ImportFiles;
+  std::vector<ImportTask> m_ImportTasks;
+  std::vector<std::unique_ptr<VSWorkStealingQueue>> m_WorkerQueues;
+  VSWorkStealingQueue m_SubmittedQueue;
+  std::atomic<int> m_TasksRemaining;
+  std::atomic<int> m_AppliedFilterCount;
+  int m_FiltersRemaining = 0;
+
+  QThreadPool m_ThreadPool;
+  QMutex m_IdleMutex;
+  QWaitCondition m_IdleCondition;
   int m_ThreadCount;
-  int m_AppliedThreadsRemaining = 0;
-  int m_PartialWrappingThreadsRemaining = 0;
-  int m_AppliedFilterCount = 0;
 };
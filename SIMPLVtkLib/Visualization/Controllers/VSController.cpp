@@ -55,6 +55,7 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSRootFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceFilter.h"
@@ -289,7 +290,7 @@ bool VSController::saveAsDREAM3D(const QString& outputFilePath, VSAbstractFilter
         DataContainer::Pointer dataContainer = dcFilter->getWrappedDataContainer()->m_DataContainer;
         if(dataContainer != nullptr)
         {
-          double* pos = dcFilter->getTransform()->getLocalPosition();
+          std::array<double, 3> pos = dcFilter->getTransform()->getLocalPosition();
           ImageGeom::Pointer geom = dataContainer->getGeometryAs<ImageGeom>();
           geom->setOrigin(pos[0], pos[1], pos[2]);
           dca->addOrReplaceDataContainer(dataContainer);
@@ -402,6 +403,10 @@ void VSController::loadFilter(QJsonObject& obj, VSAbstractFilter* parentFilter)
   {
     newFilter = VSMaskFilter::Create(obj, parentFilter);
   }
+  else if(uuid == VSOrthoSliceFilter::GetUuid())
+  {
+    newFilter = VSOrthoSliceFilter::Create(obj, parentFilter);
+  }
   else if(uuid == VSSIMPLDataContainerFilter::GetUuid())
   {
     if(dynamic_cast<VSFileNameFilter*>(parentFilter) != nullptr)
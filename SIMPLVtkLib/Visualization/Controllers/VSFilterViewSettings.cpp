@@ -35,29 +35,111 @@
 
 #include "VSFilterViewSettings.h"
 
+#include <algorithm>
+
 #include <QtWidgets/QColorDialog>
 #include <QtWidgets/QInputDialog>
 
 #include <vtkAbstractArray.h>
 #include <vtkActor.h>
+#include <vtkAlgorithm.h>
+#include <vtkAlgorithmOutput.h>
 #include <vtkCellData.h>
 #include <vtkColorTransferFunction.h>
 #include <vtkDataSetMapper.h>
-#include <vtkExtractVOI.h>
 #include <vtkImageActor.h>
+#include <vtkImageAlgorithm.h>
 #include <vtkImageData.h>
+#include <vtkImageExtractComponents.h>
+#include <vtkImageMagnitude.h>
 #include <vtkImageProperty.h>
 #include <vtkImageSliceMapper.h>
 #include <vtkMapper.h>
+#include <vtkMatrix4x4.h>
 #include <vtkPlaneSource.h>
 #include <vtkPointData.h>
 #include <vtkProperty.h>
 #include <vtkTextProperty.h>
 #include <vtkTexture.h>
+#include <vtkTransform.h>
+#include <vtkVolumeProperty.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSOutputMemoryPolicy.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
 
+namespace
+{
+/**
+ * @brief Spans the plane source across the corners of the flat image in index space
+ * @param plane
+ * @param imageData
+ */
+void placeSliceQuad(vtkPlaneSource* plane, vtkImageData* imageData)
+{
+  int extent[6];
+  imageData->GetExtent(extent);
+  int axes[2];
+  int numAxes = 0;
+  for(int i = 0; i < 3 && numAxes < 2; i++)
+  {
+    if(extent[2 * i + 1] > extent[2 * i])
+    {
+      axes[numAxes++] = i;
+    }
+  }
+
+  double corners[3][3];
+  for(int corner = 0; corner < 3; corner++)
+  {
+    double index[3] = {static_cast<double>(extent[0]), static_cast<double>(extent[2]), static_cast<double>(extent[4])};
+    if(corner > 0)
+    {
+      int axis = axes[corner - 1];
+      index[axis] = extent[2 * axis + 1];
+    }
+#if VTK_MAJOR_VERSION >= 9
+    imageData->TransformContinuousIndexToPhysicalPoint(index, corners[corner]);
+#else
+    for(int i = 0; i < 3; i++)
+    {
+      corners[corner][i] = imageData->GetOrigin()[i] + index[i] * imageData->GetSpacing()[i];
+    }
+#endif
+  }
+
+  plane->SetOrigin(corners[0]);
+  plane->SetPoint1(corners[1]);
+  plane->SetPoint2(corners[2]);
+  plane->SetResolution(1, 1);
+}
+
+/**
+ * @brief Returns true if the texture already draws the scalars of the given image
+ * @param texture
+ * @param textureImage
+ * @return
+ */
+bool isTextureInput(vtkTexture* texture, vtkImageData* textureImage)
+{
+  vtkImageData* currentImage = texture ? vtkImageData::SafeDownCast(texture->GetInputDataObject(0, 0)) : nullptr;
+  if(nullptr == currentImage || nullptr == textureImage)
+  {
+    return false;
+  }
+
+  int currentDims[3];
+  int dims[3];
+  currentImage->GetDimensions(currentDims);
+  textureImage->GetDimensions(dims);
+  return std::equal(dims, dims + 3, currentDims) && currentImage->GetPointData()->GetScalars() == textureImage->GetPointData()->GetScalars();
+}
+} // namespace
+
 double* VSFilterViewSettings::NULL_COLOR = new double[3]{0.0, 0.0, 0.0};
 QIcon* VSFilterViewSettings::s_SolidColorIcon = nullptr;
 QIcon* VSFilterViewSettings::s_CellDataIcon = nullptr;
@@ -83,6 +165,7 @@ VSFilterViewSettings::VSFilterViewSettings(VSAbstractFilter* filter, Representat
 : QObject(nullptr)
 , m_ShowFilter(true)
 , m_DisplayType(displayType)
+, m_RenderedByMontage(AbstractImportMontageDialog::DisplayType::Montage == displayType)
 , m_Representation(representation)
 {
   SetupStaticIcons();
@@ -95,6 +178,7 @@ VSFilterViewSettings::VSFilterViewSettings(VSAbstractFilter* filter, Representat
   {
     connect(filter, SIGNAL(updatedOutputPort(VSAbstractFilter*)), this, SLOT(inputUpdated(VSAbstractFilter*)));
   }
+  updateOutputRetention();
 }
 
 // -----------------------------------------------------------------------------
@@ -134,6 +218,7 @@ VSFilterViewSettings::VSFilterViewSettings(const VSFilterViewSettings& copy)
       m_LookupTable->copy(*(copy.m_LookupTable));
     }
   }
+  updateOutputRetention();
 }
 
 // -----------------------------------------------------------------------------
@@ -141,6 +226,12 @@ VSFilterViewSettings::VSFilterViewSettings(const VSFilterViewSettings& copy)
 // -----------------------------------------------------------------------------
 VSFilterViewSettings::~VSFilterViewSettings()
 {
+  if(m_RetainedFilter)
+  {
+    VSOutputMemoryPolicy::Instance()->unpinOutput(m_RetainedFilter);
+    m_RetainedFilter = nullptr;
+  }
+
   if(m_LookupTable)
   {
     delete m_LookupTable;
@@ -236,7 +327,8 @@ bool VSFilterViewSettings::isValid() const
     return false;
   }
 
-  bool valid = m_Mapper && m_Actor;
+  // Montage tiles are valid without actors of their own
+  bool valid = (m_Mapper && m_Actor) || isRenderedByMontage();
   return valid;
 }
 
@@ -318,6 +410,45 @@ int VSFilterViewSettings::getActiveComponentIndex() const
   return m_ActiveComponent;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram VSFilterViewSettings::getActiveArrayHistogram(int numBins, VSHistogram::BinningMode mode) const
+{
+  VSArrayStatisticsCache::StatisticsPtr statistics = VSArrayStatisticsCache::Instance()->getStatistics(getArrayByName(m_ActiveArrayName));
+  if(nullptr == statistics)
+  {
+    return VSHistogram();
+  }
+
+  return VSHistogram(*statistics, m_ActiveComponent, numBins, mode);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::getColorRange(double range[2]) const
+{
+  if(nullptr == m_LookupTable)
+  {
+    range[0] = 0.0;
+    range[1] = 1.0;
+    return;
+  }
+
+  double* tableRange = m_LookupTable->getRange();
+  range[0] = tableRange[0];
+  range[1] = tableRange[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSLookupTableController* VSFilterViewSettings::getLookupTableController() const
+{
+  return m_LookupTable;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -335,7 +466,7 @@ QString VSFilterViewSettings::getActiveComponentName() const
   }
 
   int numComponents = dataArray->GetNumberOfComponents();
-  bool isColorArray = dataArray->IsA("vtkUnsignedCharArray") && numComponents == 3;
+  bool isColorArray = dataArray->GetDataType() == VTK_UNSIGNED_CHAR && numComponents == 3;
   if(numComponents == 1)
   {
     return m_ActiveArrayName;
@@ -498,7 +629,7 @@ double VSFilterViewSettings::getAlpha()
 // -----------------------------------------------------------------------------
 bool VSFilterViewSettings::isScalarBarVisible() const
 {
-  return m_ScalarBarWidget && m_ToggleScalarBarAction->isChecked();
+  return (m_ScalarBarWidget || isRenderedByMontage()) && m_ToggleScalarBarAction->isChecked();
 }
 
 // -----------------------------------------------------------------------------
@@ -540,6 +671,7 @@ void VSFilterViewSettings::setScalarBarSetting(ScalarBarSetting setting)
 void VSFilterViewSettings::setIsSelected(bool selected)
 {
   m_Selected = selected;
+  updateOutputRetention();
   updateScalarBarVisibility();
   vtkActor* actor = getDataSetActor();
   if(nullptr == actor)
@@ -573,9 +705,325 @@ void VSFilterViewSettings::setIsSelected(bool selected)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkProp3D) VSFilterViewSettings::getActor()
 {
+  if(Representation::Volume == m_Representation && m_Volume)
+  {
+    return m_Volume;
+  }
+
   return m_Actor;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VTK_PTR(vtkActor)> VSFilterViewSettings::getPlaneActors() const
+{
+  std::vector<VTK_PTR(vtkActor)> actors;
+  for(const PlaneActor& planeActor : m_PlaneActors)
+  {
+    actors.push_back(planeActor.m_Actor);
+  }
+
+  return actors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::isRenderedByMontage() const
+{
+  return m_RenderedByMontage && ActorType::Image2D == m_ActorType;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setRenderedByMontage(bool renderedByMontage)
+{
+  if(renderedByMontage == m_RenderedByMontage)
+  {
+    return;
+  }
+
+  m_RenderedByMontage = renderedByMontage;
+  if(ActorType::Image2D != m_ActorType)
+  {
+    return;
+  }
+
+  // Existing actors are kept while the montage atlas replaces the tile's texture
+  if(renderedByMontage || m_Actor)
+  {
+    updateTexture();
+    return;
+  }
+
+  // Create the actors skipped while the montage drew the tile and restore its colors
+  QString arrayName = m_ActiveArrayName;
+  int component = m_ActiveComponent;
+  ColorMapping mapColors = m_MapColors;
+  double range[2];
+  getColorRange(range);
+
+  setupImageActors();
+  if(false == arrayName.isEmpty())
+  {
+    setActiveArrayName(arrayName);
+    setActiveComponentIndex(component);
+    m_LookupTable->setRange(range);
+  }
+  setMapColors(mapColors);
+  updateImageAlpha();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::getImagePlacement(double position[3], double orientation[3], double scale[3]) const
+{
+  if(ActorType::Image2D != m_ActorType || nullptr == m_Filter || nullptr == m_Filter->getTransform())
+  {
+    return false;
+  }
+
+  vtkImageData* imageData = dynamic_cast<vtkImageData*>(m_Filter->getOutput().Get());
+  if(nullptr == imageData)
+  {
+    return false;
+  }
+
+  int extent[6];
+  imageData->GetExtent(extent);
+  // Set Zmax to 1.0f for Image2D actor types
+  if(extent[5] == 0)
+  {
+    extent[5] = 1.0f;
+  }
+
+  // Get transform vectors
+  VSTransform* transform = m_Filter->getTransform();
+  std::array<double, 3> transformPosition = transform->getPosition();
+  std::array<double, 3> transformRotation = transform->getRotation();
+  std::array<double, 3> transformScale = transform->getScale();
+  for(int i = 0; i < 3; i++)
+  {
+    position[i] = transformPosition[i];
+    orientation[i] = transformRotation[i];
+    scale[i] = extent[2 * i + 1] * transformScale[i];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::getImagePlaneMatrix(vtkMatrix4x4* matrix) const
+{
+  double position[3];
+  double orientation[3];
+  double scale[3];
+  if(nullptr == matrix || false == getImagePlacement(position, orientation, scale))
+  {
+    return false;
+  }
+
+  // Matches the order vtkProp3D applies its position, orientation, and scale
+  VTK_NEW(vtkTransform, transform);
+  transform->PostMultiply();
+  transform->Scale(scale);
+  transform->RotateY(orientation[1]);
+  transform->RotateX(orientation[0]);
+  transform->RotateZ(orientation[2]);
+  transform->Translate(position);
+  matrix->DeepCopy(transform->GetMatrix());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::canRenderVolume() const
+{
+  if(nullptr == m_Filter || ActorType::DataSet != m_ActorType || VSAbstractFilter::IMAGE_DATA != m_Filter->getOutputType())
+  {
+    return false;
+  }
+
+  // The cached bounds reject flat images without updating the pipeline
+  double* bounds = m_Filter->getBounds();
+  if(nullptr == bounds || bounds[1] <= bounds[0] || bounds[3] <= bounds[2] || bounds[5] <= bounds[4])
+  {
+    return false;
+  }
+
+  // Read the existing output instead of updating the filter through getOutput
+  vtkAlgorithmOutput* outputPort = m_Filter->getOutputPort();
+  if(nullptr == outputPort || nullptr == outputPort->GetProducer())
+  {
+    return false;
+  }
+
+  vtkImageData* imageData = vtkImageData::SafeDownCast(outputPort->GetProducer()->GetOutputDataObject(outputPort->GetIndex()));
+  if(nullptr == imageData)
+  {
+    return false;
+  }
+
+  // The ray caster has no notion of blanking, so hidden cells would still be rendered
+  if(m_Filter->hasBlankedOutput() || imageData->HasAnyBlankCells())
+  {
+    return false;
+  }
+
+  // Cell scalars need at least two cells along each axis to be interpolated
+  int minDim = (m_ActiveArrayName.isEmpty() || isPointData()) ? 1 : 2;
+  int dims[3];
+  imageData->GetDimensions(dims);
+  return dims[0] > minDim && dims[1] > minDim && dims[2] > minDim;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkPiecewiseFunction) VSFilterViewSettings::getOpacityTransferFunction()
+{
+  return m_OpacityFunction;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::resetOpacityTransferFunction()
+{
+  if(nullptr == m_OpacityFunction)
+  {
+    return;
+  }
+
+  double* range = m_LookupTable->getRange();
+  m_OpacityFunction->RemoveAllPoints();
+  m_OpacityFunction->AddPoint(range[0], 0.0);
+  if(range[1] > range[0])
+  {
+    m_OpacityFunction->AddPoint(range[1], 1.0);
+  }
+
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updateVolume()
+{
+  if(nullptr == m_Volume)
+  {
+    // Render nodes may not have a GPU, so the multi-threaded fixed point ray caster is always used
+    m_VolumeMapper = VTK_PTR(vtkSmartVolumeMapper)::New();
+    m_VolumeMapper->SetRequestedRenderModeToRayCast();
+
+    m_OpacityFunction = VTK_PTR(vtkPiecewiseFunction)::New();
+
+    VTK_NEW(vtkVolumeProperty, volumeProperty);
+    volumeProperty->SetInterpolationTypeToLinear();
+    volumeProperty->ShadeOff();
+    volumeProperty->SetColor(m_LookupTable->getColorTransferFunction());
+    volumeProperty->SetScalarOpacity(m_OpacityFunction);
+
+    m_Volume = VTK_PTR(vtkVolume)::New();
+    m_Volume->SetMapper(m_VolumeMapper);
+    m_Volume->SetProperty(volumeProperty);
+  }
+
+  VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
+  vtkImageData* imageData = vtkImageData::SafeDownCast(outputData);
+  VTK_PTR(vtkDataArray) dataArray = getArrayByName(m_ActiveArrayName);
+  if(nullptr == imageData || nullptr == dataArray)
+  {
+    m_Volume->VisibilityOff();
+    return;
+  }
+
+  // The ray caster samples point scalars, so cell arrays are shared as the point
+  // scalars of a grid shifted by half a voxel instead of being interpolated
+  int dims[3];
+  double spacing[3];
+  double origin[3];
+  imageData->GetDimensions(dims);
+  imageData->GetSpacing(spacing);
+  imageData->GetOrigin(origin);
+  if(!isPointData())
+  {
+    for(int i = 0; i < 3; i++)
+    {
+      dims[i] = std::max(dims[i] - 1, 1);
+      origin[i] += spacing[i] * 0.5;
+    }
+  }
+
+  VTK_NEW(vtkImageData, volumeImage);
+  volumeImage->SetDimensions(dims);
+  volumeImage->SetSpacing(spacing);
+  volumeImage->SetOrigin(origin);
+
+  // Multi-component arrays are reduced to the active component or their magnitude.
+  // The reduced scalars are kept until the array is modified or another component is selected.
+  if(dataArray->GetNumberOfComponents() > 1)
+  {
+    const bool cached = nullptr != m_VolumeComponentImage && m_VolumeComponentArray == dataArray.GetPointer() && m_VolumeComponentMTime == dataArray->GetMTime() &&
+                        m_VolumeComponent == m_ActiveComponent && m_VolumeComponentImage->GetNumberOfPoints() == volumeImage->GetNumberOfPoints();
+    if(false == cached)
+    {
+      VTK_NEW(vtkImageData, componentInput);
+      componentInput->SetDimensions(dims);
+      componentInput->GetPointData()->SetScalars(dataArray);
+
+      VTK_PTR(vtkImageAlgorithm) componentFilter;
+      if(m_ActiveComponent < 0)
+      {
+        componentFilter = VTK_PTR(vtkImageMagnitude)::New();
+      }
+      else
+      {
+        VTK_NEW(vtkImageExtractComponents, extractFilter);
+        extractFilter->SetComponents(m_ActiveComponent);
+        componentFilter = extractFilter;
+      }
+      componentFilter->SetInputData(componentInput);
+      componentFilter->Update();
+
+      m_VolumeComponentImage = VTK_PTR(vtkImageData)::New();
+      m_VolumeComponentImage->ShallowCopy(componentFilter->GetOutput());
+      m_VolumeComponentArray = dataArray;
+      m_VolumeComponentMTime = dataArray->GetMTime();
+      m_VolumeComponent = m_ActiveComponent;
+    }
+    volumeImage->GetPointData()->SetScalars(m_VolumeComponentImage->GetPointData()->GetScalars());
+  }
+  else
+  {
+    m_VolumeComponentImage = nullptr;
+    m_VolumeComponentArray = nullptr;
+    volumeImage->GetPointData()->SetScalars(dataArray);
+  }
+  m_VolumeMapper->SetInputData(volumeImage);
+
+  // Opacity accumulates per voxel rather than per world unit
+  vtkVolumeProperty* volumeProperty = m_Volume->GetProperty();
+  volumeProperty->SetScalarOpacityUnitDistance((spacing[0] + spacing[1] + spacing[2]) / 3.0);
+
+  // Keep user edits to the opacity unless the scalar range changed
+  double* range = m_LookupTable->getRange();
+  double opacityRange[2];
+  m_OpacityFunction->GetRange(opacityRange);
+  if(0 == m_OpacityFunction->GetSize() || opacityRange[0] != range[0] || (range[1] > range[0] && opacityRange[1] != range[1]))
+  {
+    resetOpacityTransferFunction();
+  }
+
+  m_Volume->VisibilityOn();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -670,6 +1118,7 @@ void VSFilterViewSettings::setVisible(bool visible)
   }
 
   m_ShowFilter = visible;
+  updateOutputRetention();
 
   emit visibilityChanged(m_ShowFilter);
 }
@@ -771,24 +1220,26 @@ vtkDataArray* VSFilterViewSettings::getArrayByName(QString name) const
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::setActiveArrayName(QString name)
 {
+  // Montage tiles have no mapper but still track the array colored by the montage
   vtkDataSetMapper* mapper = getDataSetMapper();
   if(nullptr == mapper)
   {
-    if(nullptr == getImageMapper())
-    {
-      return;
-    }
-    else
-    {
-      mapper = getImageMapper();
-    }
+    mapper = getImageMapper();
+  }
+  if(nullptr == mapper && false == isRenderedByMontage())
+  {
+    return;
   }
 
   // Check for Solid Color
   if(name.isNull())
   {
-    mapper->SelectColorArray(-1);
+    if(mapper)
+    {
+      mapper->SelectColorArray(-1);
+    }
     m_ActiveArrayName = QString::null;
+    updatePointColorInput(mapper);
 
     emit activeArrayNameChanged(m_ActiveArrayName);
     emit componentNamesChanged();
@@ -820,19 +1271,15 @@ void VSFilterViewSettings::setActiveComponentIndex(int index)
   vtkDataSetMapper* mapper = getDataSetMapper();
   if(nullptr == mapper)
   {
-    if(nullptr == getImageMapper())
-    {
-      return;
-    }
-    else
-    {
-      mapper = getImageMapper();
-    }
+    mapper = getImageMapper();
+  }
+  if(nullptr == mapper && false == isRenderedByMontage())
+  {
+    return;
   }
 
   m_ActiveComponent = index;
 
-  VTK_PTR(vtkScalarsToColors) lookupTable = mapper->GetLookupTable();
   VTK_PTR(vtkDataArray) dataArray = getArrayByName(m_ActiveArrayName);
   if(nullptr == dataArray)
   {
@@ -846,45 +1293,57 @@ void VSFilterViewSettings::setActiveComponentIndex(int index)
   }
 
   // Set data type to map
-  if(isPointData())
-  {
-    mapper->SetScalarModeToUsePointFieldData();
-  }
-  else
-  {
-    mapper->SetScalarModeToUseCellFieldData();
-  }
+  updatePointColorInput(mapper);
 
   // Set array component index in the vtkDataSetMapper
   int numComponents = dataArray->GetNumberOfComponents();
-  mapper->ColorByArrayComponent(qPrintable(m_ActiveArrayName), index);
+  if(mapper)
+  {
+    mapper->ColorByArrayComponent(qPrintable(m_ActiveArrayName), index);
+  }
   updateColorMode();
 
-  // Set ScalarBar title
+  // Ranges are shared with every other view of the same array
+  VSArrayStatisticsCache::StatisticsPtr statistics = VSArrayStatisticsCache::Instance()->getStatistics(dataArray);
+  double range[2];
+
+  // Set ScalarBar title.  Montage tiles share the montage's scalar bar instead.
+  QString title;
   if(numComponents == 1)
   {
-    double* range = dataArray->GetRange();
+    statistics->getRange(0, range);
     m_LookupTable->setRange(range);
-    m_ScalarBarActor->SetTitle(dataArray->GetName());
+    title = dataArray->GetName();
   }
   else if(index == -1)
   {
-    double* range = dataArray->GetRange(-1);
+    statistics->getRange(-1, range);
     QString dataArrayName = QString(dataArray->GetName());
     QString componentName = dataArrayName + " Magnitude";
 
     m_LookupTable->setRange(range);
-    m_ScalarBarActor->SetTitle(qPrintable(componentName));
+    title = componentName;
     updateTexture();
   }
   else if(index < numComponents)
   {
-    double* range = dataArray->GetRange(index);
+    statistics->getRange(index, range);
     m_LookupTable->setRange(range);
-    m_ScalarBarActor->SetTitle(dataArray->GetComponentName(index));
+    title = dataArray->GetComponentName(index);
+  }
+
+  if(m_ScalarBarActor && false == title.isNull())
+  {
+    m_ScalarBarActor->SetTitle(qPrintable(title));
+  }
+
+  if(Representation::Volume == m_Representation)
+  {
+    updateVolume();
   }
 
   emit activeComponentIndexChanged(m_ActiveComponent);
+  emit lookupTableChanged();
 }
 
 // -----------------------------------------------------------------------------
@@ -1071,6 +1530,22 @@ void VSFilterViewSettings::invertScalarBar()
   }
 
   m_LookupTable->invert();
+  emit lookupTableChanged();
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setColorRange(double min, double max)
+{
+  if(false == isValid() || nullptr == m_LookupTable)
+  {
+    return;
+  }
+
+  m_LookupTable->setRange(min, max);
+  emit lookupTableChanged();
   emit requiresRender();
 }
 
@@ -1085,6 +1560,7 @@ void VSFilterViewSettings::loadPresetColors(const QJsonObject& colors)
   }
 
   m_LookupTable->parseRgbJson(colors);
+  emit lookupTableChanged();
   emit requiresRender();
 }
 
@@ -1181,6 +1657,19 @@ void VSFilterViewSettings::setupActors(bool outline)
 
   setupCubeAxesActor();
 
+  // Fall back to a surface if the new output can no longer be rendered as a volume
+  if(Representation::Volume == m_Representation)
+  {
+    if(canRenderVolume())
+    {
+      updateVolume();
+    }
+    else
+    {
+      setRepresentation(Representation::Surface);
+    }
+  }
+
   // if(outline)
   //{
   //  setRepresentation(Representation::Outline);
@@ -1226,6 +1715,13 @@ bool VSFilterViewSettings::hasSinglePointArray()
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::setupImageActors()
 {
+  // Montage tiles only create their own actors once they are drawn on their own
+  if(m_RenderedByMontage && nullptr == m_Actor)
+  {
+    setupMontageTile();
+    return;
+  }
+
   VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
   VTK_PTR(vtkPlaneSource) plane = VTK_PTR(vtkPlaneSource)::New();
 
@@ -1240,7 +1736,10 @@ void VSFilterViewSettings::setupImageActors()
     actor = vtkActor::New();
     actor->SetMapper(mapper);
 
-    m_LookupTable = new VSLookupTableController();
+    if(nullptr == m_LookupTable)
+    {
+      m_LookupTable = new VSLookupTableController();
+    }
     mapper->SetLookupTable(m_LookupTable->getColorTransferFunction());
 
     setMapColors(ColorMapping::None);
@@ -1282,10 +1781,75 @@ void VSFilterViewSettings::setupImageActors()
 
   if(ActorType::DataSet == m_ActorType && isVisible())
   {
-    emit swappingActors(m_Actor.Get(), actor);
+    emit swappingActors(m_Actor.Get(), actor);
+  }
+
+  // Check if there are any arrays to use
+  bool hasArrays = false;
+  if(isPointData())
+  {
+    hasArrays = outputData->GetPointData()->GetNumberOfArrays() > 0;
+  }
+  else
+  {
+    hasArrays = outputData->GetCellData()->GetNumberOfArrays() > 0;
+  }
+
+  m_Mapper = mapper;
+  m_Actor = actor;
+  m_Plane = plane;
+  m_ActorType = ActorType::Image2D;
+
+  // Set Mapper to use the active array and component
+  if(hasArrays)
+  {
+    if(m_HadNoArrays)
+    {
+      setMapColors(ColorMapping::NonColors);
+      setActiveArrayName(getArrayNameByIndex(0));
+      m_HadNoArrays = false;
+    }
+    else
+    {
+      QStringList arrayNames = getFilter()->getArrayNames();
+      if(arrayNames.empty())
+      {
+        setActiveArrayName(m_ActiveArrayName);
+      }
+      else
+      {
+        setActiveArrayName(arrayNames[0]);
+      }
+      setActiveComponentIndex(m_ActiveComponent);
+    }
+  }
+  else
+  {
+    setMapColors(ColorMapping::None);
+    setScalarBarVisible(false);
+    m_HadNoArrays = true;
+  }
+
+  setupImageTransform(dynamic_cast<vtkImageData*>(outputData.Get()));
+
+  updateTexture();
+  updateTransform();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setupMontageTile()
+{
+  VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
+
+  // The lookup table keeps the tile's colors for the montage's shared lookup table
+  if(nullptr == m_LookupTable)
+  {
+    m_LookupTable = new VSLookupTableController();
   }
+  m_ActorType = ActorType::Image2D;
 
-  // Check if there are any arrays to use
   bool hasArrays = false;
   if(isPointData())
   {
@@ -1296,12 +1860,6 @@ void VSFilterViewSettings::setupImageActors()
     hasArrays = outputData->GetCellData()->GetNumberOfArrays() > 0;
   }
 
-  m_Mapper = mapper;
-  m_Actor = actor;
-  m_Plane = plane;
-  m_ActorType = ActorType::Image2D;
-
-  // Set Mapper to use the active array and component
   if(hasArrays)
   {
     if(m_HadNoArrays)
@@ -1313,14 +1871,7 @@ void VSFilterViewSettings::setupImageActors()
     else
     {
       QStringList arrayNames = getFilter()->getArrayNames();
-      if(arrayNames.empty())
-      {
-        setActiveArrayName(m_ActiveArrayName);
-      }
-      else
-      {
-        setActiveArrayName(arrayNames[0]);
-      }
+      setActiveArrayName(arrayNames.empty() ? m_ActiveArrayName : arrayNames[0]);
       setActiveComponentIndex(m_ActiveComponent);
     }
   }
@@ -1331,8 +1882,15 @@ void VSFilterViewSettings::setupImageActors()
     m_HadNoArrays = true;
   }
 
-  vtkImageData* imageData = dynamic_cast<vtkImageData*>(outputData.Get());
+  setupImageTransform(dynamic_cast<vtkImageData*>(outputData.Get()));
+  updateTransform();
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setupImageTransform(vtkImageData* imageData)
+{
   double spacing[3];
   imageData->GetSpacing(spacing);
 
@@ -1348,9 +1906,6 @@ void VSFilterViewSettings::setupImageActors()
   defaultTransform->setLocalPosition(m_Filter->getTransform()->getLocalPosition());
   defaultTransform->setLocalRotation(m_Filter->getTransform()->getLocalRotation());
   defaultTransform->setLocalScale(m_Filter->getTransform()->getLocalScale());
-
-  updateTexture();
-  updateTransform();
 }
 
 // -----------------------------------------------------------------------------
@@ -1397,8 +1952,10 @@ void VSFilterViewSettings::setupDataSetActors()
     actor = vtkActor::SafeDownCast(m_Actor);
   }
 
-  m_DataSetFilter->SetInputConnection(m_Filter->getTransformedOutputPort());
-  m_OutlineFilter->SetInputConnection(m_Filter->getTransformedOutputPort());
+  // The filter transform is applied through the actor's user matrix
+  m_DataSetFilter->SetInputConnection(m_Filter->getOutputPort());
+  m_PointColorInput = nullptr;
+  m_OutlineFilter->SetInputConnection(m_Filter->getOutputPort());
 
   updateTexture();
 
@@ -1453,9 +2010,11 @@ void VSFilterViewSettings::setupDataSetActors()
   m_Mapper = mapper;
   m_Actor = actor;
   m_Plane = plane;
+  m_SliceTextured = false;
 
   m_ActorType = ActorType::DataSet;
 
+  updateSliceTexture();
   updateTransform();
 }
 
@@ -1475,7 +2034,7 @@ void VSFilterViewSettings::setupCubeAxesActor()
 
   if(m_Filter && m_Filter->getOutput())
   {
-    m_CubeAxesActor->SetBounds(m_Filter->getBounds());
+    m_CubeAxesActor->SetBounds(m_Filter->getTransformBounds());
   }
 }
 
@@ -1489,14 +2048,19 @@ void VSFilterViewSettings::updateInputPort(VSAbstractFilter* filter)
     return;
   }
 
-  if(!m_DataSetFilter)
+  if(m_DataSetFilter)
+  {
+    updatePointColorInput(getDataSetMapper());
+    updateSliceTexture();
+  }
+  else
   {
     if(m_ActorType != ActorType::Image2D)
     {
       m_Mapper->SetInputConnection(filter->getOutputPort());
-      m_Actor->SetUserTransform(m_Filter->getTransform()->getGlobalTransform());
+      m_Actor->SetUserMatrix(m_Filter->getTransform()->getGlobalMatrix());
     }
-    else
+    else if(m_Mapper)
     {
       m_OutlineFilter->SetInputConnection(m_Plane->GetOutputPort());
 
@@ -1518,54 +2082,50 @@ void VSFilterViewSettings::updateInputPort(VSAbstractFilter* filter)
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::updateTransform()
 {
-  if(false == (m_Filter && m_Filter->getTransform() && m_Actor))
+  if(false == (m_Filter && m_Filter->getTransform()))
   {
     return;
   }
 
-  if(ActorType::Image2D == m_ActorType || ActorType::DataSet == m_ActorType)
+  // Montage tiles are placed by their VSMontageActor
+  if(nullptr == m_Actor)
   {
-    VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
-    vtkImageData* imageData = dynamic_cast<vtkImageData*>(outputData.Get());
-    double bounds[6];
-    imageData->GetBounds(bounds);
-    int extent[6];
-    imageData->GetExtent(extent);
-    // Set Zmax to 1.0f for Image2D actor types
-    if(ActorType::Image2D == m_ActorType && extent[5] == 0)
-    {
-      extent[5] = 1.0f;
-    }
-
-    // Get transform vectors
-    VSTransform* transform = m_Filter->getTransform();
-    double* transformPosition = transform->getPosition();
-    double* transformRotation = transform->getRotation();
-    double* transformScale = transform->getScale();
+    emit requiresRender();
+    return;
+  }
 
-    m_Actor->SetPosition(transformPosition);
-    m_Actor->SetOrientation(transformRotation);
-    m_Actor->SetScale(extent[1] * transformScale[0], extent[3] * transformScale[1], extent[5] * transformScale[2]);
+  VSTransform* transform = m_Filter->getTransform();
+  double position[3];
+  double orientation[3];
+  double scale[3];
+  if(getImagePlacement(position, orientation, scale))
+  {
+    m_Actor->SetPosition(position);
+    m_Actor->SetOrientation(orientation);
+    m_Actor->SetScale(scale);
   }
   else
   {
+    // Data set geometry is rendered in local coordinates and placed by the user matrix
     m_Actor->SetPosition(0.0, 0.0, 0.0);
     m_Actor->SetOrientation(0.0, 0.0, 0.0);
     m_Actor->SetScale(1.0, 1.0, 1.0);
-  }
-
-  if(m_CubeAxesActor && m_Filter->getOutput())
-  {
-    if(ActorType::Image2D == m_ActorType)
+    m_Actor->SetUserMatrix(transform->getGlobalMatrix());
+    if(m_Volume)
     {
-      m_CubeAxesActor->SetBounds(m_Filter->getTransformBounds());
+      m_Volume->SetUserMatrix(transform->getGlobalMatrix());
     }
-    else
+    for(const PlaneActor& planeActor : m_PlaneActors)
     {
-      m_CubeAxesActor->SetBounds(m_Filter->getBounds());
+      planeActor.m_Actor->SetUserMatrix(transform->getGlobalMatrix());
     }
   }
 
+  if(m_CubeAxesActor && m_Filter->getOutput())
+  {
+    m_CubeAxesActor->SetBounds(m_Filter->getTransformBounds());
+  }
+
   emit requiresRender();
 }
 
@@ -1577,7 +2137,7 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
   if(m_Filter)
   {
     disconnect(m_Filter, SIGNAL(updatedOutputPort(VSAbstractFilter*)), this, SLOT(updateInputPort(VSAbstractFilter*)));
-    disconnect(m_Filter, SIGNAL(transformChanged()), this, SIGNAL(updateTransform()));
+    disconnect(m_Filter, SIGNAL(transformChanged()), this, SLOT(updateTransform()));
     disconnect(m_Filter, &VSAbstractFilter::removeFilter, this, &VSFilterViewSettings::filterDeleted);
     disconnect(m_Filter, &VSAbstractFilter::arrayNamesChanged, this, &VSFilterViewSettings::arrayNamesChanged);
     disconnect(m_Filter, &VSAbstractFilter::scalarNamesChanged, this, &VSFilterViewSettings::scalarNamesChanged);
@@ -1618,6 +2178,30 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
       connect(filter, SIGNAL(dataReloaded()), this, SLOT(reloadedData()));
     }
   }
+
+  // Orthogonal slices draw the planes that are not part of their output with their own actors
+  for(const PlaneActor& planeActor : m_PlaneActors)
+  {
+    emit swappingActors(planeActor.m_Actor.Get(), nullptr);
+  }
+  m_PlaneActors.clear();
+  if(dynamic_cast<VSOrthoSliceFilter*>(filter))
+  {
+    for(int axis = 0; axis < 3; axis++)
+    {
+      PlaneActor planeActor;
+      planeActor.m_Plane = VTK_PTR(vtkPlaneSource)::New();
+      planeActor.m_SurfaceFilter = VTK_PTR(vtkDataSetSurfaceFilter)::New();
+      VTK_NEW(vtkDataSetMapper, mapper);
+      planeActor.m_Actor = VTK_PTR(vtkActor)::New();
+      planeActor.m_Actor->SetMapper(mapper);
+      planeActor.m_Actor->VisibilityOff();
+      m_PlaneActors.push_back(planeActor);
+    }
+    emit planeActorsChanged();
+  }
+
+  updateOutputRetention();
 }
 
 // -----------------------------------------------------------------------------
@@ -1626,9 +2210,46 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
 void VSFilterViewSettings::filterDeleted()
 {
   setVisible(false);
+
+  // The filter is destroyed before this object
+  if(m_RetainedFilter)
+  {
+    VSOutputMemoryPolicy::Instance()->unpinOutput(m_RetainedFilter);
+    m_RetainedFilter = nullptr;
+  }
+
   deleteLater();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updateOutputRetention()
+{
+  VSAbstractFilter* retainedFilter = (m_ShowFilter || m_Selected) ? m_Filter : nullptr;
+  if(retainedFilter == m_RetainedFilter)
+  {
+    return;
+  }
+
+  VSOutputMemoryPolicy* policy = VSOutputMemoryPolicy::Instance();
+  if(m_RetainedFilter)
+  {
+    policy->unpinOutput(m_RetainedFilter);
+  }
+
+  m_RetainedFilter = retainedFilter;
+  if(m_RetainedFilter)
+  {
+    policy->pinOutput(m_RetainedFilter);
+  }
+  else if(policy->getReleaseHiddenOutputs() && m_DataSetFilter && m_DataSetFilter->GetOutputDataObject(0))
+  {
+    // The surface is extracted again the next time the filter is rendered
+    m_DataSetFilter->GetOutputDataObject(0)->ReleaseData();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1781,6 +2402,14 @@ void VSFilterViewSettings::setRenderPointsAsSpheres(bool renderSpheres)
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::setRepresentation(const Representation& type)
 {
+  // Montage tiles keep the representation used once they are drawn on their own
+  if(isRenderedByMontage() && nullptr == m_Actor)
+  {
+    m_Representation = type;
+    emit representationChanged(type);
+    return;
+  }
+
   vtkActor* actor = getDataSetActor();
   if(nullptr == actor)
   {
@@ -1800,12 +2429,26 @@ void VSFilterViewSettings::setRepresentation(const Representation& type)
     }
   }
 
+  if(type == Representation::Volume && !canRenderVolume())
+  {
+    return;
+  }
+
   const Representation prevRep = m_Representation;
+  VTK_PTR(vtkProp3D) prevProp = getActor();
   m_Representation = type;
-  if(type == Representation::Outline)
+  if(type == Representation::Volume)
+  {
+    updateVolume();
+  }
+  else if(type == Representation::Outline)
   {
     mapper->SetInputConnection(m_OutlineFilter->GetOutputPort());
     actor->GetProperty()->SetRepresentation(static_cast<int>(Representation::Wireframe));
+    if(m_SliceTextured)
+    {
+      updateSliceTexture();
+    }
   }
   else
   {
@@ -1817,6 +2460,8 @@ void VSFilterViewSettings::setRepresentation(const Representation& type)
     else
     {
       mapper->SetInputConnection(m_DataSetFilter->GetOutputPort());
+      updatePointColorInput(mapper);
+      updateSliceTexture();
     }
 
     if(type == Representation::SurfaceWithEdges)
@@ -1840,6 +2485,12 @@ void VSFilterViewSettings::setRepresentation(const Representation& type)
     emit pointRenderingChanged();
   }
 
+  // Views replace the surface actor with the volume and back
+  if(prevProp != getActor() && isVisible())
+  {
+    emit swappingActors(prevProp.Get(), getActor().Get());
+  }
+
   updateTransform();
   updateScalarBarVisibility();
   emit representationChanged(type);
@@ -1943,10 +2594,15 @@ void VSFilterViewSettings::copySettings(VSFilterViewSettings* copy)
   setScalarBarVisible(copy->m_ToggleScalarBarAction->isChecked());
   setScalarBarSetting(copy->m_ScalarBarSetting);
   m_Selected = copy->m_Selected;
+  updateOutputRetention();
   setAlpha(copy->m_Alpha);
   setSolidColor(copy->getSolidColor());
   setRepresentation(copy->getRepresentation());
   setPointSize(copy->getPointSize());
+  if(m_OpacityFunction && copy->m_OpacityFunction)
+  {
+    m_OpacityFunction->DeepCopy(copy->m_OpacityFunction);
+  }
 
   if(hasUi && m_ScalarBarWidget)
   {
@@ -1988,6 +2644,12 @@ QMenu* VSFilterViewSettings::getRepresentationMenu()
   surfEdgesAction->setChecked(getRepresentation() == VSFilterViewSettings::Representation::SurfaceWithEdges);
   connect(surfEdgesAction, &QAction::triggered, [=] { setRepresentation(VSFilterViewSettings::Representation::SurfaceWithEdges); });
 
+  QAction* volumeAction = representationMenu->addAction("Volume");
+  volumeAction->setCheckable(true);
+  volumeAction->setChecked(getRepresentation() == VSFilterViewSettings::Representation::Volume);
+  volumeAction->setEnabled(canRenderVolume());
+  connect(volumeAction, &QAction::triggered, [=] { setRepresentation(VSFilterViewSettings::Representation::Volume); });
+
   return representationMenu;
 }
 
@@ -2792,6 +3454,29 @@ int VSFilterViewSettings::getSubsampling() const
   return m_Subsampling;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSFilterViewSettings::getTextureLevel() const
+{
+  return m_TextureLevel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setTextureLevel(int level)
+{
+  level = std::max(level, 0);
+  if(level == m_TextureLevel)
+  {
+    return;
+  }
+
+  m_TextureLevel = level;
+  updateTexture();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -2799,33 +3484,54 @@ void VSFilterViewSettings::updateTexture()
 {
   if(!isFlatImage())
   {
+    updateSliceTexture();
+    return;
+  }
+
+  // Montage tiles are textured by the montage atlas
+  if(isRenderedByMontage())
+  {
+    if(getImageActor())
+    {
+      getImageActor()->SetTexture(nullptr);
+    }
+    m_Texture = nullptr;
     return;
   }
+
   VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
   vtkImageData* imageData = dynamic_cast<vtkImageData*>(outputData.Get());
 
-  VTK_PTR(vtkTexture) texture = VTK_PTR(vtkTexture)::New();
-
-  texture->InterpolateOn();
-  texture->SetInputData(imageData);
-  if(m_LookupTable != nullptr)
+  // Subsampled textures use the image pyramid once it has been built in the background
+  VTK_PTR(vtkImageData) textureImage = imageData;
+  int level = std::max(m_TextureLevel, VSImagePyramid::LevelForSampleRate(m_Subsampling));
+  if(level > 0 && imageData)
   {
-    texture->SetLookupTable(m_LookupTable->getColorTransferFunction());
+    VSImagePyramidCache* pyramidCache = VSImagePyramidCache::Instance();
+    VSImagePyramidCache::PyramidPtr pyramid = pyramidCache->getPyramid(imageData);
+    if(pyramid && pyramid->getLevel(level))
+    {
+      textureImage = pyramid->getLevel(level);
+    }
+    else if(nullptr == pyramid)
+    {
+      connect(&m_PyramidWatcher, &QFutureWatcher<void>::finished, this, &VSFilterViewSettings::updateTexture, Qt::UniqueConnection);
+      m_PyramidWatcher.setFuture(pyramidCache->getBuildFuture(imageData));
+    }
   }
 
-  if(m_Subsampling > 1)
+  if(nullptr == m_Texture)
   {
-    VTK_PTR(vtkExtractVOI) subsample = VTK_PTR(vtkExtractVOI)::New();
-    int* inputDims = imageData->GetDimensions();
-    subsample->SetInputData(imageData);
-    subsample->SetSampleRate(m_Subsampling, m_Subsampling, m_Subsampling);
-    subsample->Update();
+    m_Texture = VTK_PTR(vtkTexture)::New();
+    m_Texture->InterpolateOn();
+  }
 
-    vtkImageData* extracted = subsample->GetOutput();
-    texture->SetInputData(extracted);
+  m_Texture->SetInputData(textureImage);
+  if(m_LookupTable != nullptr)
+  {
+    m_Texture->SetLookupTable(m_LookupTable->getColorTransferFunction());
   }
 
-  m_Texture = texture;
   vtkActor* actor = getDataSetActor();
   if(nullptr != actor)
   {
@@ -2840,6 +3546,245 @@ void VSFilterViewSettings::updateTexture()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSFilterViewSettings::createSliceTextureImage(vtkImageData* imageData) const
+{
+  if(nullptr == imageData || isPointData() || m_ActiveArrayName.isEmpty() || ColorMapping::None == m_MapColors)
+  {
+    return nullptr;
+  }
+
+  // Blanked cells cannot be hidden in a texture
+  vtkCellData* cellData = imageData->GetCellData();
+  if(cellData->GetArray(vtkDataSetAttributes::GhostArrayName()))
+  {
+    return nullptr;
+  }
+
+  vtkDataArray* dataArray = cellData->GetArray(qPrintable(m_ActiveArrayName));
+  if(nullptr == dataArray || dataArray->GetNumberOfComponents() != 1)
+  {
+    return nullptr;
+  }
+
+  // Exactly one axis must be flat
+  int dims[3];
+  imageData->GetDimensions(dims);
+  int textureDims[3] = {1, 1, 1};
+  int numTextureAxes = 0;
+  for(int i = 0; i < 3; i++)
+  {
+    if(dims[i] > 1)
+    {
+      if(numTextureAxes == 2)
+      {
+        return nullptr;
+      }
+      textureDims[numTextureAxes++] = dims[i] - 1;
+    }
+  }
+  if(numTextureAxes != 2)
+  {
+    return nullptr;
+  }
+
+  // Cells of a flat image are ordered like the pixels of the texture, so the array is shared
+  VTK_NEW(vtkImageData, textureImage);
+  textureImage->SetDimensions(textureDims);
+  textureImage->GetPointData()->SetScalars(dataArray);
+  return textureImage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updateSliceTexture()
+{
+  updatePlaneActors();
+
+  vtkDataSetMapper* mapper = getDataSetMapper();
+  vtkActor* actor = getDataSetActor();
+  if(nullptr == mapper || nullptr == actor || nullptr == m_Plane || nullptr == m_DataSetFilter || dynamic_cast<VSAbstractDataFilter*>(m_Filter))
+  {
+    return;
+  }
+
+  vtkImageData* imageData = vtkImageData::SafeDownCast(m_Filter->getOutput());
+  VTK_PTR(vtkImageData) textureImage;
+  if(getRepresentation() != Representation::Outline)
+  {
+    textureImage = createSliceTextureImage(imageData);
+  }
+
+  if(nullptr == textureImage)
+  {
+    if(m_SliceTextured)
+    {
+      m_SliceTextured = false;
+      actor->SetTexture(nullptr);
+      mapper->ScalarVisibilityOn();
+      if(getRepresentation() != Representation::Outline)
+      {
+        mapper->SetInputConnection(m_DataSetFilter->GetOutputPort());
+      }
+    }
+    return;
+  }
+
+  placeSliceQuad(m_Plane, imageData);
+
+  // Keep the uploaded texture while the slice still shows the same array
+  if(false == m_SliceTextured || false == isTextureInput(m_Texture, textureImage))
+  {
+    m_Texture = VTK_PTR(vtkTexture)::New();
+    m_Texture->InterpolateOff();
+    m_Texture->SetInputData(textureImage);
+  }
+  m_Texture->SetLookupTable(m_LookupTable->getColorTransferFunction());
+  if(isMappingColors())
+  {
+    m_Texture->SetColorModeToMapScalars();
+  }
+  else
+  {
+    m_Texture->SetColorModeToDirectScalars();
+  }
+
+  actor->SetTexture(m_Texture);
+  mapper->ScalarVisibilityOff();
+  mapper->SetInputConnection(m_Plane->GetOutputPort());
+  m_SliceTextured = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updatePointColorInput(vtkDataSetMapper* mapper)
+{
+  if(nullptr == mapper || nullptr == m_DataSetFilter)
+  {
+    return;
+  }
+
+  // Points have no cell values of their own, so cell arrays drawn as points are colored
+  // by point values generated on demand from the wrapped cell array
+  VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
+  VTK_PTR(vtkDataArray) pointArray = nullptr;
+  if(outputData && !isPointData() && !isFlatImage() && Representation::Points == getRepresentation() && !m_ActiveArrayName.isEmpty())
+  {
+    pointArray = SIMPLVtkBridge::GeneratePointArray(outputData, m_ActiveArrayName);
+  }
+
+  if(nullptr == pointArray)
+  {
+    if(m_PointColorInput)
+    {
+      m_PointColorInput = nullptr;
+      m_DataSetFilter->SetInputConnection(m_Filter->getOutputPort());
+    }
+
+    if(isPointData())
+    {
+      mapper->SetScalarModeToUsePointFieldData();
+    }
+    else
+    {
+      mapper->SetScalarModeToUseCellFieldData();
+    }
+    return;
+  }
+
+  if(nullptr == m_PointColorInput || m_PointColorInput->GetPointData()->GetArray(qPrintable(m_ActiveArrayName)) != pointArray.GetPointer())
+  {
+    m_PointColorInput = VTK_PTR(vtkDataSet)::Take(outputData->NewInstance());
+    m_PointColorInput->CopyStructure(outputData);
+    m_PointColorInput->GetPointData()->AddArray(pointArray);
+    m_DataSetFilter->SetInputData(m_PointColorInput);
+  }
+  mapper->SetScalarModeToUsePointFieldData();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updatePlaneActors()
+{
+  VSOrthoSliceFilter* orthoFilter = dynamic_cast<VSOrthoSliceFilter*>(m_Filter);
+  vtkDataSetMapper* filterMapper = getDataSetMapper();
+  vtkActor* filterActor = getDataSetActor();
+  if(nullptr == orthoFilter || nullptr == filterMapper || nullptr == filterActor)
+  {
+    return;
+  }
+
+  bool planeShown = false;
+  for(int axis = 0; axis < static_cast<int>(m_PlaneActors.size()); axis++)
+  {
+    PlaneActor& planeActor = m_PlaneActors[axis];
+    vtkDataSetMapper* mapper = vtkDataSetMapper::SafeDownCast(planeActor.m_Actor->GetMapper());
+
+    // The plane in the filter output is drawn by the filter actor
+    VTK_PTR(vtkImageData) planeData = orthoFilter->getPlaneOutput(axis);
+    if(axis == orthoFilter->getPrimaryAxis() || nullptr == planeData || getRepresentation() == Representation::Outline)
+    {
+      planeActor.m_Actor->VisibilityOff();
+      continue;
+    }
+
+    mapper->ShallowCopy(filterMapper);
+    planeActor.m_Actor->SetProperty(filterActor->GetProperty());
+    planeActor.m_Actor->SetUserMatrix(filterActor->GetUserMatrix());
+
+    VTK_PTR(vtkImageData) textureImage = createSliceTextureImage(planeData);
+    if(nullptr == textureImage)
+    {
+      planeActor.m_Texture = nullptr;
+      planeActor.m_Actor->SetTexture(nullptr);
+      planeActor.m_SurfaceFilter->SetInputData(planeData);
+      mapper->SetInputConnection(planeActor.m_SurfaceFilter->GetOutputPort());
+      if(m_SliceTextured)
+      {
+        mapper->ScalarVisibilityOn();
+      }
+    }
+    else
+    {
+      placeSliceQuad(planeActor.m_Plane, planeData);
+      if(false == isTextureInput(planeActor.m_Texture, textureImage))
+      {
+        planeActor.m_Texture = VTK_PTR(vtkTexture)::New();
+        planeActor.m_Texture->InterpolateOff();
+        planeActor.m_Texture->SetInputData(textureImage);
+      }
+      planeActor.m_Texture->SetLookupTable(m_LookupTable->getColorTransferFunction());
+      if(isMappingColors())
+      {
+        planeActor.m_Texture->SetColorModeToMapScalars();
+      }
+      else
+      {
+        planeActor.m_Texture->SetColorModeToDirectScalars();
+      }
+
+      planeActor.m_SurfaceFilter->SetInputData(nullptr);
+      planeActor.m_Actor->SetTexture(planeActor.m_Texture);
+      mapper->ScalarVisibilityOff();
+      mapper->SetInputConnection(planeActor.m_Plane->GetOutputPort());
+    }
+
+    planeShown = planeShown || 0 == planeActor.m_Actor->GetVisibility();
+    planeActor.m_Actor->VisibilityOn();
+  }
+
+  // Views add the plane actors again in case the filter was shown before they existed
+  if(planeShown)
+  {
+    emit planeActorsChanged();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
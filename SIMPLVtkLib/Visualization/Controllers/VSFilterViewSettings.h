@@ -38,6 +38,7 @@
 #include <map>
 #include <vector>
 
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QObject>
 #include <QtGui/QColor>
 #include <QtGui/QIcon>
@@ -48,11 +49,15 @@
 #include <vtkActor.h>
 #include <vtkCubeAxesActor.h>
 #include <vtkDataSetSurfaceFilter.h>
+#include <vtkImageData.h>
 #include <vtkOutlineFilter.h>
+#include <vtkPiecewiseFunction.h>
 #include <vtkPlaneSource.h>
 #include <vtkScalarBarActor.h>
 #include <vtkScalarBarWidget.h>
+#include <vtkSmartVolumeMapper.h>
 #include <vtkTexture.h>
+#include <vtkVolume.h>
 
 #include "SIMPLVtkLib/Dialogs/AbstractImportMontageDialog.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h"
@@ -61,6 +66,7 @@
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 class vtkDataSetMapper;
+class vtkMatrix4x4;
 class vtkImageSliceMapper;
 class vtkImageSlice;
 
@@ -105,6 +111,7 @@ public:
     Wireframe,
     Surface,
     SurfaceWithEdges,
+    Volume,
     Default = Surface
   };
 
@@ -227,6 +234,26 @@ public:
    */
   QString getActiveComponentName() const;
 
+  /**
+   * @brief Returns the histogram of the active array component used to color the filter
+   * @param numBins
+   * @param mode
+   * @return
+   */
+  VSHistogram getActiveArrayHistogram(int numBins = VSHistogram::DefaultNumberOfBins, VSHistogram::BinningMode mode = VSHistogram::BinningMode::Fixed) const;
+
+  /**
+   * @brief Copies the value range mapped by the lookup table into the range parameter
+   * @param range
+   */
+  void getColorRange(double range[2]) const;
+
+  /**
+   * @brief Returns the lookup table used to color the active array
+   * @return
+   */
+  VSLookupTableController* getLookupTableController() const;
+
   /**
    * @brief Returns the array names that can be used to color the data
    * @return
@@ -307,11 +334,62 @@ public:
   void setIsSelected(bool selected);
 
   /**
-   * @brief Returns the vtkActor used to render the filter
+   * @brief Returns the vtkActor used to render the filter, or the vtkVolume when
+   * using the Volume representation
    * @return
    */
   VTK_PTR(vtkProp3D) getActor();
 
+  /**
+   * @brief Returns the actors drawing the planes of an orthogonal slice filter that are
+   * not part of its output.  These are rendered alongside getActor().  Returns an empty
+   * vector for other filters.
+   * @return
+   */
+  std::vector<VTK_PTR(vtkActor)> getPlaneActors() const;
+
+  /**
+   * @brief Returns true if the flat image is drawn by a VSMontageActor.  Montage tiles do
+   * not create an actor, mapper, texture, or scalar bar, so getActor returns nullptr until
+   * the tile is drawn on its own.
+   * @return
+   */
+  bool isRenderedByMontage() const;
+
+  /**
+   * @brief Sets whether the flat image is drawn by a VSMontageActor.  The actors skipped
+   * while the montage drew the tile are created when this is set to false.
+   * @param renderedByMontage
+   */
+  void setRenderedByMontage(bool renderedByMontage);
+
+  /**
+   * @brief Copies the matrix placing a flat image's unit plane, centered on the origin,
+   * in the scene.  Returns false if the filter is not a flat image.
+   * @param matrix
+   * @return
+   */
+  bool getImagePlaneMatrix(vtkMatrix4x4* matrix) const;
+
+  /**
+   * @brief Returns true if the filter output is 3D image data that can use the Volume representation.
+   * Blanked outputs are refused because the volume mapper ignores hidden cells.  Cell
+   * arrays need more than two points along every axis.
+   * @return
+   */
+  bool canRenderVolume() const;
+
+  /**
+   * @brief Returns the scalar opacity transfer function used by the Volume representation
+   * @return
+   */
+  VTK_PTR(vtkPiecewiseFunction) getOpacityTransferFunction();
+
+  /**
+   * @brief Resets the opacity transfer function to a linear ramp over the lookup table range
+   */
+  void resetOpacityTransferFunction();
+
   /**
    * @brief Returns the vtkScalarBarWidget used for the filter
    * @return
@@ -446,6 +524,19 @@ public:
    */
   int getSubsampling() const;
 
+  /**
+   * @brief Returns the image pyramid level requested for flat image textures
+   * @return
+   */
+  int getTextureLevel() const;
+
+  /**
+   * @brief Sets the image pyramid level used for flat image textures.  Level 0 is the
+   * full resolution image.  Levels past the coarsest available level are clamped.
+   * @param level
+   */
+  void setTextureLevel(int level);
+
   /**
    * @brief Set the display type
    * @param displayType
@@ -751,6 +842,13 @@ public slots:
    */
   void invertScalarBar();
 
+  /**
+   * @brief Sets the value range mapped by the lookup table
+   * @param min
+   * @param max
+   */
+  void setColorRange(double min, double max);
+
   /**
    * @brief Set the preset colors for the VSLookupTableController
    * @param json
@@ -838,6 +936,17 @@ signals:
   void dataLoaded();
   void swappingActors(vtkProp3D* oldProp, vtkProp3D* newProp);
 
+  /**
+   * @brief Emitted when the plane actors are created or one of them is shown.  Views
+   * add the actors returned by getPlaneActors while the filter is visible.
+   */
+  void planeActorsChanged();
+
+  /**
+   * @brief Emitted when the colors or range of the lookup table change
+   */
+  void lookupTableChanged();
+
 protected:
   /**
    * @brief Creates the static icons used used.
@@ -854,11 +963,39 @@ protected:
    */
   void setupImageActors();
 
+  /**
+   * @brief Sets up the array and transform of a flat image drawn by a VSMontageActor
+   * without creating any actors
+   */
+  void setupMontageTile();
+
+  /**
+   * @brief Scales the transform to the image spacing and saves it as the default transform
+   * @param imageData
+   */
+  void setupImageTransform(vtkImageData* imageData);
+
+  /**
+   * @brief Copies the position, orientation, and scale of a flat image's unit plane.
+   * Returns false if the filter is not a flat image.
+   * @param position
+   * @param orientation
+   * @param scale
+   * @return
+   */
+  bool getImagePlacement(double position[3], double orientation[3], double scale[3]) const;
+
   /**
    * @brief Creates a vtkDataSetMapper and vtkActor for displaying generic vtkDataSets
    */
   void setupDataSetActors();
 
+  /**
+   * @brief Creates the vtkVolume if required and updates its input to the active array.
+   * The volume is colored by the VSLookupTableController.
+   */
+  void updateVolume();
+
   /**
    * @brief Creates a vtkAxisActor for displaying the axis grid
    */
@@ -903,6 +1040,36 @@ protected:
    */
   bool isFlatImage();
 
+  /**
+   * @brief Draws flat image output from filters such as VSSliceFilter as a textured quad
+   * instead of extracting its surface.  Falls back to the surface when the output or the
+   * active array cannot be drawn as a texture.
+   */
+  void updateSliceTexture();
+
+  /**
+   * @brief Returns an image whose points reference the active cell array of the given
+   * flat image.  Returns nullptr if the image cannot be drawn as a texture.
+   * @param imageData
+   * @return
+   */
+  VTK_PTR(vtkImageData) createSliceTextureImage(vtkImageData* imageData) const;
+
+  /**
+   * @brief Sets the mapper's scalar mode for the active array.  Cell arrays drawn as points
+   * are colored by point values generated from the cell array.  These are added to a
+   * shallow copy of the filter output so the output itself is never modified.
+   * @param mapper
+   */
+  void updatePointColorInput(vtkDataSetMapper* mapper);
+
+  /**
+   * @brief Draws the planes of a VSOrthoSliceFilter missing from its output with the plane
+   * actors.  They share the filter actor's property, transform, and color settings.  A
+   * plane's texture is only replaced when the plane shows different data.
+   */
+  void updatePlaneActors();
+
   /**
    * @brief Returns true if there is only a single array in the filter output's point data.
    * Returns false if there are no arrays or more than one.
@@ -930,6 +1097,13 @@ protected:
    */
   void filterDeleted();
 
+  /**
+   * @brief Pins the filter output with the VSOutputMemoryPolicy while the filter is
+   * visible or selected and unpins it otherwise.  Hidden surface geometry is released
+   * when the policy releases hidden outputs.
+   */
+  void updateOutputRetention();
+
   /**
    * @brief Returns the array name based on the given index
    * @param index
@@ -991,7 +1165,9 @@ protected:
   void setSubsampling(int value);
 
   /**
-   * @brief Update the texture
+   * @brief Update the texture.  Flat images bind the coarser of the texture level and the
+   * level matching the subsampling rate, or the full resolution image while the image
+   * pyramid is being built.
    */
   void updateTexture();
 
@@ -999,13 +1175,16 @@ private:
   VSAbstractFilter* m_Filter = nullptr;
   ActorType m_ActorType = ActorType::Invalid;
   VTK_PTR(vtkDataSetSurfaceFilter) m_DataSetFilter = nullptr;
+  VTK_PTR(vtkDataSet) m_PointColorInput = nullptr;
   bool m_ShowFilter = true;
   QString m_ActiveArrayName;
   int m_ActiveComponent = -1;
   int m_Subsampling = 1;
+  int m_TextureLevel = 0;
   ColorMapping m_MapColors = ColorMapping::NonColors;
   Representation m_Representation = Representation::Default;
   AbstractImportMontageDialog::DisplayType m_DisplayType = AbstractImportMontageDialog::DisplayType::NotSpecified;
+  bool m_RenderedByMontage = false;
   VSTransform* m_DefaultTransform = nullptr;
   VTK_PTR(vtkAbstractMapper3D) m_Mapper = nullptr;
   VTK_PTR(vtkProp3D) m_Actor = nullptr;
@@ -1013,6 +1192,23 @@ private:
   VTK_PTR(vtkTexture) m_Texture = nullptr;
   VTK_PTR(vtkOutlineFilter) m_OutlineFilter = nullptr;
   VTK_PTR(vtkPlaneSource) m_Plane = nullptr;
+  VTK_PTR(vtkVolume) m_Volume = nullptr;
+  VTK_PTR(vtkSmartVolumeMapper) m_VolumeMapper = nullptr;
+  VTK_PTR(vtkImageData) m_VolumeComponentImage = nullptr;
+  vtkDataArray* m_VolumeComponentArray = nullptr;
+  vtkMTimeType m_VolumeComponentMTime = 0;
+  int m_VolumeComponent = 0;
+  VTK_PTR(vtkPiecewiseFunction) m_OpacityFunction = nullptr;
+  bool m_SliceTextured = false;
+  struct PlaneActor
+  {
+    VTK_PTR(vtkActor) m_Actor = nullptr;
+    VTK_PTR(vtkPlaneSource) m_Plane = nullptr;
+    VTK_PTR(vtkDataSetSurfaceFilter) m_SurfaceFilter = nullptr;
+    VTK_PTR(vtkTexture) m_Texture = nullptr;
+  };
+  std::vector<PlaneActor> m_PlaneActors;
+  QFutureWatcher<void> m_PyramidWatcher;
   VSLookupTableController* m_LookupTable = nullptr;
   ScalarBarSetting m_ScalarBarSetting = ScalarBarSetting::Never;
   double m_Alpha = 1.0;
@@ -1022,6 +1218,7 @@ private:
   VTK_PTR(vtkCubeAxesActor) m_CubeAxesActor = nullptr;
   bool m_GridVisible = false;
   bool m_Selected = false;
+  VSAbstractFilter* m_RetainedFilter = nullptr;
 
   QAction* m_SetColorAction = nullptr;
   QAction* m_SetOpacityAction = nullptr;
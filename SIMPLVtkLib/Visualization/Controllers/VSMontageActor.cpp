@@ -0,0 +1,955 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSMontageActor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QTimer>
+
+#include <vtkBoundingBox.h>
+#include <vtkCellArray.h>
+#include <vtkAlgorithm.h>
+#include <vtkAlgorithmOutput.h>
+#include <vtkCellData.h>
+#include <vtkColorTransferFunction.h>
+#include <vtkDataArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIntArray.h>
+#include <vtkMapper.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkSMPTools.h>
+#include <vtkTextProperty.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSImagePyramidCache.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+namespace
+{
+const int DefaultMaxTextureSize = 8192;
+
+/**
+ * @brief Describes where a tile's texels are copied into the atlas
+ */
+struct TileCopy
+{
+  VTK_PTR(vtkDataArray) m_Source = nullptr;
+  int m_SourceWidth = 0;
+  int m_Stride = 1;
+  int m_Offset[2] = {0, 0};
+  int m_Dimensions[2] = {0, 0};
+};
+
+/**
+ * @brief Returns the texture scalars of the given image and fills in their dimensions.
+ * Returns nullptr if the image has no texture scalars.
+ * @param imageData
+ * @param dims
+ * @return
+ */
+vtkDataArray* getTextureDimensions(vtkImageData* imageData, int dims[3])
+{
+  vtkDataArray* scalars = VSImagePyramidCache::GetTextureScalars(imageData);
+  if(nullptr == scalars)
+  {
+    dims[0] = dims[1] = dims[2] = 0;
+    return nullptr;
+  }
+
+  imageData->GetDimensions(dims);
+  if(imageData->GetCellData()->GetScalars() == scalars)
+  {
+    for(int d = 0; d < 3; d++)
+    {
+      dims[d] = std::max(dims[d] - 1, 1);
+    }
+  }
+  return scalars;
+}
+
+/**
+ * @brief Returns the image currently held by the tile's output port.  The port is not
+ * updated, so this is safe to call on the GUI thread.
+ * @param tile
+ * @return
+ */
+vtkImageData* getTileImage(VSFilterViewSettings* tile)
+{
+  vtkAlgorithmOutput* outputPort = (tile && tile->getFilter()) ? tile->getFilter()->getOutputPort() : nullptr;
+  if(nullptr == outputPort || nullptr == outputPort->GetProducer())
+  {
+    return nullptr;
+  }
+
+  return vtkImageData::SafeDownCast(outputPort->GetProducer()->GetOutputDataObject(outputPort->GetIndex()));
+}
+
+/**
+ * @brief Copies the world position of the corners of the tile's image plane.  Returns
+ * false if the tile is not a flat image.
+ * @param tile
+ * @param corners
+ * @return
+ */
+bool getTileCorners(VSFilterViewSettings* tile, double corners[4][3])
+{
+  VTK_NEW(vtkMatrix4x4, matrix);
+  if(nullptr == tile || false == tile->getImagePlaneMatrix(matrix))
+  {
+    return false;
+  }
+
+  // The plane is centered on the origin and spans one unit before the matrix is applied
+  const double local[4][2] = {{-0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}, {-0.5, 0.5}};
+  for(int c = 0; c < 4; c++)
+  {
+    double point[4] = {local[c][0], local[c][1], 0.0, 1.0};
+    matrix->MultiplyPoint(point, point);
+    for(int i = 0; i < 3; i++)
+    {
+      corners[c][i] = point[i] / point[3];
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns true if the tile maps its scalars through the lookup table instead of
+ * drawing them as colors
+ * @param tile
+ * @param scalars
+ * @return
+ */
+bool isMappingColors(VSFilterViewSettings* tile, vtkDataArray* scalars)
+{
+  switch(tile->getMapColors())
+  {
+  case VSFilterViewSettings::ColorMapping::Always:
+    return true;
+  case VSFilterViewSettings::ColorMapping::NonColors:
+  {
+    bool isColorArray = scalars && scalars->GetDataType() == VTK_UNSIGNED_CHAR && scalars->GetNumberOfComponents() == 3;
+    return !(isColorArray && tile->getActiveComponentIndex() == -1);
+  }
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Copies tile texels into the texture atlas, one tile per work item.  Every
+ * stride-th texel is kept when a tile's pyramid has not been built yet.
+ */
+class AtlasCopyFunctor
+{
+public:
+  AtlasCopyFunctor(const std::vector<TileCopy>& copies, vtkDataArray* atlas, int atlasWidth)
+  : m_Copies(copies)
+  , m_Atlas(atlas)
+  , m_AtlasWidth(atlasWidth)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    int numComps = m_Atlas->GetNumberOfComponents();
+    std::vector<double> tuple(numComps);
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      const TileCopy& copy = m_Copies[i];
+      bool sameType = copy.m_Source->GetDataType() == m_Atlas->GetDataType();
+      size_t tupleSize = static_cast<size_t>(numComps) * m_Atlas->GetDataTypeSize();
+      const char* source = static_cast<const char*>(copy.m_Source->GetVoidPointer(0));
+      char* destination = static_cast<char*>(m_Atlas->GetVoidPointer(0));
+
+      for(int y = 0; y < copy.m_Dimensions[1]; y++)
+      {
+        vtkIdType sourceRow = static_cast<vtkIdType>(y) * copy.m_Stride * copy.m_SourceWidth;
+        vtkIdType destRow = static_cast<vtkIdType>(copy.m_Offset[1] + y) * m_AtlasWidth + copy.m_Offset[0];
+        for(int x = 0; x < copy.m_Dimensions[0]; x++)
+        {
+          vtkIdType sourceId = sourceRow + static_cast<vtkIdType>(x) * copy.m_Stride;
+          vtkIdType destId = destRow + x;
+          if(sameType)
+          {
+            std::memcpy(destination + destId * tupleSize, source + sourceId * tupleSize, tupleSize);
+          }
+          else
+          {
+            copy.m_Source->GetTuple(sourceId, tuple.data());
+            m_Atlas->SetTuple(destId, tuple.data());
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const std::vector<TileCopy>& m_Copies;
+  vtkDataArray* m_Atlas;
+  int m_AtlasWidth;
+};
+
+/**
+ * @brief Creates the texture atlas and copies every tile into it.  Safe to call from a
+ * worker thread as the copies hold references to their source arrays.
+ * @param copies
+ * @param prototype
+ * @param atlasDims
+ * @return
+ */
+VTK_PTR(vtkImageData) buildAtlas(const std::vector<TileCopy>& copies, VTK_PTR(vtkDataArray) prototype, std::array<int, 2> atlasDims)
+{
+  VTK_PTR(vtkDataArray) atlasScalars;
+  atlasScalars.TakeReference(prototype->NewInstance());
+  atlasScalars->SetName(prototype->GetName());
+  atlasScalars->SetNumberOfComponents(prototype->GetNumberOfComponents());
+  atlasScalars->SetNumberOfTuples(static_cast<vtkIdType>(atlasDims[0]) * atlasDims[1]);
+  for(int comp = 0; comp < atlasScalars->GetNumberOfComponents(); comp++)
+  {
+    atlasScalars->FillComponent(comp, 0.0);
+  }
+
+  AtlasCopyFunctor functor(copies, atlasScalars, atlasDims[0]);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(copies.size()), functor);
+
+  VTK_NEW(vtkImageData, atlas);
+  atlas->SetDimensions(atlasDims[0], atlasDims[1], 1);
+  atlas->GetPointData()->SetScalars(atlasScalars);
+  return atlas;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSMontageActor::VSMontageActor(VSAbstractFilter* montageFilter, QObject* parent)
+: QObject(parent)
+, m_MontageFilter(montageFilter)
+, m_Texture(VTK_PTR(vtkTexture)::New())
+, m_PolyData(VTK_PTR(vtkPolyData)::New())
+, m_Mapper(VTK_PTR(vtkPolyDataMapper)::New())
+, m_Actor(VTK_PTR(vtkActor)::New())
+, m_ScalarBarActor(VTK_PTR(vtkScalarBarActor)::New())
+, m_ScalarBarWidget(VTK_PTR(vtkScalarBarWidget)::New())
+, m_LookupTable(new VSLookupTableController())
+, m_MaxTextureSize(DefaultMaxTextureSize)
+{
+  m_Texture->InterpolateOn();
+  m_Texture->SetLookupTable(m_LookupTable->getColorTransferFunction());
+
+  // Colors come from the texture rather than the quad's scalars
+  m_Mapper->SetInputData(m_PolyData);
+  m_Mapper->ScalarVisibilityOff();
+  m_Actor->SetMapper(m_Mapper);
+  m_Actor->SetTexture(m_Texture);
+
+  m_ScalarBarActor->SetLookupTable(m_LookupTable->getColorTransferFunction());
+  m_ScalarBarWidget->SetScalarBarActor(m_ScalarBarActor);
+
+  vtkTextProperty* titleProperty = m_ScalarBarActor->GetTitleTextProperty();
+  titleProperty->SetJustificationToCentered();
+  titleProperty->SetFontSize(titleProperty->GetFontSize() * 1.5);
+
+#if VTK_MAJOR_VERSION > 7 || (VTK_MAJOR_VERSION == 7 && VTK_MINOR_VERSION >= 1)
+  m_ScalarBarActor->UnconstrainedFontSizeOn();
+#endif
+
+  m_ScalarBarActor->SetTitleRatio(0.75);
+
+  connect(&m_AtlasWatcher, &QFutureWatcher<VTK_PTR(vtkImageData)>::finished, this, &VSMontageActor::finishAtlasUpdate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSMontageActor::~VSMontageActor()
+{
+  m_AtlasWatcher.waitForFinished();
+  delete m_LookupTable;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSMontageActor::getMontageFilter() const
+{
+  return m_MontageFilter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::addTile(VSFilterViewSettings* tile)
+{
+  if(nullptr == tile || hasTile(tile))
+  {
+    return;
+  }
+
+  m_Tiles.push_back(tile);
+
+  // Moving a tile only places its quad again and color changes only update the shared
+  // lookup table while data changes repack the atlas
+  connect(tile, &VSFilterViewSettings::requiresRender, this, &VSMontageActor::requestGeometryUpdate);
+  connect(tile, &VSFilterViewSettings::activeArrayNameChanged, this, &VSMontageActor::requestAtlasUpdate);
+  connect(tile, &VSFilterViewSettings::activeComponentIndexChanged, this, &VSMontageActor::requestLookupTableUpdate);
+  connect(tile, &VSFilterViewSettings::mapColorsChanged, this, &VSMontageActor::requestLookupTableUpdate);
+  connect(tile, &VSFilterViewSettings::lookupTableChanged, this, &VSMontageActor::requestLookupTableUpdate);
+  connect(tile, &VSFilterViewSettings::actorsUpdated, this, &VSMontageActor::requestAtlasUpdate);
+  connect(tile, &QObject::destroyed, this, &VSMontageActor::requestAtlasUpdate);
+  if(tile->getFilter())
+  {
+    connect(tile->getFilter(), &VSAbstractFilter::updatedOutput, this, &VSMontageActor::requestAtlasUpdate);
+  }
+
+  requestAtlasUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::removeTile(VSFilterViewSettings* tile)
+{
+  auto iter = std::find(m_Tiles.begin(), m_Tiles.end(), tile);
+  if(nullptr == tile || iter == m_Tiles.end())
+  {
+    return;
+  }
+
+  m_Tiles.erase(iter);
+  disconnect(tile, nullptr, this, nullptr);
+  if(tile->getFilter())
+  {
+    disconnect(tile->getFilter(), nullptr, this, nullptr);
+  }
+
+  requestAtlasUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMontageActor::hasTile(VSFilterViewSettings* tile) const
+{
+  return std::find(m_Tiles.begin(), m_Tiles.end(), tile) != m_Tiles.end();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSMontageActor::getNumberOfTiles() const
+{
+  return static_cast<int>(std::count_if(m_Tiles.begin(), m_Tiles.end(), [](const QPointer<VSFilterViewSettings>& tile) { return !tile.isNull(); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMontageActor::isScalarBarVisible() const
+{
+  return std::any_of(m_Tiles.begin(), m_Tiles.end(), [](const QPointer<VSFilterViewSettings>& tile) { return tile && tile->isScalarBarVisible(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkActor) VSMontageActor::getActor() const
+{
+  return m_Actor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkScalarBarWidget) VSMontageActor::getScalarBarWidget() const
+{
+  return m_ScalarBarWidget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSLookupTableController* VSMontageActor::getLookupTableController() const
+{
+  return m_LookupTable;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSMontageActor::getMaxTextureSize() const
+{
+  return m_MaxTextureSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::setMaxTextureSize(int size)
+{
+  size = std::max(size, 1);
+  if(size == m_MaxTextureSize)
+  {
+    return;
+  }
+
+  m_MaxTextureSize = size;
+  requestAtlasUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSMontageActor::getTextureLevel() const
+{
+  return m_TextureLevel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSMontageActor::getRequestedTextureLevel() const
+{
+  return m_RequestedLevel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::setRequestedTextureLevel(int level)
+{
+  level = std::max(level, 0);
+  if(level == m_RequestedLevel)
+  {
+    return;
+  }
+
+  // Only rebuild the atlas when its level or the tile actor fallback changes
+  int previousLevel = std::max(m_RequestedLevel, m_FitLevel);
+  m_RequestedLevel = level;
+  if(std::max(level, m_FitLevel) != previousLevel || (level < m_FitLevel) != m_UsesTileActors)
+  {
+    requestAtlasUpdate();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMontageActor::usesTileActors() const
+{
+  return m_UsesTileActors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSMontageActor::getSourceTexelCount() const
+{
+  return m_SourceTexelCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::getBounds(double bounds[6]) const
+{
+  vtkBoundingBox boundingBox;
+  for(const QPointer<VSFilterViewSettings>& tile : m_Tiles)
+  {
+    double corners[4][3];
+    if(getTileCorners(tile, corners))
+    {
+      for(int c = 0; c < 4; c++)
+      {
+        boundingBox.AddPoint(corners[c]);
+      }
+    }
+  }
+
+  if(boundingBox.IsValid())
+  {
+    boundingBox.GetBounds(bounds);
+  }
+  else
+  {
+    vtkMath::UninitializeBounds(bounds);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewSettings* VSMontageActor::getTile(vtkIdType cellId) const
+{
+  vtkIntArray* tileIds = vtkIntArray::SafeDownCast(m_PolyData->GetCellData()->GetArray("TileId"));
+  if(nullptr == tileIds || cellId < 0 || cellId >= tileIds->GetNumberOfTuples())
+  {
+    return nullptr;
+  }
+
+  int index = tileIds->GetValue(cellId);
+  if(index < 0 || index >= static_cast<int>(m_CellTiles.size()))
+  {
+    return nullptr;
+  }
+  return m_CellTiles[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::requestGeometryUpdate()
+{
+  m_GeometryDirty = true;
+  scheduleUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::requestAtlasUpdate()
+{
+  m_AtlasDirty = true;
+  scheduleUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::requestLookupTableUpdate()
+{
+  m_LookupTableDirty = true;
+  scheduleUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::scheduleUpdate()
+{
+  // Tiles often change together, so the montage is only rebuilt once per event loop pass
+  if(m_UpdateScheduled)
+  {
+    return;
+  }
+
+  m_UpdateScheduled = true;
+  QTimer::singleShot(0, this, [this] {
+    m_UpdateScheduled = false;
+    applyUpdates();
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::watchPyramidBuild(vtkImageData* imageData)
+{
+  const vtkDataArray* scalars = VSImagePyramidCache::GetTextureScalars(imageData);
+  if(nullptr == scalars || m_PendingPyramids.count(scalars) > 0)
+  {
+    return;
+  }
+
+  QFuture<void> build = VSImagePyramidCache::Instance()->getBuildFuture(imageData);
+  if(build.isFinished())
+  {
+    return;
+  }
+
+  m_PendingPyramids.insert(scalars);
+  QFutureWatcher<void>* watcher = new QFutureWatcher<void>(this);
+  connect(watcher, &QFutureWatcher<void>::finished, this, [this, watcher, scalars] {
+    m_PendingPyramids.erase(scalars);
+    watcher->deleteLater();
+    requestAtlasUpdate();
+  });
+  watcher->setFuture(build);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::setUsesTileActors(bool useTileActors)
+{
+  if(useTileActors == m_UsesTileActors)
+  {
+    return;
+  }
+
+  m_UsesTileActors = useTileActors;
+  emit usesTileActorsChanged(m_UsesTileActors);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::applyUpdates()
+{
+  if(false == (m_AtlasDirty || m_GeometryDirty || m_LookupTableDirty))
+  {
+    return;
+  }
+
+  if(m_AtlasDirty)
+  {
+    updateAtlas();
+  }
+  if(m_GeometryDirty)
+  {
+    updateGeometry();
+  }
+  if(m_LookupTableDirty)
+  {
+    updateLookupTable();
+  }
+
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::updateAtlas()
+{
+  // Changes made while an atlas is built are applied once the build finishes
+  if(m_AtlasWatcher.isRunning())
+  {
+    return;
+  }
+
+  m_AtlasDirty = false;
+  m_Tiles.erase(std::remove_if(m_Tiles.begin(), m_Tiles.end(), [](const QPointer<VSFilterViewSettings>& tile) { return tile.isNull(); }), m_Tiles.end());
+  std::vector<TileLayout> layouts(m_Tiles.size());
+
+  // Collect the texture of each tile.  The first tile decides the atlas array type.
+  std::vector<vtkImageData*> images(m_Tiles.size(), nullptr);
+  std::vector<vtkDataArray*> tileScalars(m_Tiles.size(), nullptr);
+  std::vector<std::array<int, 2>> tileDims(m_Tiles.size(), {{0, 0}});
+  vtkDataArray* firstScalars = nullptr;
+  int maxDims[2] = {0, 0};
+  int numTiles = 0;
+  m_SourceTexelCount = 0;
+  for(size_t i = 0; i < m_Tiles.size(); i++)
+  {
+    images[i] = getTileImage(m_Tiles[i]);
+    int dims[3];
+    vtkDataArray* scalars = getTextureDimensions(images[i], dims);
+    if(nullptr == scalars)
+    {
+      continue;
+    }
+
+    // Only flat tiles with matching components can share the atlas
+    if(dims[2] != 1 || (firstScalars && firstScalars->GetNumberOfComponents() != scalars->GetNumberOfComponents()))
+    {
+      continue;
+    }
+    if(nullptr == firstScalars)
+    {
+      firstScalars = scalars;
+    }
+
+    tileScalars[i] = scalars;
+    tileDims[i] = {{dims[0], dims[1]}};
+    maxDims[0] = std::max(maxDims[0], dims[0]);
+    maxDims[1] = std::max(maxDims[1], dims[1]);
+    m_SourceTexelCount += scalars->GetNumberOfTuples();
+    numTiles++;
+  }
+
+  if(0 == numTiles)
+  {
+    m_FitLevel = 0;
+    m_Atlas = nullptr;
+    m_AtlasTiles.clear();
+    m_Layout.clear();
+    m_Texture->RemoveAllInputs();
+    m_PolyData->Initialize();
+    m_PolyData->Modified();
+    setUsesTileActors(false);
+    return;
+  }
+
+  // Tiles are packed in a grid, halving their resolution until the grid fits
+  int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(numTiles))));
+  int rows = (numTiles + columns - 1) / columns;
+  int stride = 1;
+  m_FitLevel = 0;
+  while(m_FitLevel < 30 && (columns * ((maxDims[0] + stride - 1) / stride) > m_MaxTextureSize || rows * ((maxDims[1] + stride - 1) / stride) > m_MaxTextureSize))
+  {
+    m_FitLevel++;
+    stride *= 2;
+  }
+
+  // An atlas coarser than the view requires would blur the tiles, so they are drawn by their own actors
+  if(m_RequestedLevel < m_FitLevel)
+  {
+    m_TextureLevel = m_FitLevel;
+    m_Atlas = nullptr;
+    m_AtlasTiles.clear();
+    m_Layout.clear();
+    m_Texture->RemoveAllInputs();
+    m_PolyData->Initialize();
+    m_PolyData->Modified();
+    m_CellTiles.clear();
+    setUsesTileActors(true);
+    return;
+  }
+
+  m_TextureLevel = std::min(m_RequestedLevel, 30);
+  stride = 1 << m_TextureLevel;
+
+  int cellDims[2] = {(maxDims[0] + stride - 1) / stride, (maxDims[1] + stride - 1) / stride};
+  std::array<int, 2> atlasDims = {{columns * cellDims[0], rows * cellDims[1]}};
+
+  // Downsampled tiles are copied from their box-filtered pyramid level.  Tiles whose
+  // pyramid is still building are stride sampled until the build finishes.
+  VSImagePyramidCache* pyramidCache = VSImagePyramidCache::Instance();
+  std::vector<TileCopy> copies;
+  copies.reserve(numTiles);
+  int tileIndex = 0;
+  for(size_t i = 0; i < m_Tiles.size(); i++)
+  {
+    if(nullptr == tileScalars[i])
+    {
+      continue;
+    }
+
+    TileLayout& layout = layouts[i];
+    layout.m_Offset = {{(tileIndex % columns) * cellDims[0], (tileIndex / columns) * cellDims[1]}};
+    layout.m_Dimensions = {{(tileDims[i][0] + stride - 1) / stride, (tileDims[i][1] + stride - 1) / stride}};
+    tileIndex++;
+
+    TileCopy copy;
+    copy.m_Source = tileScalars[i];
+    copy.m_SourceWidth = tileDims[i][0];
+    copy.m_Stride = stride;
+    copy.m_Offset[0] = layout.m_Offset[0];
+    copy.m_Offset[1] = layout.m_Offset[1];
+    copy.m_Dimensions[0] = layout.m_Dimensions[0];
+    copy.m_Dimensions[1] = layout.m_Dimensions[1];
+
+    if(m_TextureLevel > 0)
+    {
+      VSImagePyramidCache::PyramidPtr pyramid = pyramidCache->getPyramid(images[i]);
+      VTK_PTR(vtkImageData) levelImage;
+      if(pyramid)
+      {
+        levelImage = pyramid->getLevel(m_TextureLevel);
+      }
+      int levelDims[3];
+      vtkDataArray* levelScalars = getTextureDimensions(levelImage, levelDims);
+      if(levelScalars && levelScalars->GetNumberOfComponents() == tileScalars[i]->GetNumberOfComponents())
+      {
+        copy.m_Source = levelScalars;
+        copy.m_SourceWidth = levelDims[0];
+        copy.m_Stride = 1;
+        copy.m_Dimensions[0] = std::min(copy.m_Dimensions[0], levelDims[0]);
+        copy.m_Dimensions[1] = std::min(copy.m_Dimensions[1], levelDims[1]);
+      }
+      else if(nullptr == pyramid)
+      {
+        watchPyramidBuild(images[i]);
+      }
+    }
+    copies.push_back(copy);
+  }
+
+  // The texels are copied on a worker thread and the atlas is shown once it finishes
+  m_PendingTiles = m_Tiles;
+  m_PendingLayout = layouts;
+  VTK_PTR(vtkDataArray) prototype = firstScalars;
+  m_AtlasWatcher.setFuture(QtConcurrent::run([copies, prototype, atlasDims]() { return buildAtlas(copies, prototype, atlasDims); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::finishAtlasUpdate()
+{
+  VTK_PTR(vtkImageData) atlas = m_AtlasWatcher.result();
+
+  // The tiles changed during the build, so the atlas is built again
+  if(m_AtlasDirty)
+  {
+    scheduleUpdate();
+    return;
+  }
+
+  m_Atlas = atlas;
+  m_AtlasTiles = m_PendingTiles;
+  m_Layout = m_PendingLayout;
+  m_PendingTiles.clear();
+  m_PendingLayout.clear();
+  m_Texture->SetInputData(m_Atlas);
+
+  updateLookupTable();
+  updateGeometry();
+  setUsesTileActors(false);
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::updateLookupTable()
+{
+  m_LookupTableDirty = false;
+  vtkDataArray* atlasScalars = m_Atlas ? m_Atlas->GetPointData()->GetScalars() : nullptr;
+  if(nullptr == atlasScalars)
+  {
+    return;
+  }
+
+  // The first tile decides the colors and mapping while the range covers every tile.
+  // Tile ranges come from their lookup tables, so no array is scanned here.
+  VSFilterViewSettings* firstTile = nullptr;
+  double range[2] = {VTK_DOUBLE_MAX, VTK_DOUBLE_MIN};
+  for(size_t i = 0; i < m_AtlasTiles.size() && i < m_Layout.size(); i++)
+  {
+    VSFilterViewSettings* tile = m_AtlasTiles[i];
+    if(nullptr == tile || nullptr == tile->getLookupTableController() || 0 == m_Layout[i].m_Dimensions[0])
+    {
+      continue;
+    }
+    if(nullptr == firstTile)
+    {
+      firstTile = tile;
+    }
+
+    double tileRange[2];
+    tile->getColorRange(tileRange);
+    range[0] = std::min(range[0], tileRange[0]);
+    range[1] = std::max(range[1], tileRange[1]);
+  }
+
+  if(nullptr == firstTile)
+  {
+    return;
+  }
+
+  m_LookupTable->copy(*firstTile->getLookupTableController());
+  m_LookupTable->setRange(range);
+
+  // Multi-component tiles are colored by their active component or its magnitude
+  int component = firstTile->getActiveComponentIndex();
+  vtkColorTransferFunction* colors = m_LookupTable->getColorTransferFunction();
+  if(component < 0 && atlasScalars->GetNumberOfComponents() > 1)
+  {
+    colors->SetVectorModeToMagnitude();
+  }
+  else
+  {
+    colors->SetVectorModeToComponent();
+    colors->SetVectorComponent(std::min(std::max(component, 0), atlasScalars->GetNumberOfComponents() - 1));
+  }
+
+  if(isMappingColors(firstTile, atlasScalars))
+  {
+    m_Texture->SetColorModeToMapScalars();
+  }
+  else
+  {
+    m_Texture->SetColorModeToDirectScalars();
+  }
+
+  // Every tile shares one scalar bar
+  m_ScalarBarActor->SetTitle(qPrintable(firstTile->getActiveComponentName()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMontageActor::updateGeometry()
+{
+  m_GeometryDirty = false;
+  if(nullptr == m_Atlas || m_Layout.size() != m_AtlasTiles.size())
+  {
+    return;
+  }
+
+  int atlasDims[3];
+  m_Atlas->GetDimensions(atlasDims);
+
+  VTK_NEW(vtkPoints, points);
+  VTK_NEW(vtkCellArray, polys);
+  VTK_NEW(vtkFloatArray, tcoords);
+  tcoords->SetName("TextureCoordinates");
+  tcoords->SetNumberOfComponents(2);
+
+  // Each quad records the tile it draws so that picking can select the tile
+  VTK_NEW(vtkIntArray, tileIds);
+  tileIds->SetName("TileId");
+
+  for(size_t i = 0; i < m_AtlasTiles.size(); i++)
+  {
+    // Each quad covers the tile's own plane, placed by the tile's transform
+    const TileLayout& layout = m_Layout[i];
+    double corners[4][3];
+    if(0 == layout.m_Dimensions[0] || 0 == layout.m_Dimensions[1] || false == getTileCorners(m_AtlasTiles[i], corners))
+    {
+      continue;
+    }
+
+    // Texture coordinates stay half a texel inside the tile to avoid sampling its neighbors
+    double u[2] = {(layout.m_Offset[0] + 0.5) / atlasDims[0], (layout.m_Offset[0] + layout.m_Dimensions[0] - 0.5) / atlasDims[0]};
+    double v[2] = {(layout.m_Offset[1] + 0.5) / atlasDims[1], (layout.m_Offset[1] + layout.m_Dimensions[1] - 0.5) / atlasDims[1]};
+
+    const int cornerCoords[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    vtkIdType ids[4];
+    for(int c = 0; c < 4; c++)
+    {
+      ids[c] = points->InsertNextPoint(corners[c]);
+      tcoords->InsertNextTuple2(u[cornerCoords[c][0]], v[cornerCoords[c][1]]);
+    }
+    polys->InsertNextCell(4, ids);
+    tileIds->InsertNextValue(static_cast<int>(i));
+  }
+
+  m_CellTiles = m_AtlasTiles;
+  m_PolyData->SetPoints(points);
+  m_PolyData->SetPolys(polys);
+  m_PolyData->GetPointData()->SetTCoords(tcoords);
+  m_PolyData->GetCellData()->AddArray(tileIds);
+  m_PolyData->Modified();
+}
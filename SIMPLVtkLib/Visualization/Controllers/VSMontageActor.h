@@ -0,0 +1,302 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <array>
+#include <set>
+#include <vector>
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+
+#include <vtkActor.h>
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkScalarBarActor.h>
+#include <vtkScalarBarWidget.h>
+#include <vtkTexture.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewSettings.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class VSAbstractFilter;
+
+/**
+ * @class VSMontageActor VSMontageActor.h SIMPLVtkLib/Visualization/Controllers/VSMontageActor.h
+ * @brief This class renders every flat image tile of a montage with a single actor.
+ * The tile images are packed into one texture atlas on a worker thread and each tile is
+ * drawn as a quad placed by the tile's own transform.  The lookup table and scalar bar
+ * are shared by all tiles and seeded from the tiles' colors so that the number of draw
+ * calls and VTK objects per frame does not grow with the number of tiles.  Tiles drawn
+ * by the montage do not create actors of their own.  Tiles are copied from their image pyramid level when the
+ * view requests a coarser level or the atlas would exceed the maximum texture size.
+ * When the view requests more detail than the atlas can hold, the tiles are drawn by
+ * their own actors instead.
+ */
+class SIMPLVtkLib_EXPORT VSMontageActor : public QObject
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param montageFilter
+   * @param parent
+   */
+  VSMontageActor(VSAbstractFilter* montageFilter, QObject* parent = nullptr);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSMontageActor();
+
+  /**
+   * @brief Returns the filter whose children are rendered as tiles
+   * @return
+   */
+  VSAbstractFilter* getMontageFilter() const;
+
+  /**
+   * @brief Adds a tile to the montage.  Does nothing if the tile has already been added.
+   * @param tile
+   */
+  void addTile(VSFilterViewSettings* tile);
+
+  /**
+   * @brief Removes a tile from the montage
+   * @param tile
+   */
+  void removeTile(VSFilterViewSettings* tile);
+
+  /**
+   * @brief Returns true if the given tile is rendered by the montage
+   * @param tile
+   * @return
+   */
+  bool hasTile(VSFilterViewSettings* tile) const;
+
+  /**
+   * @brief Returns the number of tiles rendered by the montage
+   * @return
+   */
+  int getNumberOfTiles() const;
+
+  /**
+   * @brief Returns true if any tile requests its scalar bar
+   * @return
+   */
+  bool isScalarBarVisible() const;
+
+  /**
+   * @brief Returns the actor rendering every tile
+   * @return
+   */
+  VTK_PTR(vtkActor) getActor() const;
+
+  /**
+   * @brief Returns the scalar bar widget shared by every tile
+   * @return
+   */
+  VTK_PTR(vtkScalarBarWidget) getScalarBarWidget() const;
+
+  /**
+   * @brief Returns the lookup table shared by every tile
+   * @return
+   */
+  VSLookupTableController* getLookupTableController() const;
+
+  /**
+   * @brief Returns the maximum width and height of the texture atlas
+   * @return
+   */
+  int getMaxTextureSize() const;
+
+  /**
+   * @brief Sets the maximum width and height of the texture atlas
+   * @param size
+   */
+  void setMaxTextureSize(int size);
+
+  /**
+   * @brief Returns the pyramid level copied into the atlas
+   * @return
+   */
+  int getTextureLevel() const;
+
+  /**
+   * @brief Returns the pyramid level requested for the montage's size on screen
+   * @return
+   */
+  int getRequestedTextureLevel() const;
+
+  /**
+   * @brief Sets the pyramid level requested for the montage's size on screen.  The atlas
+   * uses this level unless the tiles only fit in the atlas at a coarser level.  In that
+   * case the tiles are drawn by their own actors.
+   * @param level
+   */
+  void setRequestedTextureLevel(int level);
+
+  /**
+   * @brief Returns true if the tiles should be drawn by their own actors because the
+   * atlas cannot hold the requested level
+   * @return
+   */
+  bool usesTileActors() const;
+
+  /**
+   * @brief Returns the number of texels of every tile at full resolution
+   * @return
+   */
+  vtkIdType getSourceTexelCount() const;
+
+  /**
+   * @brief Returns the world bounds of every tile's actor
+   * @param bounds
+   */
+  void getBounds(double bounds[6]) const;
+
+  /**
+   * @brief Returns the tile drawn by the given cell of the montage actor
+   * @param cellId
+   * @return
+   */
+  VSFilterViewSettings* getTile(vtkIdType cellId) const;
+
+signals:
+  void requiresRender();
+  void usesTileActorsChanged(bool useTileActors);
+
+protected slots:
+  /**
+   * @brief Schedules the tile quads to be placed again
+   */
+  void requestGeometryUpdate();
+
+  /**
+   * @brief Schedules the texture atlas to be rebuilt
+   */
+  void requestAtlasUpdate();
+
+  /**
+   * @brief Schedules the shared lookup table to be copied from the tiles again
+   */
+  void requestLookupTableUpdate();
+
+protected:
+  /**
+   * @brief Lays out the current tiles and starts building the texture atlas on a worker
+   * thread.  Only one atlas is built at a time.
+   */
+  void updateAtlas();
+
+  /**
+   * @brief Shows the atlas built by updateAtlas unless the tiles changed during the build
+   */
+  void finishAtlasUpdate();
+
+  /**
+   * @brief Copies the colors, range, and color mapping of the tiles into the shared lookup table
+   */
+  void updateLookupTable();
+
+  /**
+   * @brief Places a textured quad for each tile using the tile's transform
+   */
+  void updateGeometry();
+
+  /**
+   * @brief Performs any scheduled updates and requests a render
+   */
+  void applyUpdates();
+
+  /**
+   * @brief Schedules the pending updates to be performed once control returns to the event loop
+   */
+  void scheduleUpdate();
+
+  /**
+   * @brief Rebuilds the atlas once the given image's pyramid has been built
+   * @param imageData
+   */
+  void watchPyramidBuild(vtkImageData* imageData);
+
+  /**
+   * @brief Notifies the view when the tiles switch between the atlas and their own actors
+   * @param useTileActors
+   */
+  void setUsesTileActors(bool useTileActors);
+
+private:
+  struct TileLayout
+  {
+    std::array<int, 2> m_Offset = {{0, 0}};
+    std::array<int, 2> m_Dimensions = {{0, 0}};
+  };
+
+  VSAbstractFilter* m_MontageFilter = nullptr;
+  std::vector<QPointer<VSFilterViewSettings>> m_Tiles;
+  std::vector<QPointer<VSFilterViewSettings>> m_AtlasTiles;
+  std::vector<TileLayout> m_Layout;
+  std::vector<QPointer<VSFilterViewSettings>> m_PendingTiles;
+  std::vector<TileLayout> m_PendingLayout;
+  QFutureWatcher<VTK_PTR(vtkImageData)> m_AtlasWatcher;
+  std::vector<QPointer<VSFilterViewSettings>> m_CellTiles;
+  std::set<const vtkDataArray*> m_PendingPyramids;
+  VTK_PTR(vtkImageData) m_Atlas = nullptr;
+  VTK_PTR(vtkTexture) m_Texture = nullptr;
+  VTK_PTR(vtkPolyData) m_PolyData = nullptr;
+  VTK_PTR(vtkPolyDataMapper) m_Mapper = nullptr;
+  VTK_PTR(vtkActor) m_Actor = nullptr;
+  VTK_PTR(vtkScalarBarActor) m_ScalarBarActor = nullptr;
+  VTK_PTR(vtkScalarBarWidget) m_ScalarBarWidget = nullptr;
+  VSLookupTableController* m_LookupTable = nullptr;
+  int m_MaxTextureSize;
+  int m_TextureLevel = 0;
+  int m_RequestedLevel = 0;
+  int m_FitLevel = 0;
+  vtkIdType m_SourceTexelCount = 0;
+  bool m_UsesTileActors = false;
+  bool m_AtlasDirty = false;
+  bool m_GeometryDirty = false;
+  bool m_LookupTableDirty = false;
+  bool m_UpdateScheduled = false;
+};
@@ -0,0 +1,225 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSOutputMemoryPolicy.h"
+
+#include <QtCore/QTimer>
+
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOutputMemoryPolicy* VSOutputMemoryPolicy::Instance()
+{
+  static VSOutputMemoryPolicy policy;
+  return &policy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOutputMemoryPolicy::isEnabled() const
+{
+  return m_ReleaseHiddenOutputs || m_MemoryBudget > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOutputMemoryPolicy::getReleaseHiddenOutputs() const
+{
+  return m_ReleaseHiddenOutputs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::setReleaseHiddenOutputs(bool release)
+{
+  m_ReleaseHiddenOutputs = release;
+  requestRelease();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSOutputMemoryPolicy::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::setMemoryBudget(size_t bytes)
+{
+  m_MemoryBudget = bytes;
+  requestRelease();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSOutputMemoryPolicy::getMemoryUsage() const
+{
+  size_t usage = 0;
+  for(VSAbstractFilter* filter : m_UsageOrder)
+  {
+    usage += filter->getOutputMemorySize();
+  }
+
+  return usage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::pinOutput(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  m_Pins[filter]++;
+
+  // Starts regenerating the output in the background if it was released while unpinned
+  filter->getOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::unpinOutput(VSAbstractFilter* filter)
+{
+  auto iter = m_Pins.find(filter);
+  if(iter == m_Pins.end())
+  {
+    return;
+  }
+
+  if(--iter.value() <= 0)
+  {
+    m_Pins.erase(iter);
+    requestRelease();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOutputMemoryPolicy::isPinned(VSAbstractFilter* filter) const
+{
+  for(auto iter = m_Pins.constBegin(); iter != m_Pins.constEnd(); ++iter)
+  {
+    if(iter.key()->getOutputSource() == filter)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::outputUsed(VSAbstractFilter* filter)
+{
+  m_UsageOrder.remove(filter);
+  m_UsageOrder.push_front(filter);
+
+  if(isEnabled())
+  {
+    requestRelease();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::removeFilter(VSAbstractFilter* filter)
+{
+  m_UsageOrder.remove(filter);
+  m_Pins.remove(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::requestRelease()
+{
+  if(m_ReleasePending || false == isEnabled())
+  {
+    return;
+  }
+
+  m_ReleasePending = true;
+  QTimer::singleShot(0, [this] { releaseOutputs(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputMemoryPolicy::releaseOutputs()
+{
+  m_ReleasePending = false;
+  if(false == isEnabled())
+  {
+    return;
+  }
+
+  size_t usage = getMemoryUsage();
+
+  // Copy the usage order because released filters are not removed from it
+  const std::list<VSAbstractFilter*> usageOrder = m_UsageOrder;
+  for(auto iter = usageOrder.rbegin(); iter != usageOrder.rend(); ++iter)
+  {
+    VSAbstractFilter* filter = *iter;
+    bool overBudget = m_MemoryBudget > 0 && usage > m_MemoryBudget;
+    if(false == (m_ReleaseHiddenOutputs || overBudget))
+    {
+      break;
+    }
+
+    if(false == filter->canReleaseOutput() || isPinned(filter))
+    {
+      continue;
+    }
+
+    usage -= filter->getOutputMemorySize();
+    filter->releaseOutput();
+  }
+}
@@ -0,0 +1,155 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <list>
+
+#include <QtCore/QHash>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class VSAbstractFilter;
+
+/**
+ * @class VSOutputMemoryPolicy VSOutputMemoryPolicy.h SIMPLVtkLib/Visualization/Controllers/VSOutputMemoryPolicy.h
+ * @brief This class decides when the applied outputs of visual filters are released.
+ * Outputs are pinned while a view shows or selects their filter.  Unpinned outputs can
+ * be released as soon as they are no longer needed, and the least recently used
+ * unpinned outputs are released whenever the resident outputs exceed the memory budget.
+ * Released outputs are regenerated from their parent on a worker thread the next time their
+ * output port is requested.  Both options are disabled by default so that every output stays
+ * resident; applications opt in with setReleaseHiddenOutputs or setMemoryBudget.
+ */
+class SIMPLVtkLib_EXPORT VSOutputMemoryPolicy
+{
+public:
+  /**
+   * @brief Returns the application-wide output memory policy
+   * @return
+   */
+  static VSOutputMemoryPolicy* Instance();
+
+  virtual ~VSOutputMemoryPolicy() = default;
+
+  /**
+   * @brief Returns true if any outputs may be released.  Returns false otherwise.
+   * @return
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Returns true if outputs are released as soon as they are unpinned
+   * @return
+   */
+  bool getReleaseHiddenOutputs() const;
+
+  /**
+   * @brief Sets whether or not outputs are released as soon as they are unpinned
+   * @param release
+   */
+  void setReleaseHiddenOutputs(bool release);
+
+  /**
+   * @brief Returns the memory budget in bytes.  A budget of 0 is unlimited.
+   * @return
+   */
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Sets the memory budget in bytes and releases outputs until they fit.
+   * A budget of 0 is unlimited.
+   * @param bytes
+   */
+  void setMemoryBudget(size_t bytes);
+
+  /**
+   * @brief Returns the number of bytes used by the resident filter outputs
+   * @return
+   */
+  size_t getMemoryUsage() const;
+
+  /**
+   * @brief Keeps the output used by the given filter resident until it is unpinned.
+   * Filters that pass their parent's output through pin that output instead.
+   * @param filter
+   */
+  void pinOutput(VSAbstractFilter* filter);
+
+  /**
+   * @brief Removes a pin added by pinOutput
+   * @param filter
+   */
+  void unpinOutput(VSAbstractFilter* filter);
+
+  /**
+   * @brief Marks the filter output as the most recently used
+   * @param filter
+   */
+  void outputUsed(VSAbstractFilter* filter);
+
+  /**
+   * @brief Forgets the given filter.  Called when the filter is destroyed.
+   * @param filter
+   */
+  void removeFilter(VSAbstractFilter* filter);
+
+  /**
+   * @brief Releases outputs according to the policy.  Outputs are released once control
+   * returns to the event loop so that callers can finish using the outputs they requested.
+   */
+  void requestRelease();
+
+  /**
+   * @brief Releases outputs according to the policy immediately
+   */
+  void releaseOutputs();
+
+protected:
+  VSOutputMemoryPolicy() = default;
+
+  /**
+   * @brief Returns true if the output used by the given filter is pinned
+   * @param filter
+   * @return
+   */
+  bool isPinned(VSAbstractFilter* filter) const;
+
+private:
+  std::list<VSAbstractFilter*> m_UsageOrder;
+  QHash<VSAbstractFilter*, int> m_Pins;
+  bool m_ReleaseHiddenOutputs = false;
+  size_t m_MemoryBudget = 0;
+  bool m_ReleasePending = false;
+};
@@ -0,0 +1,135 @@
+/* ============================================================================
+ * Copyright (c) 2009-2015 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSWorkStealingQueue.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSWorkStealingQueue::VSWorkStealingQueue(size_t capacity)
+: m_Top(0)
+, m_Bottom(0)
+{
+  reset(capacity);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSWorkStealingQueue::reset(size_t capacity)
+{
+  if(capacity != m_Capacity || nullptr == m_Buffer)
+  {
+    m_Capacity = capacity;
+    m_Buffer.reset(new std::atomic<int>[capacity > 0 ? capacity : 1]);
+  }
+
+  m_Top.store(0, std::memory_order_relaxed);
+  m_Bottom.store(0, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSWorkStealingQueue::push(int task)
+{
+  int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+  int64_t top = m_Top.load(std::memory_order_acquire);
+  if(bottom - top >= static_cast<int64_t>(m_Capacity))
+  {
+    return false;
+  }
+
+  m_Buffer[bottom % m_Capacity].store(task, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSWorkStealingQueue::pop(int& task)
+{
+  int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+  m_Bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top = m_Top.load(std::memory_order_relaxed);
+
+  if(top > bottom)
+  {
+    // Empty queue
+    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  task = m_Buffer[bottom % m_Capacity].load(std::memory_order_relaxed);
+  if(top == bottom)
+  {
+    // Last task in the queue.  Race any thieves for it.
+    bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSWorkStealingQueue::steal(int& task)
+{
+  int64_t top = m_Top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+  if(top >= bottom)
+  {
+    return false;
+  }
+
+  task = m_Buffer[top % m_Capacity].load(std::memory_order_relaxed);
+  return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSWorkStealingQueue::empty() const
+{
+  int64_t top = m_Top.load(std::memory_order_acquire);
+  int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+  return top >= bottom;
+}
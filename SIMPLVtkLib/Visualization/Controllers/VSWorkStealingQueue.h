@@ -0,0 +1,109 @@
+/* ============================================================================
+ * Copyright (c) 2009-2015 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSWorkStealingQueue VSWorkStealingQueue.h SIMPLVtkLib/Visualization/Controllers/VSWorkStealingQueue.h
+ * @brief This class is a fixed capacity, lock-free work stealing deque of task IDs
+ * based on the Chase-Lev algorithm.  A single owner thread pushes and pops tasks
+ * from the bottom of the queue while any other thread may steal tasks from the top.
+ * The capacity must be large enough to hold every task pushed between resets.
+ */
+class SIMPLVtkLib_EXPORT VSWorkStealingQueue
+{
+public:
+  /**
+   * @brief Constructor
+   * @param capacity
+   */
+  VSWorkStealingQueue(size_t capacity = 0);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSWorkStealingQueue() = default;
+
+  /**
+   * @brief Clears the queue and sets the maximum number of tasks it can hold.
+   * This is not thread safe and should only be called while no other thread is using the queue.
+   * @param capacity
+   */
+  void reset(size_t capacity);
+
+  /**
+   * @brief Pushes a task to the bottom of the queue.  Returns false if the queue is full.
+   * This should only be called from the thread that owns the queue.
+   * @param task
+   * @return
+   */
+  bool push(int task);
+
+  /**
+   * @brief Pops the most recently pushed task from the bottom of the queue.  Returns
+   * false if the queue is empty. This should only be called from the thread that owns the queue.
+   * @param task
+   * @return
+   */
+  bool pop(int& task);
+
+  /**
+   * @brief Steals the oldest task from the top of the queue.  Returns false if the
+   * queue is empty or another thread took the task first.  This can be called from any thread.
+   * @param task
+   * @return
+   */
+  bool steal(int& task);
+
+  /**
+   * @brief Returns true if the queue did not contain any tasks when checked
+   * @return
+   */
+  bool empty() const;
+
+private:
+  std::unique_ptr<std::atomic<int>[]> m_Buffer;
+  size_t m_Capacity = 0;
+  std::atomic<int64_t> m_Top;
+  std::atomic<int64_t> m_Bottom;
+
+  VSWorkStealingQueue(const VSWorkStealingQueue&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSWorkStealingQueue&) = delete;      // Copy Assignment Not Implemented
+};
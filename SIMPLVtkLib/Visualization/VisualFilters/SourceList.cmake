@@ -5,6 +5,7 @@ set(VSVisualFilterValues
 		VSDataSetValues
 		VSFileNameValues
 		VSMaskValues
+		VSOrthoSliceValues
 		VSPipelineValues
 		VSSIMPLDataContainerValues
 		VSSliceValues
@@ -16,11 +17,18 @@ set(VSVisualFilters
   VSAbstractDataFilter
   VSAbstractFilter
   VSClipFilter
+  VSCompoundThreshold
   VSCropFilter
   VSDataSetFilter
   VSFileNameFilter
+  VSHistogram
+  VSImageBlankingThreshold
+  VSImageOrthoSlicer
+  VSImageSliceExtractor
   VSMaskFilter
+  VSOrthoSliceFilter
   VSPipelineFilter
+  VSPreviewProxy
   VSRootFilter
   VSSIMPLDataContainerFilter
   VSSliceFilter
@@ -34,6 +42,7 @@ set(VSVisualFilter_UIS
   VSCropFilterWidget
   VSDataSetFilterWidget
   VSMaskFilterWidget
+  VSOrthoSliceFilterWidget
   VSSIMPLDataContainerFilterWidget
   VSSliceFilterWidget
   VSThresholdFilterWidget
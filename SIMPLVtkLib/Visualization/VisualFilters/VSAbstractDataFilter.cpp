@@ -68,6 +68,7 @@ VSAbstractFilter::dataType_t VSAbstractDataFilter::getOutputType() const
   switch(dataType)
   {
   case VTK_IMAGE_DATA:
+  case VTK_UNIFORM_GRID:
     return dataType_t::IMAGE_DATA;
   case VTK_STRUCTURED_GRID:
     return dataType_t::STRUCTURED_GRID;
@@ -35,23 +35,243 @@
 
 #include "VSAbstractFilter.h"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <QtConcurrent>
+
 #include <QtCore/QCoreApplication>
+#include <QtCore/QFutureInterface>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QString>
 #include <QtCore/QThread>
 
 #include <vtkAlgorithm.h>
+#include <vtkCallbackCommand.h>
 #include <vtkCellData.h>
+#include <vtkCommand.h>
 #include <vtkGenericDataObjectWriter.h>
+#include <vtkInformation.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkCellArray.h>
 #include <vtkPointData.h>
 #include <vtkPointSet.h>
+#include <vtkPolyData.h>
+#include <vtkRectilinearGrid.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkVersion.h>
 
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSVertexGeom.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSOutputMemoryPolicy.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VtkWidgets/VSAbstractWidget.h"
 
+namespace
+{
+// Histograms of arrays that are no longer shown are dropped past this count
+const int MaxCachedHistograms = 32;
+
+/**
+ * @brief Forwards vtkAlgorithm progress events from the worker thread to the
+ * owning filter's applyProgress signal on the filter's thread.
+ */
+void ApplyProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  Q_UNUSED(caller)
+  Q_UNUSED(eventId)
+
+  // Canceled applies keep running until the algorithm checks its abort flag
+  vtkAlgorithm* algorithm = vtkAlgorithm::SafeDownCast(caller);
+  if(algorithm && algorithm->GetAbortExecute())
+  {
+    return;
+  }
+
+  VSAbstractFilter* filter = static_cast<VSAbstractFilter*>(clientData);
+  double progress = *static_cast<double*>(callData);
+  QMetaObject::invokeMethod(filter, "applyProgress", Qt::QueuedConnection, Q_ARG(double, progress));
+}
+
+/**
+ * @brief Adds the memory buffer of the given array to the set.  Arrays that expose
+ * their memory are identified by it so that separate wrappers of the same SIMPLib
+ * array are only counted once.
+ */
+void CollectBuffer(vtkAbstractArray* array, std::map<const void*, vtkAbstractArray*>& buffers)
+{
+  if(nullptr == array)
+  {
+    return;
+  }
+
+  const void* buffer = array->HasStandardMemoryLayout() ? array->GetVoidPointer(0) : nullptr;
+  buffers[buffer ? buffer : array] = array;
+}
+
+/**
+ * @brief Adds the buffers used by the given cell array to the set
+ */
+void CollectBuffers(vtkCellArray* cells, std::map<const void*, vtkAbstractArray*>& buffers)
+{
+  if(nullptr == cells)
+  {
+    return;
+  }
+
+#if VTK_MAJOR_VERSION >= 9
+  CollectBuffer(cells->GetOffsetsArray(), buffers);
+  CollectBuffer(cells->GetConnectivityArray(), buffers);
+#else
+  CollectBuffer(cells->GetData(), buffers);
+#endif
+}
+
+/**
+ * @brief Adds the buffers of every array, point list and cell list referenced by
+ * the given data object to the set
+ */
+void CollectBuffers(vtkDataObject* dataObject, std::map<const void*, vtkAbstractArray*>& buffers)
+{
+  if(nullptr == dataObject)
+  {
+    return;
+  }
+
+  std::vector<vtkFieldData*> fieldDatas = {dataObject->GetFieldData()};
+  if(vtkDataSet* dataSet = vtkDataSet::SafeDownCast(dataObject))
+  {
+    fieldDatas.push_back(dataSet->GetPointData());
+    fieldDatas.push_back(dataSet->GetCellData());
+  }
+  for(vtkFieldData* fieldData : fieldDatas)
+  {
+    int numArrays = fieldData ? fieldData->GetNumberOfArrays() : 0;
+    for(int i = 0; i < numArrays; i++)
+    {
+      CollectBuffer(fieldData->GetAbstractArray(i), buffers);
+    }
+  }
+
+  if(vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataObject))
+  {
+    CollectBuffer(pointSet->GetPoints() ? pointSet->GetPoints()->GetData() : nullptr, buffers);
+  }
+  if(vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(dataObject))
+  {
+    CollectBuffers(grid->GetCells(), buffers);
+    CollectBuffer(grid->GetCellTypesArray(), buffers);
+#if VTK_MAJOR_VERSION < 9
+    CollectBuffer(grid->GetCellLocationsArray(), buffers);
+#endif
+  }
+  else if(vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataObject))
+  {
+    CollectBuffers(polyData->GetVerts(), buffers);
+    CollectBuffers(polyData->GetLines(), buffers);
+    CollectBuffers(polyData->GetPolys(), buffers);
+    CollectBuffers(polyData->GetStrips(), buffers);
+  }
+  else if(vtkRectilinearGrid* rectGrid = vtkRectilinearGrid::SafeDownCast(dataObject))
+  {
+    CollectBuffer(rectGrid->GetXCoordinates(), buffers);
+    CollectBuffer(rectGrid->GetYCoordinates(), buffers);
+    CollectBuffer(rectGrid->GetZCoordinates(), buffers);
+  }
+}
+
+/**
+ * @brief Adds empty arrays with the names, types and component counts of the source
+ * arrays to the target so that a released output still describes the data it held
+ */
+void CopyArrayLayout(vtkDataSetAttributes* source, vtkDataSetAttributes* target)
+{
+  int numArrays = source->GetNumberOfArrays();
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkAbstractArray* array = source->GetAbstractArray(i);
+    if(nullptr == array)
+    {
+      continue;
+    }
+
+    VTK_PTR(vtkAbstractArray) emptyArray;
+    emptyArray.TakeReference(array->NewInstance());
+    emptyArray->SetName(array->GetName());
+    emptyArray->SetNumberOfComponents(array->GetNumberOfComponents());
+    target->AddArray(emptyArray);
+  }
+
+  if(source->GetScalars() && source->GetScalars()->GetName())
+  {
+    target->SetActiveScalars(source->GetScalars()->GetName());
+  }
+}
+
+/**
+ * @brief Computes the range of each component and the magnitude of the given array
+ * so later GetRange calls only read the cached values.
+ */
+void PrepareRangeCache(vtkDataArray* array)
+{
+  if(nullptr == array)
+  {
+    return;
+  }
+
+  double range[2];
+  int numComponents = array->GetNumberOfComponents();
+  for(int i = 0; i < numComponents; i++)
+  {
+    array->GetRange(range, i);
+  }
+  if(numComponents > 1)
+  {
+    array->GetRange(range, -1);
+  }
+}
+
+/**
+ * @brief Fills the bounds and range caches that an algorithm reads from its input.
+ * These caches are computed lazily by whichever thread asks first, and the snapshot
+ * handed to the worker thread shares its points and arrays with the rendered output.
+ */
+void PrepareSharedCaches(vtkDataObject* dataObject, vtkAlgorithm* algorithm)
+{
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(dataObject);
+  if(nullptr == dataSet)
+  {
+    return;
+  }
+
+  double bounds[6];
+  dataSet->GetBounds(bounds);
+
+  PrepareRangeCache(dataSet->GetPointData()->GetScalars());
+  PrepareRangeCache(dataSet->GetCellData()->GetScalars());
+
+  vtkInformation* arrayInfo = algorithm->GetInputArrayInformation(0);
+  if(arrayInfo && arrayInfo->Has(vtkDataObject::FIELD_NAME()))
+  {
+    const char* arrayName = arrayInfo->Get(vtkDataObject::FIELD_NAME());
+    if(vtkDataObject::FIELD_ASSOCIATION_CELLS == arrayInfo->Get(vtkDataObject::FIELD_ASSOCIATION()))
+    {
+      PrepareRangeCache(dataSet->GetCellData()->GetArray(arrayName));
+    }
+    else
+    {
+      PrepareRangeCache(dataSet->GetPointData()->GetArray(arrayName));
+    }
+  }
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -61,6 +281,7 @@ VSAbstractFilter::VSAbstractFilter()
 , m_Transform(new VSTransform())
 , m_ChildLock(1)
 , m_InputPort(nullptr)
+, m_ApplyWatcher(this)
 {
   setCheckable(true);
   setChecked(true);
@@ -71,6 +292,27 @@ VSAbstractFilter::VSAbstractFilter()
   m_Transform->moveToThread(thread);
 
   connect(this, SIGNAL(updatedOutputPort(VSAbstractFilter*)), this, SLOT(connectAdditionalOutputFilters(VSAbstractFilter*)));
+  connect(m_Transform.get(), SIGNAL(valuesChanged()), this, SLOT(updateTransformFilter()));
+  connect(&m_ApplyWatcher, SIGNAL(finished()), this, SLOT(applyFinished()));
+  connect(&m_PreviewProxyWatcher, &QFutureWatcher<void>::finished, this, [this] {
+    VTK_PTR(vtkAlgorithm) algorithm = m_PendingPreviewAlgorithm;
+    m_PendingPreviewAlgorithm = nullptr;
+    executePreview(algorithm);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::~VSAbstractFilter()
+{
+  // Worker threads report progress back to this object
+  abortApply();
+  for(const CanceledApply& canceledApply : m_CanceledApplies)
+  {
+    canceledApply.m_Watcher->waitForFinished();
+  }
+  VSOutputMemoryPolicy::Instance()->removeFilter(this);
 }
 
 // -----------------------------------------------------------------------------
@@ -240,6 +482,8 @@ void VSAbstractFilter::addChild(VSAbstractFilter* child)
     model->endInsertingFilter(child);
   }
   m_ChildLock.release();
+
+  childrenChanged();
 }
 
 // -----------------------------------------------------------------------------
@@ -259,6 +503,30 @@ void VSAbstractFilter::removeChild(VSAbstractFilter* child)
     model->endRemovingFilter(child);
   }
   m_ChildLock.release();
+
+  childrenChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::childrenChanged()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::outputReferencesInput(vtkAlgorithm* algorithm) const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::storeAdditionalOutputs(vtkAlgorithm* algorithm)
+{
 }
 
 // -----------------------------------------------------------------------------
@@ -374,6 +642,36 @@ bool VSAbstractFilter::isPointData() const
     return true;
   }
 
+  // Vertex geometries wrapped with native cell arrays only contain vertex cells.
+  // Scanning the cell types is linear, so the result is kept until the output changes.
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(dataSet);
+  if(nullptr == grid)
+  {
+    return false;
+  }
+  if(m_VertexGridCache.m_DataSet != grid || m_VertexGridCache.m_MTime != grid->GetMTime())
+  {
+    m_VertexGridCache.m_DataSet = grid;
+    m_VertexGridCache.m_MTime = grid->GetMTime();
+    m_VertexGridCache.m_IsVertexGrid = grid->GetNumberOfCells() > 0 && grid->GetCellType(0) == VTK_VERTEX && grid->IsHomogeneous();
+  }
+
+  return m_VertexGridCache.m_IsVertexGrid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::hasBlankedOutput() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::acceptsBlankedInput() const
+{
   return false;
 }
 
@@ -480,7 +778,7 @@ VTK_PTR(vtkDataArray) VSAbstractFilter::getDataArray(QString arrayName) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSAbstractFilter::getArrayValueRange(QString arrayName) const
+VSArrayStatisticsCache::StatisticsPtr VSAbstractFilter::getArrayStatistics(QString arrayName) const
 {
   if(nullptr == getDataSetFilter())
   {
@@ -488,13 +786,160 @@ double* VSAbstractFilter::getArrayValueRange(QString arrayName) const
   }
 
   VTK_PTR(vtkDataArray) dataArray = getDataSetFilter()->getDataArray(arrayName);
-  if(dataArray)
+  return VSArrayStatisticsCache::Instance()->getStatistics(dataArray);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::getArrayValueRange(QString arrayName, double range[2]) const
+{
+  VSArrayStatisticsCache::StatisticsPtr statistics = getArrayStatistics(arrayName);
+  if(nullptr == statistics)
   {
-    qDebug() << dataArray->GetName() << ": " << dataArray->GetRange()[0] << ", " << dataArray->GetRange()[1];
-    return dataArray->GetRange();
+    return false;
   }
 
-  return nullptr;
+  statistics->getRange(0, range);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram VSAbstractFilter::getArrayHistogram(QString arrayName, int component, int numBins, VSHistogram::BinningMode mode) const
+{
+  // A released output only holds the array layout.  Releasing does not change the
+  // values, so histograms computed before the release are still valid.
+  QString key = QString("%1/%2/%3/%4").arg(arrayName).arg(component).arg(numBins).arg(static_cast<int>(mode));
+  if(isOutputReleased())
+  {
+    return FindCachedHistogram(m_HistogramCache, key);
+  }
+
+  VTK_PTR(vtkDataArray) dataArray = getDataArray(arrayName);
+  return ComputeArrayHistogram(m_HistogramCache, key, arrayName, dataArray, getHistogramGhostArray(dataArray), component, numBins, mode);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QFuture<VSHistogram> VSAbstractFilter::getArrayHistogramAsync(QString arrayName, int component, int numBins, VSHistogram::BinningMode mode) const
+{
+  QString key = QString("%1/%2/%3/%4").arg(arrayName).arg(component).arg(numBins).arg(static_cast<int>(mode));
+  VTK_PTR(vtkDataArray) dataArray = isOutputReleased() ? nullptr : getDataArray(arrayName);
+  if(nullptr == dataArray)
+  {
+    QFutureInterface<VSHistogram> cachedResult;
+    cachedResult.reportStarted();
+    cachedResult.reportResult(FindCachedHistogram(m_HistogramCache, key));
+    cachedResult.reportFinished();
+    return cachedResult.future();
+  }
+
+  // The worker holds the arrays and the cache so that neither depends on this filter
+  std::shared_ptr<HistogramCache> cache = m_HistogramCache;
+  VTK_PTR(vtkDataArray) ghostArray = getHistogramGhostArray(dataArray);
+  return QtConcurrent::run([=] { return ComputeArrayHistogram(cache, key, arrayName, dataArray, ghostArray, component, numBins, mode); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataArray) VSAbstractFilter::getHistogramGhostArray(vtkDataArray* dataArray) const
+{
+  // Blanked outputs keep the hidden values in their arrays, so those have to be
+  // skipped when counting instead of using the statistics of the whole array.
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(getOutput());
+  if(nullptr == dataArray || nullptr == dataSet || false == hasBlankedOutput() || isPointData())
+  {
+    return nullptr;
+  }
+
+  vtkUnsignedCharArray* ghostArray = vtkUnsignedCharArray::SafeDownCast(dataSet->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  if(nullptr == ghostArray || ghostArray->GetNumberOfTuples() != dataArray->GetNumberOfTuples())
+  {
+    return nullptr;
+  }
+
+  return ghostArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram VSAbstractFilter::FindCachedHistogram(const std::shared_ptr<HistogramCache>& cache, const QString& key)
+{
+  QMutexLocker lock(&cache->m_Mutex);
+  auto iter = cache->m_Entries.find(key);
+  return (iter != cache->m_Entries.end()) ? iter->m_Histogram : VSHistogram();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram VSAbstractFilter::ComputeArrayHistogram(const std::shared_ptr<HistogramCache>& cache, const QString& key, const QString& arrayName, VTK_PTR(vtkDataArray) dataArray,
+                                                    VTK_PTR(vtkDataArray) ghostArray, int component, int numBins, VSHistogram::BinningMode mode)
+{
+  VSArrayStatisticsCache::StatisticsPtr statistics = VSArrayStatisticsCache::Instance()->getStatistics(dataArray);
+  if(nullptr == statistics)
+  {
+    return VSHistogram();
+  }
+  vtkMTimeType ghostMTime = ghostArray ? ghostArray->GetMTime() : 0;
+
+  // The statistics cache hands out new statistics only when the array changes, so a
+  // re-executed parent invalidates just the histograms of arrays it actually modified.
+  {
+    QMutexLocker lock(&cache->m_Mutex);
+    auto iter = cache->m_Entries.find(key);
+    if(iter != cache->m_Entries.end() && iter->m_Statistics == statistics && iter->m_GhostArray == ghostArray.GetPointer() && iter->m_GhostMTime == ghostMTime)
+    {
+      iter->m_LastUse = ++cache->m_UseCount;
+      return iter->m_Histogram;
+    }
+  }
+
+  HistogramCacheEntry entry;
+  entry.m_ArrayName = arrayName;
+  entry.m_Statistics = statistics;
+  entry.m_GhostArray = ghostArray;
+  entry.m_GhostMTime = ghostMTime;
+  if(ghostArray)
+  {
+    entry.m_Histogram = VSHistogram(dataArray, static_cast<const unsigned char*>(ghostArray->GetVoidPointer(0)), *statistics, component, numBins, mode);
+  }
+  else
+  {
+    entry.m_Histogram = VSHistogram(*statistics, component, numBins, mode);
+  }
+
+  QMutexLocker lock(&cache->m_Mutex);
+  entry.m_LastUse = ++cache->m_UseCount;
+
+  // Histograms of an earlier version of the array can no longer be requested
+  for(auto iter = cache->m_Entries.begin(); iter != cache->m_Entries.end();)
+  {
+    if(iter->m_ArrayName == arrayName && iter->m_Statistics != statistics)
+    {
+      iter = cache->m_Entries.erase(iter);
+    }
+    else
+    {
+      iter++;
+    }
+  }
+
+  // Histograms of removed arrays are dropped once the cache is full
+  while(cache->m_Entries.size() >= MaxCachedHistograms)
+  {
+    auto oldest = std::min_element(cache->m_Entries.begin(), cache->m_Entries.end(),
+                                   [](const HistogramCacheEntry& lhs, const HistogramCacheEntry& rhs) { return lhs.m_LastUse < rhs.m_LastUse; });
+    cache->m_Entries.erase(oldest);
+  }
+
+  cache->m_Entries.insert(key, entry);
+  return entry.m_Histogram;
 }
 
 // -----------------------------------------------------------------------------
@@ -502,8 +947,8 @@ double* VSAbstractFilter::getArrayValueRange(QString arrayName) const
 // -----------------------------------------------------------------------------
 double VSAbstractFilter::getArrayMinValue(QString arrayName) const
 {
-  double* range = getArrayValueRange(arrayName);
-  if(range != nullptr)
+  double range[2];
+  if(getArrayValueRange(arrayName, range))
   {
     return range[0];
   }
@@ -516,8 +961,8 @@ double VSAbstractFilter::getArrayMinValue(QString arrayName) const
 // -----------------------------------------------------------------------------
 double VSAbstractFilter::getArrayMaxValue(QString arrayName) const
 {
-  double* range = getArrayValueRange(arrayName);
-  if(range != nullptr)
+  double range[2];
+  if(getArrayValueRange(arrayName, range))
   {
     return range[1];
   }
@@ -585,8 +1030,8 @@ QStringList VSAbstractFilter::getComponentList(vtkAbstractArray* array)
 
   if(array)
   {
-    bool isCharArray = array->IsA("vtkUnsignedCharArray");
-    bool isFloatArray = array->IsA("vtkFloatArray");
+    bool isCharArray = array->GetDataType() == VTK_UNSIGNED_CHAR;
+    bool isFloatArray = array->GetDataType() == VTK_FLOAT;
     int numComponent = array->GetNumberOfComponents();
     if(isCharArray && numComponent == 3)
     {
@@ -659,6 +1104,7 @@ VSAbstractFilter::dataType_t VSAbstractFilter::getOutputType() const
   switch(dataType)
   {
   case VTK_IMAGE_DATA:
+  case VTK_UNIFORM_GRID:
     return dataType_t::IMAGE_DATA;
   case VTK_STRUCTURED_GRID:
     return dataType_t::STRUCTURED_GRID;
@@ -750,10 +1196,17 @@ void VSAbstractFilter::connectToOutput(VSAbstractFilter* filter)
     return;
   }
 
-  setInputPort(filter->getTransformedOutputPort());
+  setInputPort(filter->getOutputPort());
 
   if(getConnectedInput())
   {
+    // Previews are replaced by the full resolution output once the interaction ends.
+    // Re-applying against each of them would cancel and restart the full apply.
+    if(false == filter->isOutputCommitted())
+    {
+      return;
+    }
+
     // Connect algorithm input and filter output
     updateAlgorithmInput(filter);
   }
@@ -789,12 +1242,7 @@ VSTransform* VSAbstractFilter::getTransform()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSAbstractFilter::getTransformedOutputPort()
 {
-  if(nullptr == m_TransformFilter)
-  {
-    createTransformFilter();
-  }
-
-  return m_TransformFilter->GetOutputPort();
+  return getTransformFilter()->GetOutputPort();
 }
 
 // -----------------------------------------------------------------------------
@@ -802,12 +1250,9 @@ vtkAlgorithmOutput* VSAbstractFilter::getTransformedOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSAbstractFilter::getTransformedOutput()
 {
-  if(nullptr == m_TransformFilter)
-  {
-    createTransformFilter();
-  }
-
-  return m_TransformFilter->GetOutput();
+  VTK_PTR(vtkTransformFilter) transformFilter = getTransformFilter();
+  transformFilter->Update();
+  return transformFilter->GetOutput();
 }
 
 // -----------------------------------------------------------------------------
@@ -820,7 +1265,6 @@ void VSAbstractFilter::createTransformFilter()
   if(m_Transform)
   {
     m_TransformFilter->SetTransform(m_Transform->getGlobalTransform());
-    connect(m_Transform.get(), SIGNAL(valuesChanged()), this, SLOT(updateTransformFilter()));
   }
   else
   {
@@ -828,11 +1272,8 @@ void VSAbstractFilter::createTransformFilter()
     m_TransformFilter->SetTransform(transform);
   }
 
+  // The transformed copy is only executed when a consumer requests it
   m_TransformFilter->SetInputConnection(getOutputPort());
-  if(getOutputPort())
-  {
-    m_TransformFilter->Update();
-  }
 }
 
 // -----------------------------------------------------------------------------
@@ -853,16 +1294,12 @@ VTK_PTR(vtkTransformFilter) VSAbstractFilter::getTransformFilter()
 // -----------------------------------------------------------------------------
 void VSAbstractFilter::updateTransformFilter()
 {
-  if(nullptr == m_TransformFilter)
-  {
-    createTransformFilter();
-  }
-
-  if(getTransform())
+  if(m_TransformFilter && getTransform())
   {
     m_TransformFilter->SetTransform(getTransform()->getGlobalTransform());
-    emit transformChanged();
   }
+
+  emit transformChanged();
 }
 
 // -----------------------------------------------------------------------------
@@ -870,17 +1307,42 @@ void VSAbstractFilter::updateTransformFilter()
 // -----------------------------------------------------------------------------
 double* VSAbstractFilter::getTransformBounds()
 {
-  if(nullptr == m_TransformFilter)
+  double* bounds = getBounds();
+  if(nullptr == bounds || nullptr == getTransform())
+  {
+    return bounds;
+  }
+
+  // Empty datasets report uninitialized bounds that must not be transformed into real corners
+  if(false == vtkMath::AreBoundsInitialized(bounds))
+  {
+    return bounds;
+  }
+
+  // Transform the corners of the local bounding box instead of the geometry
+  vtkMatrix4x4* matrix = getTransform()->getGlobalMatrix();
+  const double localBounds[6] = {bounds[0], bounds[1], bounds[2], bounds[3], bounds[4], bounds[5]};
+  vtkMath::UninitializeBounds(m_TransformBounds);
+  for(int i = 0; i < 8; i++)
   {
-    return getBounds();
+    double corner[4] = {localBounds[i & 1], localBounds[2 + ((i >> 1) & 1)], localBounds[4 + ((i >> 2) & 1)], 1.0};
+    matrix->MultiplyPoint(corner, corner);
+    for(int j = 0; j < 3; j++)
+    {
+      if(0 == i)
+      {
+        m_TransformBounds[2 * j] = corner[j];
+        m_TransformBounds[2 * j + 1] = corner[j];
+      }
+      else
+      {
+        m_TransformBounds[2 * j] = std::min(m_TransformBounds[2 * j], corner[j]);
+        m_TransformBounds[2 * j + 1] = std::max(m_TransformBounds[2 * j + 1], corner[j]);
+      }
+    }
   }
 
-  VTK_PTR(vtkTransformFilter) trans = VTK_PTR(vtkTransformFilter)::New();
-  trans->SetInputConnection(getOutputPort());
-  trans->SetTransform(getTransform()->getGlobalTransform());
-  trans->ReleaseDataFlagOn();
-  trans->Update();
-  return trans->GetOutput()->GetBounds();
+  return m_TransformBounds;
 }
 
 // -----------------------------------------------------------------------------
@@ -897,9 +1359,9 @@ void VSAbstractFilter::writeJson(QJsonObject& json)
   QJsonArray localScaleArray;
 
   VSTransform* transform = getTransform();
-  double* localPos = transform->getLocalPosition();
-  double* localRot = transform->getLocalRotation();
-  double* localScale = transform->getLocalScale();
+  std::array<double, 3> localPos = transform->getLocalPosition();
+  std::array<double, 3> localRot = transform->getLocalRotation();
+  std::array<double, 3> localScale = transform->getLocalScale();
 
   for(int i = 0; i < 3; i++)
   {
@@ -908,10 +1370,6 @@ void VSAbstractFilter::writeJson(QJsonObject& json)
     localScaleArray.push_back(localScale[i]);
   }
 
-  delete[] localPos;
-  delete[] localRot;
-  delete[] localScale;
-
   transformObject["LocalPosition"] = localPositionArray;
   transformObject["LocalRotation"] = localRotationArray;
   transformObject["LocalScale"] = localScaleArray;
@@ -1167,3 +1625,537 @@ bool VSAbstractFilter::HasPointData(VSAbstractFilter::FilterListType filters)
 
   return false;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::executeAlgorithm(VTK_PTR(vtkAlgorithm) algorithm)
+{
+  if(nullptr == algorithm)
+  {
+    return;
+  }
+
+  abortApply();
+  m_QueuedApplyAlgorithm = nullptr;
+  m_PendingPreviewAlgorithm = nullptr;
+
+  // The algorithm is rerun once its canceled update returns from the worker thread
+  if(isAlgorithmBusy(algorithm))
+  {
+    m_QueuedApplyAlgorithm = algorithm;
+    return;
+  }
+
+  // Hand the worker a shallow copy so that rendering can keep reading the parent pipeline
+  vtkDataObject* parentOutput = updateParentOutput();
+  if(nullptr == parentOutput)
+  {
+    return;
+  }
+  PrepareSharedCaches(parentOutput, algorithm);
+
+  VTK_PTR(vtkDataObject) inputSnapshot;
+  inputSnapshot.TakeReference(parentOutput->NewInstance());
+  inputSnapshot->ShallowCopy(parentOutput);
+  algorithm->SetInputDataObject(inputSnapshot);
+  algorithm->SetAbortExecute(0);
+  algorithm->SetReleaseDataFlag(VSOutputMemoryPolicy::Instance()->isEnabled());
+  algorithm->Modified();
+
+  VTK_NEW(vtkCallbackCommand, progressCallback);
+  progressCallback->SetCallback(ApplyProgressCallback);
+  progressCallback->SetClientData(this);
+  m_ApplyProgressTag = algorithm->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+  m_ApplyAlgorithm = algorithm;
+
+  // Show an empty output of the expected type until the first apply finishes
+  // instead of passing the parent's output through and drawing it twice.
+  if(nullptr == m_ApplyOutputProducer)
+  {
+    algorithm->UpdateDataObject();
+    vtkDataObject* algorithmOutput = algorithm->GetOutputDataObject(0);
+    if(algorithmOutput)
+    {
+      VTK_PTR(vtkDataObject) emptyOutput;
+      emptyOutput.TakeReference(algorithmOutput->NewInstance());
+      m_ApplyOutputProducer = VTK_PTR(vtkTrivialProducer)::New();
+      m_ApplyOutputProducer->SetOutput(emptyOutput);
+      m_OutputCommitted = false;
+      emit updatedOutputPort(this);
+    }
+  }
+
+  emit applyStarted();
+
+  QString filterName = getFilterName();
+  m_ApplyWatcher.setFuture(QtConcurrent::run([algorithm, filterName] {
+    Q_UNUSED(filterName)
+    VS_TRACE_NAMED_SCOPE(applyScope, "Filter", "VSAbstractFilter::executeAlgorithm");
+    VS_TRACE_DETAIL(applyScope, filterName);
+    algorithm->Update();
+  }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::executePreview(VTK_PTR(vtkAlgorithm) algorithm)
+{
+  if(nullptr == algorithm)
+  {
+    return;
+  }
+
+  abortApply();
+  m_QueuedApplyAlgorithm = nullptr;
+
+  // Subclasses create new algorithms while a canceled apply still uses the old ones
+  if(isAlgorithmBusy(algorithm))
+  {
+    return;
+  }
+
+  VTK_PTR(vtkDataObject) proxy = m_PreviewProxy.getProxy(updateParentOutput());
+  if(nullptr == proxy)
+  {
+    // Preview the latest request once the proxy has been built off this thread
+    QFuture<void> build = m_PreviewProxy.getBuildFuture();
+    if(false == build.isFinished())
+    {
+      m_PendingPreviewAlgorithm = algorithm;
+      m_PreviewProxyWatcher.setFuture(build);
+    }
+    return;
+  }
+
+  VS_TRACE_NAMED_SCOPE(previewScope, "Filter", "VSAbstractFilter::executePreview");
+  VS_TRACE_DETAIL(previewScope, getFilterName());
+
+  // The proxy is small enough to update on this thread at interactive rates
+  algorithm->SetInputDataObject(proxy);
+  algorithm->SetReleaseDataFlag(VSOutputMemoryPolicy::Instance()->isEnabled());
+  algorithm->Update();
+
+  // Children keep their current output until the preview is committed by a full apply
+  if(storeAppliedOutput(algorithm))
+  {
+    m_OutputCommitted = false;
+    emit updatedOutputPort(this);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataObject* VSAbstractFilter::updateParentOutput()
+{
+  VSAbstractFilter* parentFilter = getParentFilter();
+  if(nullptr == parentFilter)
+  {
+    return nullptr;
+  }
+
+  vtkAlgorithmOutput* parentPort = parentFilter->getOutputPort();
+  if(nullptr == parentPort || nullptr == parentPort->GetProducer())
+  {
+    return nullptr;
+  }
+
+  // Outputs are generated by background applies and held by vtkTrivialProducers, so
+  // nothing is executed on this thread.  An output that is still being applied or
+  // restored is not used; the parent's updatedOutputPort reapplies this filter.
+  VSAbstractFilter* outputSource = parentFilter->getOutputSource();
+  if(outputSource && outputSource->isApplying())
+  {
+    return nullptr;
+  }
+
+  return parentPort->GetProducer()->GetOutputDataObject(parentPort->GetIndex());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::setAppliedOutput(vtkAlgorithm* algorithm)
+{
+  if(false == storeAppliedOutput(algorithm))
+  {
+    return;
+  }
+
+  emit updatedOutputPort(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::storeAppliedOutput(vtkAlgorithm* algorithm)
+{
+  vtkDataObject* algorithmOutput = algorithm->GetOutputDataObject(0);
+  if(nullptr == algorithmOutput)
+  {
+    return false;
+  }
+
+  // Copy the result so the next update cannot modify data that is being rendered
+  VTK_PTR(vtkDataObject) output;
+  output.TakeReference(algorithmOutput->NewInstance());
+  output->ShallowCopy(algorithmOutput);
+
+  if(nullptr == m_ApplyOutputProducer)
+  {
+    m_ApplyOutputProducer = VTK_PTR(vtkTrivialProducer)::New();
+  }
+  m_ApplyOutputProducer->SetOutput(output);
+  m_OutputAlgorithm = algorithm;
+  m_OutputReleased = false;
+  m_OutputCommitted = true;
+
+  // The parent reuses its output object when it updates, so hold a copy that keeps
+  // the arrays referenced by this output.
+  m_ReferencedInput = nullptr;
+  vtkDataObject* algorithmInput = algorithm->GetNumberOfInputPorts() > 0 ? algorithm->GetInputDataObject(0, 0) : nullptr;
+  if(algorithmInput && outputReferencesInput(algorithm))
+  {
+    m_ReferencedInput.TakeReference(algorithmInput->NewInstance());
+    m_ReferencedInput->ShallowCopy(algorithmInput);
+  }
+  storeAdditionalOutputs(algorithm);
+
+  // The copy has no pipeline consumer to honor the ReleaseDataFlag.  Drop the
+  // algorithm's references so that releasing the copy frees the data.
+  if(algorithm->GetReleaseDataFlag())
+  {
+    if(algorithm->GetNumberOfInputPorts() > 0)
+    {
+      algorithm->SetInputDataObject(nullptr);
+    }
+    algorithmOutput->ReleaseData();
+  }
+
+  VSOutputMemoryPolicy::Instance()->outputUsed(this);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::restoreOutput()
+{
+  if(false == m_OutputReleased || isApplying() || nullptr == m_OutputAlgorithm)
+  {
+    return;
+  }
+
+  // The algorithm still holds the settings of the last apply.  The released output
+  // and its array layout stay in place until the background apply finishes.
+  executeAlgorithm(m_OutputAlgorithm);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSAbstractFilter::getOutputSource()
+{
+  if((getConnectedInput() && hasAppliedOutput()) || nullptr == getParentFilter())
+  {
+    return this;
+  }
+
+  return getParentFilter()->getOutputSource();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::canReleaseOutput() const
+{
+  return m_ApplyOutputProducer && m_OutputAlgorithm && m_OutputCommitted && false == m_OutputReleased && false == isApplying() && getParentFilter();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isOutputReleased() const
+{
+  return m_OutputReleased;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isOutputCommitted() const
+{
+  return m_OutputCommitted;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::releaseOutput()
+{
+  if(false == canReleaseOutput())
+  {
+    return;
+  }
+
+  VS_TRACE_NAMED_SCOPE(releaseScope, "Filter", "VSAbstractFilter::releaseOutput");
+  VS_TRACE_BYTES(releaseScope, static_cast<qint64>(getOutputMemorySize()));
+
+  // Keep an empty output of the same type so that the port stays valid.  The array
+  // layout is kept as well so that const getters never need to regenerate the data.
+  vtkDataObject* output = m_ApplyOutputProducer->GetOutputDataObject(0);
+  VTK_PTR(vtkDataObject) releasedOutput;
+  releasedOutput.TakeReference(output->NewInstance());
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(output);
+  vtkDataSet* releasedDataSet = vtkDataSet::SafeDownCast(releasedOutput);
+  if(dataSet && releasedDataSet)
+  {
+    CopyArrayLayout(dataSet->GetPointData(), releasedDataSet->GetPointData());
+    CopyArrayLayout(dataSet->GetCellData(), releasedDataSet->GetCellData());
+  }
+  m_ApplyOutputProducer->SetOutput(releasedOutput);
+  m_ReferencedInput = nullptr;
+
+  if(m_TransformFilter && m_TransformFilter->GetOutputDataObject(0))
+  {
+    m_TransformFilter->GetOutputDataObject(0)->ReleaseData();
+  }
+
+  m_OutputReleased = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSAbstractFilter::getOutputMemorySize() const
+{
+  if(nullptr == m_ApplyOutputProducer || m_OutputReleased)
+  {
+    return 0;
+  }
+
+  vtkDataObject* output = m_ApplyOutputProducer->GetOutputDataObject(0);
+  if(nullptr == output)
+  {
+    return 0;
+  }
+
+  // Filters such as image blanking share most arrays with their parent's output, and
+  // releasing this output does not free those.  Each buffer is only counted once.
+  std::map<const void*, vtkAbstractArray*> buffers;
+  CollectBuffers(output, buffers);
+
+  std::map<const void*, vtkAbstractArray*> parentBuffers;
+  if(getParentFilter())
+  {
+    CollectBuffers(getParentFilter()->getOutput(), parentBuffers);
+  }
+
+  size_t memorySize = 0;
+  for(const auto& buffer : buffers)
+  {
+    if(parentBuffers.find(buffer.first) == parentBuffers.end())
+    {
+      memorySize += static_cast<size_t>(buffer.second->GetActualMemorySize()) * 1024;
+    }
+  }
+
+  return memorySize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::abortApply()
+{
+  if(nullptr == m_ApplyAlgorithm)
+  {
+    return;
+  }
+
+  VTK_PTR(vtkAlgorithm) algorithm = m_ApplyAlgorithm;
+  m_ApplyAlgorithm = nullptr;
+  algorithm->SetAbortExecute(1);
+
+  if(m_ApplyWatcher.isFinished())
+  {
+    finishCanceledApply(algorithm, m_ApplyProgressTag);
+    return;
+  }
+
+  // Let the worker return in the background instead of blocking this thread until
+  // the algorithm notices the abort flag.  The algorithm is not reused until then.
+  CanceledApply canceledApply;
+  canceledApply.m_Algorithm = algorithm;
+  canceledApply.m_ProgressTag = m_ApplyProgressTag;
+  canceledApply.m_Watcher = new QFutureWatcher<void>(this);
+  m_CanceledApplies.push_back(canceledApply);
+
+  QFutureWatcher<void>* watcher = canceledApply.m_Watcher;
+  connect(watcher, &QFutureWatcher<void>::finished, this, [this, watcher] {
+    auto iter = std::find_if(m_CanceledApplies.begin(), m_CanceledApplies.end(), [watcher](const CanceledApply& entry) { return entry.m_Watcher == watcher; });
+    if(iter == m_CanceledApplies.end())
+    {
+      return;
+    }
+
+    VTK_PTR(vtkAlgorithm) algorithm = iter->m_Algorithm;
+    unsigned long progressTag = iter->m_ProgressTag;
+    m_CanceledApplies.erase(iter);
+    watcher->deleteLater();
+    finishCanceledApply(algorithm, progressTag);
+  });
+  watcher->setFuture(m_ApplyWatcher.future());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::finishCanceledApply(VTK_PTR(vtkAlgorithm) algorithm, unsigned long progressTag)
+{
+  // The aborted output is incomplete and must not be reused on the next update
+  algorithm->RemoveObserver(progressTag);
+  algorithm->SetAbortExecute(0);
+  algorithm->Modified();
+
+  if(m_QueuedApplyAlgorithm == algorithm)
+  {
+    VTK_PTR(vtkAlgorithm) queuedAlgorithm = m_QueuedApplyAlgorithm;
+    m_QueuedApplyAlgorithm = nullptr;
+    executeAlgorithm(queuedAlgorithm);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isAlgorithmBusy(vtkAlgorithm* algorithm) const
+{
+  if(nullptr == algorithm)
+  {
+    return false;
+  }
+  if(m_ApplyAlgorithm.GetPointer() == algorithm)
+  {
+    return true;
+  }
+
+  for(const CanceledApply& canceledApply : m_CanceledApplies)
+  {
+    if(canceledApply.m_Algorithm.GetPointer() == algorithm)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isCancelingApply() const
+{
+  return false == m_CanceledApplies.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::cancelApply()
+{
+  if(m_ApplyAlgorithm)
+  {
+    m_ApplyAlgorithm->SetAbortExecute(1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isApplying() const
+{
+  return m_ApplyAlgorithm != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::waitForApply()
+{
+  if(nullptr == m_ApplyAlgorithm)
+  {
+    return;
+  }
+
+  m_ApplyWatcher.waitForFinished();
+  applyFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::applyFinished()
+{
+  // Already handled by waitForApply or abortApply
+  if(nullptr == m_ApplyAlgorithm || m_ApplyWatcher.isRunning())
+  {
+    return;
+  }
+
+  VTK_PTR(vtkAlgorithm) algorithm = m_ApplyAlgorithm;
+  m_ApplyAlgorithm = nullptr;
+  algorithm->RemoveObserver(m_ApplyProgressTag);
+
+  if(algorithm->GetAbortExecute())
+  {
+    algorithm->SetAbortExecute(0);
+    algorithm->Modified();
+    emit applyCanceled();
+    return;
+  }
+
+  emit applyProgress(1.0);
+  setAppliedOutput(algorithm);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::hasAppliedOutput() const
+{
+  return m_ApplyOutputProducer != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSAbstractFilter::getAppliedOutputPort()
+{
+  if(nullptr == m_ApplyOutputProducer)
+  {
+    return nullptr;
+  }
+
+  restoreOutput();
+  VSOutputMemoryPolicy::Instance()->outputUsed(this);
+
+  return m_ApplyOutputProducer->GetOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSAbstractFilter::getAppliedOutput() const
+{
+  if(nullptr == m_ApplyOutputProducer)
+  {
+    return nullptr;
+  }
+
+  // Released outputs are only regenerated for the pipeline through getAppliedOutputPort.
+  // Const getters read the array layout kept by releaseOutput instead.
+  return vtkDataSet::SafeDownCast(m_ApplyOutputProducer->GetOutputDataObject(0));
+}
@@ -41,15 +41,20 @@
 
 #include <memory>
 
+#include <vtkAlgorithm.h>
 #include <vtkAlgorithmOutput.h>
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
 #include <vtkTransformFilter.h>
 #include <vtkTrivialProducer.h>
 
+#include <QtCore/QFuture>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QSemaphore>
 #include <QtCore/QString>
@@ -59,7 +64,10 @@
 #include <QtGui/QStandardItemModel>
 
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.h"
 #include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSHistogram.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSPreviewProxy.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSTransform.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -117,7 +125,7 @@ public:
   /**
    * @brief Deconstructor
    */
-  virtual ~VSAbstractFilter() = default;
+  virtual ~VSAbstractFilter();
 
   /**
    * @brief Deletes the item and removes it from the model
@@ -225,11 +233,45 @@ public:
   VTK_PTR(vtkDataArray) getDataArray(QString arrayName) const;
 
   /**
-   * @brief Returns the range of values for the given array
+   * @brief Returns the cached statistics for the given array
    * @param arrayName
    * @return
    */
-  double* getArrayValueRange(QString arrayName) const;
+  VSArrayStatisticsCache::StatisticsPtr getArrayStatistics(QString arrayName) const;
+
+  /**
+   * @brief Copies the range of values for the given array into the range parameter.
+   * Returns false if the array could not be found.
+   * @param arrayName
+   * @param range
+   * @return
+   */
+  bool getArrayValueRange(QString arrayName, double range[2]) const;
+
+  /**
+   * @brief Returns the histogram of an array component in this filter's output.  Use
+   * component -1 for the magnitude.  Histograms are cached until the output array is
+   * modified or replaced by a new apply.
+   * @param arrayName
+   * @param component
+   * @param numBins
+   * @param mode
+   * @return
+   */
+  VSHistogram getArrayHistogram(QString arrayName, int component = 0, int numBins = VSHistogram::DefaultNumberOfBins,
+                                VSHistogram::BinningMode mode = VSHistogram::BinningMode::Fixed) const;
+
+  /**
+   * @brief Computes the histogram returned by getArrayHistogram on a worker thread.
+   * Cached histograms are returned in a finished future.
+   * @param arrayName
+   * @param component
+   * @param numBins
+   * @param mode
+   * @return
+   */
+  QFuture<VSHistogram> getArrayHistogramAsync(QString arrayName, int component = 0, int numBins = VSHistogram::DefaultNumberOfBins,
+                                              VSHistogram::BinningMode mode = VSHistogram::BinningMode::Fixed) const;
 
   /**
    * @brief Returns the minimum value for the given array
@@ -277,7 +319,8 @@ public:
   virtual double* getBounds() const;
 
   /**
-   * @brief Returns the bounds from the vtkTransformFilter
+   * @brief Returns the bounds of the filter after applying the global transform.
+   * The local bounding box corners are transformed so that no geometry has to be copied.
    * @return
    */
   virtual double* getTransformBounds();
@@ -294,17 +337,75 @@ public:
   virtual VTK_PTR(vtkDataSet) getOutput() const = 0;
 
   /**
-   * @brief Returns the output port for the transformed filtered data
+   * @brief Returns the output port for the transformed filtered data.  Rendering
+   * applies the transform through the actor's user matrix, so this should only be
+   * used when a consumer requires the geometry in world coordinates.
    * @return
    */
   virtual vtkAlgorithmOutput* getTransformedOutputPort();
 
   /**
-   * @brief Returns the transformed output data
+   * @brief Returns the transformed output data.  This materializes a transformed
+   * copy of the output geometry.
    * @return
    */
   virtual VTK_PTR(vtkDataSet) getTransformedOutput();
 
+  /**
+   * @brief Returns true if an apply is currently running on a worker thread.
+   * Returns false otherwise.
+   * @return
+   */
+  bool isApplying() const;
+
+  /**
+   * @brief Blocks until the running apply finishes and its output has been
+   * swapped into the pipeline.  Used by scripts and benchmarks that require the
+   * filter output immediately after calling apply.
+   */
+  Q_INVOKABLE void waitForApply();
+
+  /**
+   * @brief Returns the filter whose applied output is returned by getOutputPort.
+   * Filters without an applied output pass their parent's output through.
+   * @return
+   */
+  VSAbstractFilter* getOutputSource();
+
+  /**
+   * @brief Returns true if the applied output can be released and regenerated from
+   * the parent filter later.  Returns false otherwise.
+   * @return
+   */
+  bool canReleaseOutput() const;
+
+  /**
+   * @brief Returns true if the applied output has been released.  Returns false otherwise.
+   * @return
+   */
+  bool isOutputReleased() const;
+
+  /**
+   * @brief Returns false while the output is a preview that has not been replaced
+   * by a full apply.  Children wait for the committed output before re-applying.
+   * @return
+   */
+  bool isOutputCommitted() const;
+
+  /**
+   * @brief Releases the applied output and the transformed copy.  The output is
+   * regenerated from the parent filter the next time its output port is requested.
+   * Until then getOutput returns an empty output with the same arrays.
+   */
+  void releaseOutput();
+
+  /**
+   * @brief Returns the number of bytes used by the resident applied output.  Buffers
+   * shared with the parent filter's output are not counted.
+   * @return
+   */
+  size_t getOutputMemorySize() const;
+
   /**
    * @brief Returns the filter name
    * @return
@@ -336,6 +437,21 @@ public:
    */
   bool isPointData() const;
 
+  /**
+   * @brief Returns true if the output is a vtkUniformGrid whose hidden cells are
+   * marked in its vtkGhostType array instead of removed.  Returns false otherwise.
+   * @return
+   */
+  virtual bool hasBlankedOutput() const;
+
+  /**
+   * @brief Returns true if the filter skips the hidden cells of a blanked input.
+   * Filters that blank their output only do so while every child accepts it.
+   * Returns false by default.
+   * @return
+   */
+  virtual bool acceptsBlankedInput() const;
+
   /**
    * @brief Returns true if the input dataType_t is compatible with a given required type
    * @param inputType
@@ -431,9 +547,19 @@ public:
   static bool SameFilterType(VSAbstractFilter::FilterListType filters);
   static bool HasPointData(VSAbstractFilter::FilterListType filters);
 
+public slots:
+  /**
+   * @brief Requests that the running apply stops.  The previous output is kept
+   * and applyCanceled is emitted once the worker thread has returned.
+   */
+  void cancelApply();
+
 signals:
   void updatedOutputPort(VSAbstractFilter* filter);
   void updatedOutput();
+  void applyStarted();
+  void applyProgress(double progress);
+  void applyCanceled();
   void transformChanged();
   void errorGenerated(const QString& title, const QString& msg, const int& errorCode);
   void removeFilter();
@@ -461,6 +587,11 @@ protected slots:
    */
   void updateTransformFilter();
 
+  /**
+   * @brief Swaps the finished apply output into the pipeline and emits updatedOutputPort
+   */
+  void applyFinished();
+
 protected:
   /**
    * @brief Constructor
@@ -495,6 +626,28 @@ protected:
    */
   virtual void updateAlgorithmInput(VSAbstractFilter* filter) = 0;
 
+  /**
+   * @brief Called after a child filter is added or removed.  Does nothing by default.
+   */
+  virtual void childrenChanged();
+
+  /**
+   * @brief Returns true if the given algorithm's output references the memory of its
+   * input instead of copying it.  The input arrays are then kept alive for as long as
+   * the applied output.  Returns false by default.
+   * @param algorithm
+   * @return
+   */
+  virtual bool outputReferencesInput(vtkAlgorithm* algorithm) const;
+
+  /**
+   * @brief Called while the applied output is stored, before the algorithm releases its
+   * data.  Filters whose algorithm has more than one output port copy the other outputs
+   * here.  Does nothing by default.
+   * @param algorithm
+   */
+  virtual void storeAdditionalOutputs(vtkAlgorithm* algorithm);
+
   /**
    * @brief Returns a list of component names for a given vtkAbstractArray
    * @param array
@@ -532,6 +685,71 @@ protected:
    */
   void setInputPort(VTK_PTR(vtkAlgorithmOutput) inputPort);
 
+  /**
+   * @brief Runs the given algorithm on a worker thread against a snapshot of the
+   * parent filter's output.  Progress is forwarded through applyProgress and the
+   * result is only swapped into the pipeline once the update completes.
+   * Callers must call abortApply() before reconfiguring the algorithm, and must not
+   * reconfigure it while isCancelingApply() returns true.  Until the first apply
+   * finishes the filter's output is empty.
+   * @param algorithm
+   */
+  void executeAlgorithm(VTK_PTR(vtkAlgorithm) algorithm);
+
+  /**
+   * @brief Updates the given algorithm synchronously against a cached, decimated
+   * proxy of the parent filter's output and swaps the result into the pipeline.
+   * Used while a widget is being dragged; the full resolution output should be
+   * computed with executeAlgorithm once the interaction ends.  Children are not
+   * updated until then.  While the proxy is built on a worker thread the preview
+   * is deferred and only the latest algorithm is run once it is ready.
+   * @param algorithm
+   */
+  void executePreview(VTK_PTR(vtkAlgorithm) algorithm);
+
+  /**
+   * @brief Aborts the running apply without waiting for the worker thread.  The
+   * previous output is kept.  The aborted algorithm stays busy until its update
+   * returns; executeAlgorithm queues a rerun of a busy algorithm until then.
+   */
+  void abortApply();
+
+  /**
+   * @brief Returns true if the given algorithm is running on a worker thread,
+   * including canceled applies that have not returned yet.  Returns false otherwise.
+   * @param algorithm
+   * @return
+   */
+  bool isAlgorithmBusy(vtkAlgorithm* algorithm) const;
+
+  /**
+   * @brief Returns true while a canceled apply has not returned from its worker
+   * thread.  Subclasses create new algorithms instead of reconfiguring the ones
+   * it may still be reading.
+   * @return
+   */
+  bool isCancelingApply() const;
+
+  /**
+   * @brief Returns true if an apply has completed and produced an output
+   * @return
+   */
+  bool hasAppliedOutput() const;
+
+  /**
+   * @brief Returns the output port holding the last completed apply output
+   * @return
+   */
+  vtkAlgorithmOutput* getAppliedOutputPort();
+
+  /**
+   * @brief Returns the last completed apply output.  A released output is not
+   * regenerated; only its array layout is returned.  This does not count as a use
+   * of the output for the VSOutputMemoryPolicy.
+   * @return
+   */
+  VTK_PTR(vtkDataSet) getAppliedOutput() const;
+
   /**
    * @Brief Sets whether or not the filter is checkable
    * @param checkable
@@ -569,12 +787,134 @@ private:
    */
   void removeChild(VSAbstractFilter* child);
 
+  /**
+   * @brief Returns the parent filter's finished output without executing any part of
+   * the pipeline on this thread.  Returns nullptr while the parent's output is still
+   * being applied in the background.
+   * @return
+   */
+  vtkDataObject* updateParentOutput();
+
+  /**
+   * @brief Copies the algorithm output into the applied output producer and emits updatedOutputPort
+   * @param algorithm
+   */
+  void setAppliedOutput(vtkAlgorithm* algorithm);
+
+  /**
+   * @brief Copies the algorithm output into the applied output producer.  The algorithm's
+   * own input and output are released afterwards if its ReleaseDataFlag is set.
+   * Returns false if the algorithm has no output.
+   * @param algorithm
+   * @return
+   */
+  bool storeAppliedOutput(vtkAlgorithm* algorithm);
+
+  /**
+   * @brief Releases the abort state of an algorithm whose canceled update has
+   * returned and starts a queued apply that was waiting for it
+   * @param algorithm
+   * @param progressTag
+   */
+  void finishCanceledApply(VTK_PTR(vtkAlgorithm) algorithm, unsigned long progressTag);
+
+  /**
+   * @brief Regenerates a released output by applying the last applied algorithm
+   * against the parent filter's output on a worker thread.  updatedOutputPort is
+   * emitted once the output is resident again.
+   */
+  void restoreOutput();
+
   std::shared_ptr<VSTransform> m_Transform;
   VTK_PTR(vtkTransformFilter) m_TransformFilter;
+  double m_TransformBounds[6];
   mutable QSemaphore m_ChildLock;
   bool m_ConnectedInput = false;
   VTK_PTR(vtkAlgorithmOutput) m_InputPort;
 
+  QFutureWatcher<void> m_ApplyWatcher;
+  VTK_PTR(vtkAlgorithm) m_ApplyAlgorithm;
+  VTK_PTR(vtkTrivialProducer) m_ApplyOutputProducer;
+  VTK_PTR(vtkAlgorithm) m_OutputAlgorithm;
+  VTK_PTR(vtkDataObject) m_ReferencedInput;
+  bool m_OutputReleased = false;
+  bool m_OutputCommitted = true;
+  unsigned long m_ApplyProgressTag = 0;
+  VTK_PTR(vtkAlgorithm) m_QueuedApplyAlgorithm;
+
+  struct CanceledApply
+  {
+    VTK_PTR(vtkAlgorithm) m_Algorithm;
+    unsigned long m_ProgressTag = 0;
+    QFutureWatcher<void>* m_Watcher = nullptr;
+  };
+  std::list<CanceledApply> m_CanceledApplies;
+  VSPreviewProxy m_PreviewProxy;
+  QFutureWatcher<void> m_PreviewProxyWatcher;
+  VTK_PTR(vtkAlgorithm) m_PendingPreviewAlgorithm;
+
+  struct HistogramCacheEntry
+  {
+    QString m_ArrayName;
+    VSArrayStatisticsCache::StatisticsPtr m_Statistics;
+    const vtkDataArray* m_GhostArray = nullptr;
+    vtkMTimeType m_GhostMTime = 0;
+    VSHistogram m_Histogram;
+    unsigned long long m_LastUse = 0;
+  };
+
+  /**
+   * @brief Histograms are computed on worker threads that can outlive the filter,
+   * so the cache is shared with them and guarded by its own mutex.
+   */
+  struct HistogramCache
+  {
+    QMutex m_Mutex;
+    QMap<QString, HistogramCacheEntry> m_Entries;
+    unsigned long long m_UseCount = 0;
+  };
+  std::shared_ptr<HistogramCache> m_HistogramCache = std::make_shared<HistogramCache>();
+
+  /**
+   * @brief Returns the cell ghost array to skip hidden cells with when computing the
+   * histogram of the given output array, or nullptr if the output is not blanked
+   * @param dataArray
+   * @return
+   */
+  VTK_PTR(vtkDataArray) getHistogramGhostArray(vtkDataArray* dataArray) const;
+
+  /**
+   * @brief Returns the cached histogram for the given key or an invalid histogram
+   * @param cache
+   * @param key
+   * @return
+   */
+  static VSHistogram FindCachedHistogram(const std::shared_ptr<HistogramCache>& cache, const QString& key);
+
+  /**
+   * @brief Returns the histogram of the given array, computing and caching it if the
+   * cached histogram is out of date.  Safe to call from a worker thread.
+   * @param cache
+   * @param key
+   * @param arrayName
+   * @param dataArray
+   * @param ghostArray
+   * @param component
+   * @param numBins
+   * @param mode
+   * @return
+   */
+  static VSHistogram ComputeArrayHistogram(const std::shared_ptr<HistogramCache>& cache, const QString& key, const QString& arrayName, VTK_PTR(vtkDataArray) dataArray,
+                                           VTK_PTR(vtkDataArray) ghostArray, int component, int numBins, VSHistogram::BinningMode mode);
+
+  struct VertexGridCacheEntry
+  {
+    const vtkDataSet* m_DataSet = nullptr;
+    vtkMTimeType m_MTime = 0;
+    bool m_IsVertexGrid = false;
+  };
+  mutable VertexGridCacheEntry m_VertexGridCache;
+
   std::list<VSAbstractFilter*> m_Children;
   bool m_Checked = false;
   QString m_Tooltip;
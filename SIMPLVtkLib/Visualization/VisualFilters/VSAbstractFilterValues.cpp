@@ -37,6 +37,8 @@
 
 #include "VSAbstractFilter.h"
 
+#include "SIMPLVtkLib/Visualization/VtkWidgets/VSAbstractWidget.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -135,3 +137,70 @@ QWidget* VSAbstractFilterValues::createFilterWidget()
 {
   return new QWidget();
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilterValues::isInteractivePreviewEnabled() const
+{
+  return m_InteractivePreviewEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::setInteractivePreviewEnabled(bool enabled)
+{
+  m_InteractivePreviewEnabled = enabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::observeWidgetInteraction(VSAbstractWidget* widget)
+{
+  connect(widget, &VSAbstractWidget::interactionStarted, this, &VSAbstractFilterValues::beginInteractivePreview);
+  connect(widget, &VSAbstractWidget::modified, this, &VSAbstractFilterValues::updateInteractivePreview);
+  connect(widget, &VSAbstractWidget::interactionEnded, this, &VSAbstractFilterValues::endInteractivePreview);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::beginInteractivePreview()
+{
+  m_InteractivePreview = m_InteractivePreviewEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::updateInteractivePreview()
+{
+  if(m_InteractivePreview)
+  {
+    previewValues();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::endInteractivePreview()
+{
+  if(false == m_InteractivePreview)
+  {
+    return;
+  }
+
+  // Replace the preview with the full resolution output computed in the background
+  m_InteractivePreview = false;
+  applyValues();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::previewValues()
+{
+}
@@ -43,6 +43,8 @@
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
 
+class VSAbstractWidget;
+
 /**
  * @class VSAbstractFilterValues VSAbstractFilterValues.h
  * SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilterValues.h
@@ -112,9 +114,38 @@ public:
    */
   virtual QWidget* createFilterWidget();
 
+  /**
+   * @brief Returns true if dragging a widget previews the filter on a decimated
+   * proxy and applies the full resolution values when the drag ends.
+   * @return
+   */
+  bool isInteractivePreviewEnabled() const;
+
+  /**
+   * @brief Sets whether or not dragging a widget previews the filter on a decimated proxy
+   * @param enabled
+   */
+  void setInteractivePreviewEnabled(bool enabled);
+
 signals:
   void alertChangesWaiting();
 
+protected slots:
+  /**
+   * @brief Starts previewing widget changes on the selected filters
+   */
+  void beginInteractivePreview();
+
+  /**
+   * @brief Previews the current widget values if a widget is being dragged
+   */
+  void updateInteractivePreview();
+
+  /**
+   * @brief Stops previewing and applies the current values at full resolution
+   */
+  void endInteractivePreview();
+
 protected:
   VSAbstractFilterValues(VSAbstractFilter* filter);
 
@@ -130,8 +161,22 @@ protected:
    */
   vtkRenderWindowInteractor* getInteractor() const;
 
+  /**
+   * @brief Previews the current values on the selected filters.  Subclasses
+   * that support interactive previews should override this method.
+   */
+  virtual void previewValues();
+
+  /**
+   * @brief Connects the widget's interaction signals to the interactive preview slots
+   * @param widget
+   */
+  void observeWidgetInteraction(VSAbstractWidget* widget);
+
 private:
   VSAbstractFilter::FilterListType m_Selection;
   bool m_RenderingEnabled = true;
   vtkRenderWindowInteractor* m_Interactor = nullptr;
+  bool m_InteractivePreviewEnabled = true;
+  bool m_InteractivePreview = false;
 };
@@ -90,7 +90,6 @@ VSClipFilter* VSClipFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
 void VSClipFilter::createFilter()
 {
   m_ClipAlgorithm = vtkSmartPointer<vtkTableBasedClipDataSet>::New();
-  m_ClipAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
   setConnectedInput(true);
 }
 
@@ -171,12 +170,55 @@ void VSClipFilter::applyValues(VSClipValues* values)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSClipFilter::previewValues(VSClipValues* values)
+{
+  if(nullptr == values)
+  {
+    return;
+  }
+
+  VTK_PTR(vtkImplicitFunction) clipFunction;
+  switch(values->getClipType())
+  {
+  case ClipType::BOX:
+    clipFunction = values->getBoxWidget()->getPlanes();
+    break;
+  case ClipType::PLANE:
+  {
+    VSPlaneWidget* planeWidget = values->getPlaneWidget();
+    VTK_NEW(vtkPlane, plane);
+    plane->SetOrigin(planeWidget->getOrigin());
+    plane->SetNormal(planeWidget->getNormal());
+    clipFunction = plane;
+    break;
+  }
+  default:
+    return;
+  }
+
+  abortApply();
+
+  if(nullptr == m_ClipAlgorithm || isCancelingApply())
+  {
+    createFilter();
+  }
+
+  m_ClipAlgorithm->SetClipFunction(clipFunction);
+  m_ClipAlgorithm->SetInsideOut(values->isInverted());
+  executePreview(m_ClipAlgorithm);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void VSClipFilter::apply(double origin[3], double normal[3], bool inverted)
 {
-  if(nullptr == m_ClipAlgorithm)
+  abortApply();
+
+  if(nullptr == m_ClipAlgorithm || isCancelingApply())
   {
     createFilter();
   }
@@ -195,9 +237,7 @@ void VSClipFilter::apply(double origin[3], double normal[3], bool inverted)
 
   m_ClipAlgorithm->SetClipFunction(plane);
   m_ClipAlgorithm->SetInsideOut(inverted);
-  m_ClipAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  executeAlgorithm(m_ClipAlgorithm);
   emit clipTypeChanged();
 }
 
@@ -211,7 +251,9 @@ void VSClipFilter::apply(VTK_PTR(vtkPlanes) planes, VTK_PTR(vtkTransform) transf
     return;
   }
 
-  if(nullptr == m_ClipAlgorithm)
+  abortApply();
+
+  if(nullptr == m_ClipAlgorithm || isCancelingApply())
   {
     createFilter();
   }
@@ -223,9 +265,7 @@ void VSClipFilter::apply(VTK_PTR(vtkPlanes) planes, VTK_PTR(vtkTransform) transf
 
   m_ClipAlgorithm->SetClipFunction(planes);
   m_ClipAlgorithm->SetInsideOut(inverted);
-  m_ClipAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  executeAlgorithm(m_ClipAlgorithm);
   emit clipTypeChanged();
 }
 
@@ -403,9 +443,9 @@ QUuid VSClipFilter::GetUuid()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSClipFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_ClipAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ClipAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -420,9 +460,9 @@ vtkAlgorithmOutput* VSClipFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSClipFilter::getOutput() const
 {
-  if(getConnectedInput() && m_ClipAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ClipAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -446,7 +486,8 @@ void VSClipFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_ClipAlgorithm)
   {
-    m_ClipAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Rerun the last applied values against the new input
+    executeAlgorithm(m_ClipAlgorithm);
   }
   else
   {
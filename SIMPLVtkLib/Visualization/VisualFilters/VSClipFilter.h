@@ -137,6 +137,13 @@ public:
    */
   void applyValues(VSClipValues* values);
 
+  /**
+   * @brief Clips a decimated proxy of the input using the given values.  Used
+   * while the plane or box widget is being dragged.
+   * @param values
+   */
+  void previewValues(VSClipValues* values);
+
   /**
    * @brief Applies the clip filter using a plane with the given values
    * @param origin
@@ -51,6 +51,8 @@ VSClipValues::VSClipValues(VSClipFilter* filter)
 
   connect(m_BoxWidget, &VSBoxWidget::modified, this, &VSClipValues::alertChangesWaiting);
   connect(m_PlaneWidget, &VSPlaneWidget::modified, this, &VSClipValues::alertChangesWaiting);
+  observeWidgetInteraction(m_BoxWidget);
+  observeWidgetInteraction(m_PlaneWidget);
 
   // Set the last applied plane to the default representation
   m_PlaneWidget->setUsePlaneNormal(m_PlaneWidget->getNormal());
@@ -120,6 +122,22 @@ void VSClipValues::applyValues()
   m_FreshFilter = false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSClipValues::previewValues()
+{
+  VSAbstractFilter::FilterListType filters = getSelection();
+  for(VSAbstractFilter* filter : filters)
+  {
+    VSClipFilter* clipFilter = dynamic_cast<VSClipFilter*>(filter);
+    if(clipFilter)
+    {
+      clipFilter->previewValues(this);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
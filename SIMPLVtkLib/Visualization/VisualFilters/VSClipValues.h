@@ -265,6 +265,11 @@ protected:
    */
   void updateRendering();
 
+  /**
+   * @brief Previews the current clip values on the selected filters
+   */
+  void previewValues() override;
+
 private:
   bool m_Inverted = false;
   VSBoxWidget* m_BoxWidget = nullptr;
@@ -0,0 +1,319 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSCompoundThreshold.h"
+
+#include <algorithm>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkExtractCells.h>
+#include <vtkIdList.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
+#include <vtkUniformGrid.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+vtkStandardNewMacro(VSCompoundThreshold);
+
+namespace
+{
+/**
+ * @brief Raw memory and range for a single cell array term
+ */
+struct RangeTerm
+{
+  const void* Values;
+  int DataType;
+  int NumComps;
+  int Component;
+  double Lower;
+  double Upper;
+};
+
+/**
+ * @brief Evaluates one range over [begin, end) and combines it into the mask
+ */
+template <typename T>
+void EvaluateRange(const T* values, const RangeTerm& term, bool firstTerm, bool combineAny, vtkIdType begin, vtkIdType end, unsigned char* mask)
+{
+  const int numComps = term.NumComps;
+  const T* value = values + begin * numComps + term.Component;
+  for(vtkIdType i = begin; i < end; i++, value += numComps)
+  {
+    double v = static_cast<double>(*value);
+    unsigned char inRange = static_cast<unsigned char>((v >= term.Lower) & (v <= term.Upper));
+    if(firstTerm)
+    {
+      mask[i] = inRange;
+    }
+    else if(combineAny)
+    {
+      mask[i] |= inRange;
+    }
+    else
+    {
+      mask[i] &= inRange;
+    }
+  }
+}
+
+/**
+ * @brief Evaluates every term for a block of cells before moving on to the next
+ * block, so each block of the mask stays in cache while the terms are fused.
+ */
+class CompoundMaskFunctor
+{
+public:
+  CompoundMaskFunctor(const std::vector<RangeTerm>& terms, bool combineAny, unsigned char* mask)
+  : m_Terms(terms)
+  , m_CombineAny(combineAny)
+  , m_Mask(mask)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    bool firstTerm = true;
+    for(const RangeTerm& term : m_Terms)
+    {
+      switch(term.DataType)
+      {
+        vtkTemplateMacro(EvaluateRange(static_cast<const VTK_TT*>(term.Values), term, firstTerm, m_CombineAny, begin, end, m_Mask));
+      default:
+        break;
+      }
+      firstTerm = false;
+    }
+  }
+
+private:
+  const std::vector<RangeTerm>& m_Terms;
+  bool m_CombineAny;
+  unsigned char* m_Mask;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCompoundThreshold::VSCompoundThreshold() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCompoundThreshold::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "CombineMode: " << (CombineMode == COMBINE_ANY ? "Any" : "All") << "\n";
+  os << indent << "BlankImages: " << (BlankImages ? "On" : "Off") << "\n";
+  for(const Range& range : Ranges)
+  {
+    os << indent << "Range: " << range.ArrayName << "[" << range.Component << "] in [" << range.Lower << ", " << range.Upper << "]\n";
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCompoundThreshold::AddRange(const char* arrayName, double lower, double upper, int component)
+{
+  if(nullptr == arrayName)
+  {
+    return;
+  }
+
+  Ranges.push_back({arrayName, lower, upper, component});
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCompoundThreshold::RemoveAllRanges()
+{
+  if(false == Ranges.empty())
+  {
+    Ranges.clear();
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSCompoundThreshold::GetNumberOfRanges() const
+{
+  return static_cast<int>(Ranges.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSCompoundThreshold::RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if(BlankImages && vtkImageData::GetData(inputVector[0]))
+  {
+    if(nullptr == vtkUniformGrid::GetData(outInfo))
+    {
+      VTK_NEW(vtkUniformGrid, output);
+      outInfo->Set(vtkDataObject::DATA_OBJECT(), output);
+    }
+  }
+  else if(nullptr == vtkUnstructuredGrid::GetData(outInfo))
+  {
+    VTK_NEW(vtkUnstructuredGrid, output);
+    outInfo->Set(vtkDataObject::DATA_OBJECT(), output);
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSCompoundThreshold::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkDataSet* input = vtkDataSet::GetData(inputVector[0]);
+  vtkDataSet* output = vtkDataSet::GetData(outputVector);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  // Failures leave an empty output instead of showing the unthresholded input
+  output->Initialize();
+
+  vtkIdType numCells = input->GetNumberOfCells();
+  std::vector<RangeTerm> terms;
+  for(const Range& range : Ranges)
+  {
+    vtkDataArray* array = input->GetCellData()->GetArray(range.ArrayName.c_str());
+    if(nullptr == array || array->GetNumberOfTuples() != numCells)
+    {
+      vtkErrorMacro(<< "Missing cell array: " << range.ArrayName);
+      return 0;
+    }
+
+    int numComps = array->GetNumberOfComponents();
+    int component = (range.Component >= 0 && range.Component < numComps) ? range.Component : 0;
+    terms.push_back({array->GetVoidPointer(0), array->GetDataType(), numComps, component, range.Lower, range.Upper});
+  }
+
+  if(GetAbortExecute())
+  {
+    return 0;
+  }
+
+  VTK_NEW(vtkUnsignedCharArray, mask);
+  mask->SetNumberOfTuples(numCells);
+  unsigned char* maskPtr = mask->GetPointer(0);
+
+  // Without any ranges every cell passes.  The output type is still built below
+  // because an unstructured output cannot hold a copy of image input.
+  if(terms.empty())
+  {
+    std::fill(maskPtr, maskPtr + numCells, static_cast<unsigned char>(1));
+  }
+  else
+  {
+    CompoundMaskFunctor functor(terms, COMBINE_ANY == CombineMode, maskPtr);
+    vtkSMPTools::For(0, numCells, functor);
+  }
+  UpdateProgress(0.5);
+
+  // Any existing ghost array is shared with the input and must not be modified
+  const unsigned char* inputGhosts = nullptr;
+  vtkUnsignedCharArray* inputGhostArray = vtkUnsignedCharArray::SafeDownCast(input->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  if(inputGhostArray && inputGhostArray->GetNumberOfTuples() == numCells)
+  {
+    inputGhosts = inputGhostArray->GetPointer(0);
+  }
+  const unsigned char hidden = vtkDataSetAttributes::HIDDENCELL;
+
+  vtkUniformGrid* uniformGrid = vtkUniformGrid::SafeDownCast(output);
+  if(uniformGrid)
+  {
+    uniformGrid->ShallowCopy(input);
+
+    // Convert the mask in place into the blanking array
+    auto maskToGhosts = [maskPtr, inputGhosts, hidden](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        maskPtr[i] = static_cast<unsigned char>(1 - maskPtr[i]) * hidden;
+      }
+      if(inputGhosts)
+      {
+        for(vtkIdType i = begin; i < end; i++)
+        {
+          maskPtr[i] |= inputGhosts[i];
+        }
+      }
+    };
+    vtkSMPTools::For(0, numCells, maskToGhosts);
+
+    mask->SetName(vtkDataSetAttributes::GhostArrayName());
+    uniformGrid->GetCellData()->AddArray(mask);
+  }
+  else
+  {
+    VTK_NEW(vtkIdList, cellIds);
+    cellIds->Allocate(numCells);
+    for(vtkIdType i = 0; i < numCells; i++)
+    {
+      if(maskPtr[i] && (nullptr == inputGhosts || 0 == (inputGhosts[i] & hidden)))
+      {
+        cellIds->InsertNextId(i);
+      }
+    }
+
+    VTK_NEW(vtkExtractCells, extractCells);
+    extractCells->SetInputData(input);
+    extractCells->SetCellList(cellIds);
+    extractCells->Update();
+    output->ShallowCopy(extractCells->GetOutput());
+  }
+
+  UpdateProgress(1.0);
+  return 1;
+}
@@ -0,0 +1,142 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <vtkDataSetAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSCompoundThreshold VSCompoundThreshold.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSCompoundThreshold.h
+ * @brief This vtkAlgorithm thresholds a data set by several cell array ranges
+ * at once.  The ranges are combined with either AND or OR in a single parallel
+ * pass over the cells, so no intermediate data set is created for each range.
+ * Image data input is blanked into a vtkUniformGrid the same way as
+ * VSImageBlankingThreshold unless BlankImages is off.  All other input types
+ * have the selected cells extracted into a vtkUnstructuredGrid.  Cells hidden by
+ * the input's blanking are never extracted.
+ */
+class SIMPLVtkLib_EXPORT VSCompoundThreshold : public vtkDataSetAlgorithm
+{
+public:
+  enum CombineModes
+  {
+    COMBINE_ALL = 0,
+    COMBINE_ANY = 1
+  };
+
+  static VSCompoundThreshold* New();
+  vtkTypeMacro(VSCompoundThreshold, vtkDataSetAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Adds a cell array range.  Cells pass the range when the selected
+   * component is between lower and upper, inclusive.
+   * @param arrayName
+   * @param lower
+   * @param upper
+   * @param component
+   */
+  void AddRange(const char* arrayName, double lower, double upper, int component = 0);
+
+  /**
+   * @brief Removes all ranges
+   */
+  void RemoveAllRanges();
+
+  /**
+   * @brief Returns the number of ranges
+   * @return
+   */
+  int GetNumberOfRanges() const;
+
+  /**
+   * @brief Sets whether cells must pass all ranges or any range
+   */
+  vtkSetClampMacro(CombineMode, int, COMBINE_ALL, COMBINE_ANY)
+  vtkGetMacro(CombineMode, int)
+
+  /**
+   * @brief Sets whether image data input is blanked instead of extracted.  Consumers
+   * that do not honor vtkGhostType need the extracted vtkUnstructuredGrid.  On by default.
+   */
+  vtkSetMacro(BlankImages, bool)
+  vtkGetMacro(BlankImages, bool)
+  vtkBooleanMacro(BlankImages, bool)
+
+protected:
+  VSCompoundThreshold();
+  ~VSCompoundThreshold() override = default;
+
+  /**
+   * @brief Creates a vtkUniformGrid output for image data input that is blanked
+   * and a vtkUnstructuredGrid output otherwise
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Evaluates the ranges and produces the thresholded output
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  struct Range
+  {
+    std::string ArrayName;
+    double Lower;
+    double Upper;
+    int Component;
+  };
+
+  std::vector<Range> Ranges;
+  int CombineMode = COMBINE_ALL;
+  bool BlankImages = true;
+
+private:
+  VSCompoundThreshold(const VSCompoundThreshold&) = delete;
+  void operator=(const VSCompoundThreshold&) = delete;
+};
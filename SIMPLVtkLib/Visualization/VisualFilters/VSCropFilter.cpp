@@ -40,7 +40,9 @@
 #include <QtCore/QJsonArray>
 #include <QtCore/QUuid>
 
+#include "SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
+#include <vtkCellData.h>
 #include <vtkExtractVOI.h>
 
 #include <vtkRenderWindowInteractor.h>
@@ -88,7 +90,7 @@ void VSCropFilter::createFilter()
 {
   m_CropAlgorithm = vtkSmartPointer<vtkExtractVOI>::New();
   m_CropAlgorithm->IncludeBoundaryOn();
-  m_CropAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+  m_HyperslabAlgorithm = VTK_PTR(VSHyperslabCropReader)::New();
 
   setConnectedInput(true);
 }
@@ -109,20 +111,78 @@ void VSCropFilter::applyValues(VSCropValues* values)
 // -----------------------------------------------------------------------------
 void VSCropFilter::apply(int voi[6], int sampleRate[3])
 {
-  if(nullptr == m_CropAlgorithm)
+  abortApply();
+
+  // Save the applied values for resetting Crop-Type widgets
+  m_CropValues->setLastVOI(voi);
+  m_CropValues->setLastSampleRate(sampleRate);
+
+  executeAlgorithm(prepareCropAlgorithm(voi, sampleRate));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSCropFilter::canReadFromFile() const
+{
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(getParentFilter());
+  if(nullptr == dcFilter || nullptr == dcFilter->getWrappedDataContainer())
+  {
+    return false;
+  }
+
+  // Arrays already in memory are faster to extract than to read again
+  vtkImageData* imageData = vtkImageData::SafeDownCast(dcFilter->getOutput());
+  if(nullptr == imageData || imageData->GetCellData()->GetNumberOfArrays() > 0)
+  {
+    return false;
+  }
+
+  // Whether the file is HDF5 is checked by the reader off the GUI thread
+  return false == dcFilter->getFilePath().isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithm* VSCropFilter::prepareCropAlgorithm(const int voi[6], const int sampleRate[3])
+{
+  if(nullptr == m_CropAlgorithm || isCancelingApply())
   {
     createFilter();
   }
 
-  // Save the applied values for resetting Crop-Type widgets
-  m_CropAlgorithm->SetVOI(voi);
-  m_CropAlgorithm->SetSampleRate(sampleRate);
-  m_CropAlgorithm->Update();
+  if(false == canReadFromFile())
+  {
+    m_CropAlgorithm->SetVOI(const_cast<int*>(voi));
+    m_CropAlgorithm->SetSampleRate(const_cast<int*>(sampleRate));
+    return m_CropAlgorithm;
+  }
 
-  m_CropValues->setLastVOI(voi);
-  m_CropValues->setLastSampleRate(sampleRate);
+  // The parent was imported without arrays, so every cell array is read
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(getParentFilter());
+  QString amName;
+  DataContainer::Pointer dc = dcFilter->getWrappedDataContainer()->m_DataContainer;
+  if(dc)
+  {
+    for(AttributeMatrix::Pointer am : dc->getAttributeMatrices())
+    {
+      if(am->getType() == AttributeMatrix::Type::Cell)
+      {
+        amName = am->getName();
+        break;
+      }
+    }
+  }
 
-  emit updatedOutputPort(this);
+  m_HyperslabAlgorithm->SetFileName(dcFilter->getFilePath().toStdString().c_str());
+  m_HyperslabAlgorithm->SetDataContainerName(dcFilter->getWrappedDataContainer()->m_Name.toStdString().c_str());
+  m_HyperslabAlgorithm->SetAttributeMatrixName(amName.isEmpty() ? nullptr : amName.toStdString().c_str());
+  m_HyperslabAlgorithm->SetArrayNames(std::vector<std::string>());
+  m_HyperslabAlgorithm->SetHDF5Mutex(VSConcurrentImport::HDF5Mutex());
+  m_HyperslabAlgorithm->SetVOI(const_cast<int*>(voi));
+  m_HyperslabAlgorithm->SetSampleRate(const_cast<int*>(sampleRate));
+  return m_HyperslabAlgorithm;
 }
 
 // -----------------------------------------------------------------------------
@@ -200,9 +260,9 @@ VSAbstractFilter::FilterType VSCropFilter::getFilterType() const
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSCropFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_CropAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_CropAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -217,9 +277,9 @@ vtkAlgorithmOutput* VSCropFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSCropFilter::getOutput() const
 {
-  if(getConnectedInput() && m_CropAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_CropAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -243,7 +303,9 @@ void VSCropFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_CropAlgorithm)
   {
-    m_CropAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Rerun the last applied values against the new input
+    abortApply();
+    executeAlgorithm(prepareCropAlgorithm(m_CropValues->getLastVOI(), m_CropValues->getLastSampleRate()));
   }
   else
   {
@@ -277,6 +339,12 @@ bool VSCropFilter::CompatibleWithParent(VSAbstractFilter* filter)
     return false;
   }
 
+  // Blanked cells are not skipped when extracting image subsets
+  if(filter->hasBlankedOutput())
+  {
+    return false;
+  }
+
   if(CompatibleInput(filter->getOutputType(), GetRequiredInputType()))
   {
     return true;
@@ -45,6 +45,7 @@
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
+#include "SIMPLVtkLib/SIMPLBridge/VSHyperslabCropReader.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropValues.h"
 
 /**
@@ -54,7 +55,9 @@
  * and Z bounds. This class can be chained with other VSAbstractFilters to
  * further specify the data allowed to be visualized. This filter requires
  * the incoming data type to be a vtkImageData, thus restricting it to following
- * VSSIMPLDataContainerFilters.
+ * VSSIMPLDataContainerFilters.  When the parent data container was imported
+ * from a .dream3d file without its arrays, the cropped cells are read from the
+ * file with HDF5 hyperslabs instead of being extracted from memory.
  */
 class SIMPLVtkLib_EXPORT VSCropFilter : public VSAbstractFilter
 {
@@ -200,8 +203,25 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns true if the parent is an image data container imported without
+   * its arrays from a file, so that the crop has to be read from the file.  Returns
+   * false if the arrays are in memory.  The file is not touched on the calling thread.
+   * @return
+   */
+  bool canReadFromFile() const;
+
+  /**
+   * @brief Returns the algorithm that crops the parent output with the given values
+   * @param voi
+   * @param sampleRate
+   * @return
+   */
+  vtkAlgorithm* prepareCropAlgorithm(const int voi[6], const int sampleRate[3]);
+
 private:
   VTK_PTR(vtkExtractVOI) m_CropAlgorithm;
+  VTK_PTR(VSHyperslabCropReader) m_HyperslabAlgorithm;
   VSCropValues* m_CropValues = nullptr;
 };
 
@@ -264,6 +264,22 @@ void VSCropValues::setSampleRate(int sampleRate[3])
   emit sampleRateChanged(sampleRate);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int* VSCropValues::getLastVOI() const
+{
+  return m_LastVoi;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int* VSCropValues::getLastSampleRate() const
+{
+  return m_LastSampleRate;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -106,6 +106,18 @@ public:
    */
   void setSampleRate(int sampleRate[3]);
 
+  /**
+   * @brief Returns the last applied volume of interest
+   * @return
+   */
+  const int* getLastVOI() const;
+
+  /**
+   * @brief Returns the last applied sample rate
+   * @return
+   */
+  const int* getLastSampleRate() const;
+
   /**
    * @brief Updates the last applied volume of interest
    * @param voi
@@ -0,0 +1,437 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <vtkDataSetAttributes.h>
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+
+namespace
+{
+/**
+ * @brief Bins the selected component, or the tuple magnitude for component -1, of
+ * every tuple that is not hidden over the given range
+ */
+template <typename T> class VisibleHistogramFunctor
+{
+public:
+  VisibleHistogramFunctor(const T* values, int numComps, int component, const unsigned char* ghosts, const double range[2], int numBins)
+  : m_Values(values)
+  , m_NumComps(numComps)
+  , m_Component(component)
+  , m_Ghosts(ghosts)
+  , m_Min(range[0])
+  , m_NumBins(numBins)
+  , m_Counts(numBins, 0)
+  {
+    double width = range[1] - range[0];
+    m_Scale = width > 0.0 ? numBins / width : 0.0;
+  }
+
+  void Initialize()
+  {
+    m_LocalCounts.Local().assign(m_Counts.size(), 0);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<vtkIdType>& counts = m_LocalCounts.Local();
+
+    for(vtkIdType tuple = begin; tuple < end; tuple++)
+    {
+      if(m_Ghosts && (m_Ghosts[tuple] & vtkDataSetAttributes::HIDDENCELL))
+      {
+        continue;
+      }
+
+      const T* tupleValues = m_Values + tuple * m_NumComps;
+      double value = 0.0;
+      if(m_Component < 0)
+      {
+        for(int comp = 0; comp < m_NumComps; comp++)
+        {
+          double compValue = static_cast<double>(tupleValues[comp]);
+          value += compValue * compValue;
+        }
+        value = std::sqrt(value);
+      }
+      else
+      {
+        value = static_cast<double>(tupleValues[m_Component]);
+      }
+
+      if(std::isnan(value))
+      {
+        continue;
+      }
+
+      int bin = static_cast<int>((value - m_Min) * m_Scale);
+      counts[std::min(std::max(bin, 0), m_NumBins - 1)]++;
+    }
+  }
+
+  void Reduce()
+  {
+    for(auto iter = m_LocalCounts.begin(); iter != m_LocalCounts.end(); ++iter)
+    {
+      for(size_t i = 0; i < m_Counts.size(); i++)
+      {
+        m_Counts[i] += (*iter)[i];
+      }
+    }
+  }
+
+  const std::vector<vtkIdType>& getCounts() const
+  {
+    return m_Counts;
+  }
+
+private:
+  const T* m_Values;
+  int m_NumComps;
+  int m_Component;
+  const unsigned char* m_Ghosts;
+  double m_Min;
+  double m_Scale;
+  int m_NumBins;
+  std::vector<vtkIdType> m_Counts;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> m_LocalCounts;
+};
+
+/**
+ * @brief Computes the histogram of the visible tuples of a typed array
+ * @param values
+ * @param numTuples
+ * @param numComps
+ * @param component
+ * @param ghosts
+ * @param range
+ * @param counts
+ */
+template <typename T>
+void CountVisibleValues(const T* values, vtkIdType numTuples, int numComps, int component, const unsigned char* ghosts, const double range[2], std::vector<vtkIdType>& counts)
+{
+  VisibleHistogramFunctor<T> histogramFunctor(values, numComps, component, ghosts, range, static_cast<int>(counts.size()));
+  vtkSMPTools::For(0, numTuples, histogramFunctor);
+  counts = histogramFunctor.getCounts();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram::VSHistogram(const VSArrayStatistics& statistics, int component, int numBins, BinningMode mode)
+: m_BinningMode(mode)
+{
+  statistics.getRange(component, m_Range);
+  buildBins(statistics.getHistogram(component), numBins);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram::VSHistogram(vtkDataArray* array, const unsigned char* ghosts, const VSArrayStatistics& statistics, int component, int numBins, BinningMode mode)
+: m_BinningMode(mode)
+{
+  statistics.getRange(component, m_Range);
+
+  std::vector<vtkIdType> fineCounts(statistics.getHistogram(component).size(), 0);
+  int numComps = array ? array->GetNumberOfComponents() : 0;
+  if(fineCounts.empty() || component >= numComps)
+  {
+    return;
+  }
+
+  switch(array->GetDataType())
+  {
+    vtkTemplateMacro(CountVisibleValues(static_cast<const VTK_TT*>(array->GetVoidPointer(0)), array->GetNumberOfTuples(), numComps, component, ghosts, m_Range, fineCounts));
+  default:
+    break;
+  }
+
+  buildBins(fineCounts, numBins);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogram::buildBins(const std::vector<vtkIdType>& fineCounts, int numBins)
+{
+  m_TotalCount = std::accumulate(fineCounts.begin(), fineCounts.end(), vtkIdType(0));
+  if(0 == m_TotalCount)
+  {
+    return;
+  }
+
+  numBins = std::min(std::max(numBins, 1), static_cast<int>(fineCounts.size()));
+  switch(m_BinningMode)
+  {
+  case BinningMode::Adaptive:
+    buildAdaptiveBins(fineCounts, numBins);
+    break;
+  case BinningMode::Fixed:
+  default:
+    buildFixedBins(fineCounts, numBins);
+    break;
+  }
+
+  m_MaxCount = *std::max_element(m_Counts.begin(), m_Counts.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogram::buildFixedBins(const std::vector<vtkIdType>& fineCounts, int numBins)
+{
+  size_t numFineBins = fineCounts.size();
+  double binWidth = (m_Range[1] - m_Range[0]) / numBins;
+
+  m_BinEdges.resize(numBins + 1);
+  for(int i = 0; i <= numBins; i++)
+  {
+    m_BinEdges[i] = m_Range[0] + i * binWidth;
+  }
+  m_BinEdges[numBins] = m_Range[1];
+
+  // Split each fine bin between the bins its value range overlaps.  Values are
+  // assumed to be evenly distributed within each fine bin.
+  std::vector<double> shares(numBins, 0.0);
+  double binsPerFineBin = static_cast<double>(numBins) / numFineBins;
+  for(size_t i = 0; i < numFineBins; i++)
+  {
+    double lower = i * binsPerFineBin;
+    double upper = (i + 1) * binsPerFineBin;
+    int lastBin = std::min(static_cast<int>(std::ceil(upper)) - 1, numBins - 1);
+    for(int bin = static_cast<int>(lower); bin <= lastBin; bin++)
+    {
+      double overlap = std::min(upper, bin + 1.0) - std::max(lower, static_cast<double>(bin));
+      shares[bin] += fineCounts[i] * overlap / binsPerFineBin;
+    }
+  }
+
+  // Round the running total so that the counts still add up to the total count
+  m_Counts.assign(numBins, 0);
+  double runningShare = 0.0;
+  vtkIdType runningCount = 0;
+  for(int bin = 0; bin < numBins; bin++)
+  {
+    runningShare += shares[bin];
+    vtkIdType roundedTotal = std::min(static_cast<vtkIdType>(std::llround(runningShare)), m_TotalCount);
+    m_Counts[bin] = roundedTotal - runningCount;
+    runningCount = roundedTotal;
+  }
+  m_Counts[numBins - 1] += m_TotalCount - runningCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSHistogram::buildAdaptiveBins(const std::vector<vtkIdType>& fineCounts, int numBins)
+{
+  size_t numFineBins = fineCounts.size();
+  double fineWidth = (m_Range[1] - m_Range[0]) / numFineBins;
+  double binPopulation = static_cast<double>(m_TotalCount) / numBins;
+
+  m_BinEdges.clear();
+  m_Counts.clear();
+  m_BinEdges.push_back(m_Range[0]);
+
+  // Close a bin whenever the running total passes the next population boundary.
+  // A dense fine bin can pass several boundaries at once, so fewer bins than
+  // requested may be produced.
+  vtkIdType runningTotal = 0;
+  vtkIdType binCount = 0;
+  double nextBoundary = binPopulation;
+  for(size_t i = 0; i < numFineBins; i++)
+  {
+    runningTotal += fineCounts[i];
+    binCount += fineCounts[i];
+
+    bool lastFineBin = (i + 1 == numFineBins);
+    if(!lastFineBin && runningTotal >= nextBoundary && static_cast<int>(m_Counts.size()) < numBins - 1)
+    {
+      m_BinEdges.push_back(m_Range[0] + (i + 1) * fineWidth);
+      m_Counts.push_back(binCount);
+      binCount = 0;
+      while(nextBoundary <= runningTotal)
+      {
+        nextBoundary += binPopulation;
+      }
+    }
+  }
+
+  m_BinEdges.push_back(m_Range[1]);
+  m_Counts.push_back(binCount);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSHistogram::isValid() const
+{
+  return m_TotalCount > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSHistogram::BinningMode VSHistogram::getBinningMode() const
+{
+  return m_BinningMode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSHistogram::getNumberOfBins() const
+{
+  return static_cast<int>(m_Counts.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<double>& VSHistogram::getBinEdges() const
+{
+  return m_BinEdges;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<vtkIdType>& VSHistogram::getCounts() const
+{
+  return m_Counts;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSHistogram::getMaxCount() const
+{
+  return m_MaxCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSHistogram::getTotalCount() const
+{
+  return m_TotalCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSHistogram::getMinValue() const
+{
+  return m_Range[0];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSHistogram::getMaxValue() const
+{
+  return m_Range[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSHistogram::getPercentileValue(double percent) const
+{
+  if(!isValid())
+  {
+    return m_Range[0];
+  }
+
+  percent = std::min(std::max(percent, 0.0), 100.0);
+  double target = percent / 100.0 * m_TotalCount;
+
+  // Values are assumed to be evenly distributed within each bin
+  double runningTotal = 0.0;
+  for(size_t i = 0; i < m_Counts.size(); i++)
+  {
+    if(0 == m_Counts[i])
+    {
+      continue;
+    }
+
+    if(runningTotal + m_Counts[i] >= target)
+    {
+      double fraction = (target - runningTotal) / m_Counts[i];
+      return m_BinEdges[i] + fraction * (m_BinEdges[i + 1] - m_BinEdges[i]);
+    }
+
+    runningTotal += m_Counts[i];
+  }
+
+  return m_Range[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSHistogram::getValuePercentile(double value) const
+{
+  if(!isValid() || value <= m_Range[0])
+  {
+    return 0.0;
+  }
+  if(value >= m_Range[1])
+  {
+    return 100.0;
+  }
+
+  double runningTotal = 0.0;
+  for(size_t i = 0; i < m_Counts.size(); i++)
+  {
+    double binWidth = m_BinEdges[i + 1] - m_BinEdges[i];
+    if(value < m_BinEdges[i + 1] && binWidth > 0.0)
+    {
+      runningTotal += m_Counts[i] * (value - m_BinEdges[i]) / binWidth;
+      break;
+    }
+
+    runningTotal += m_Counts[i];
+  }
+
+  return 100.0 * runningTotal / m_TotalCount;
+}
@@ -0,0 +1,187 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <vector>
+
+#include <vtkDataArray.h>
+#include <vtkType.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatisticsCache.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSHistogram VSHistogram.h SIMPLVtkLib/Visualization/VisualFilters/VSHistogram.h
+ * @brief This class describes the distribution of a single array component.  Bins
+ * are derived from the fine histogram stored in VSArrayStatistics, so building a
+ * VSHistogram never rescans the array.  Fixed histograms use bins of equal width
+ * while adaptive histograms use bins of roughly equal population.
+ */
+class SIMPLVtkLib_EXPORT VSHistogram
+{
+public:
+  enum class BinningMode : int
+  {
+    Fixed = 0,
+    Adaptive = 1
+  };
+
+  static const int DefaultNumberOfBins = 64;
+
+  VSHistogram() = default;
+
+  /**
+   * @brief Builds the histogram for the given component or the magnitude for component -1.
+   * The number of bins is limited by the resolution of the statistics.
+   * @param statistics
+   * @param component
+   * @param numBins
+   * @param mode
+   */
+  VSHistogram(const VSArrayStatistics& statistics, int component, int numBins, BinningMode mode);
+
+  /**
+   * @brief Builds the histogram of the values whose ghost value does not mark them
+   * as hidden.  Used for blanked outputs, whose arrays still contain the hidden
+   * values.  The array is rescanned using the range and resolution of the statistics.
+   * @param array
+   * @param ghosts
+   * @param statistics
+   * @param component
+   * @param numBins
+   * @param mode
+   */
+  VSHistogram(vtkDataArray* array, const unsigned char* ghosts, const VSArrayStatistics& statistics, int component, int numBins, BinningMode mode);
+
+  /**
+   * @brief Returns true if the histogram contains any values.  Returns false otherwise.
+   * @return
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the binning mode used to build the histogram
+   * @return
+   */
+  BinningMode getBinningMode() const;
+
+  /**
+   * @brief Returns the number of bins
+   * @return
+   */
+  int getNumberOfBins() const;
+
+  /**
+   * @brief Returns the bin edges.  Bin i covers the values between edges i and i + 1.
+   * @return
+   */
+  const std::vector<double>& getBinEdges() const;
+
+  /**
+   * @brief Returns the number of values in each bin
+   * @return
+   */
+  const std::vector<vtkIdType>& getCounts() const;
+
+  /**
+   * @brief Returns the largest bin count
+   * @return
+   */
+  vtkIdType getMaxCount() const;
+
+  /**
+   * @brief Returns the number of values in the histogram
+   * @return
+   */
+  vtkIdType getTotalCount() const;
+
+  /**
+   * @brief Returns the smallest value in the histogram
+   * @return
+   */
+  double getMinValue() const;
+
+  /**
+   * @brief Returns the largest value in the histogram
+   * @return
+   */
+  double getMaxValue() const;
+
+  /**
+   * @brief Returns the value below which the given percent of values fall
+   * @param percent
+   * @return
+   */
+  double getPercentileValue(double percent) const;
+
+  /**
+   * @brief Returns the percent of values that fall below the given value
+   * @param value
+   * @return
+   */
+  double getValuePercentile(double value) const;
+
+protected:
+  /**
+   * @brief Builds the bins from the fine histogram using the current range
+   * @param fineCounts
+   * @param numBins
+   */
+  void buildBins(const std::vector<vtkIdType>& fineCounts, int numBins);
+
+  /**
+   * @brief Merges the fine bins into bins of equal width.  Fine bins that straddle a
+   * bin edge are split by how much of their value range falls in each bin.
+   * @param fineCounts
+   * @param numBins
+   */
+  void buildFixedBins(const std::vector<vtkIdType>& fineCounts, int numBins);
+
+  /**
+   * @brief Merges the fine bins into bins of roughly equal population
+   * @param fineCounts
+   * @param numBins
+   */
+  void buildAdaptiveBins(const std::vector<vtkIdType>& fineCounts, int numBins);
+
+private:
+  BinningMode m_BinningMode = BinningMode::Fixed;
+  double m_Range[2] = {0.0, 0.0};
+  std::vector<double> m_BinEdges;
+  std::vector<vtkIdType> m_Counts;
+  vtkIdType m_MaxCount = 0;
+  vtkIdType m_TotalCount = 0;
+};
@@ -0,0 +1,252 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageBlankingThreshold.h"
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
+#include <vtkUniformGrid.h>
+#include <vtkUnsignedCharArray.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+vtkStandardNewMacro(VSImageBlankingThreshold);
+
+namespace
+{
+/**
+ * @brief Writes a vtkGhostType value for each cell marking values outside of
+ * [lower, upper] as hidden.  The tests are branchless so that the single
+ * component loop vectorizes, and each cell is written by exactly one thread.
+ */
+template <typename T> class BlankingFunctor
+{
+public:
+  BlankingFunctor(const T* values, int numComps, int component, double lower, double upper, const unsigned char* inputGhosts, unsigned char* ghosts)
+  : m_Values(values)
+  , m_NumComps(numComps)
+  , m_Component(component)
+  , m_Lower(lower)
+  , m_Upper(upper)
+  , m_InputGhosts(inputGhosts)
+  , m_Ghosts(ghosts)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    const unsigned char hidden = vtkDataSetAttributes::HIDDENCELL;
+    if(1 == m_NumComps)
+    {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        double value = static_cast<double>(m_Values[i]);
+        m_Ghosts[i] = static_cast<unsigned char>((value < m_Lower) | (value > m_Upper)) * hidden;
+      }
+    }
+    else
+    {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        double value = static_cast<double>(m_Values[i * m_NumComps + m_Component]);
+        m_Ghosts[i] = static_cast<unsigned char>((value < m_Lower) | (value > m_Upper)) * hidden;
+      }
+    }
+
+    // Keep any blanking or ghost levels that were already on the input
+    if(m_InputGhosts)
+    {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        m_Ghosts[i] |= m_InputGhosts[i];
+      }
+    }
+  }
+
+private:
+  const T* m_Values;
+  int m_NumComps;
+  int m_Component;
+  double m_Lower;
+  double m_Upper;
+  const unsigned char* m_InputGhosts;
+  unsigned char* m_Ghosts;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageBlankingThreshold::VSImageBlankingThreshold()
+{
+  // Process the active cell scalars unless an array is selected
+  SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, vtkDataSetAttributes::SCALARS);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageBlankingThreshold::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "LowerThreshold: " << LowerThreshold << "\n";
+  os << indent << "UpperThreshold: " << UpperThreshold << "\n";
+  os << indent << "SelectedComponent: " << SelectedComponent << "\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageBlankingThreshold::ThresholdBetween(double lower, double upper)
+{
+  if(LowerThreshold != lower || UpperThreshold != upper)
+  {
+    LowerThreshold = lower;
+    UpperThreshold = upper;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageBlankingThreshold::ThresholdByUpper(double lower)
+{
+  ThresholdBetween(lower, VTK_DOUBLE_MAX);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageBlankingThreshold::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageBlankingThreshold::FillOutputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkUniformGrid");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageBlankingThreshold::RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if(nullptr == vtkUniformGrid::GetData(outInfo))
+  {
+    VTK_NEW(vtkUniformGrid, output);
+    outInfo->Set(vtkDataObject::DATA_OBJECT(), output);
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageBlankingThreshold::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkUniformGrid* output = vtkUniformGrid::GetData(outputVector);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  // The input is only passed through once every cell has been blanked.  Failures
+  // leave an empty output instead of showing the unthresholded input.
+  output->Initialize();
+
+  vtkDataArray* array = GetInputArrayToProcess(0, inputVector);
+  if(nullptr == array)
+  {
+    vtkErrorMacro(<< "No array to threshold");
+    return 0;
+  }
+
+  vtkIdType numCells = input->GetNumberOfCells();
+  if(array->GetNumberOfTuples() != numCells)
+  {
+    vtkErrorMacro(<< "Only cell arrays can be thresholded");
+    return 0;
+  }
+
+  if(GetAbortExecute())
+  {
+    return 0;
+  }
+
+  int numComps = array->GetNumberOfComponents();
+  int component = (SelectedComponent >= 0 && SelectedComponent < numComps) ? SelectedComponent : 0;
+
+  // Any existing ghost array is shared with the input and must not be modified
+  const unsigned char* inputGhosts = nullptr;
+  vtkUnsignedCharArray* inputGhostArray = vtkUnsignedCharArray::SafeDownCast(input->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  if(inputGhostArray && inputGhostArray->GetNumberOfTuples() == numCells)
+  {
+    inputGhosts = inputGhostArray->GetPointer(0);
+  }
+
+  VTK_NEW(vtkUnsignedCharArray, ghosts);
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfTuples(numCells);
+
+  switch(array->GetDataType())
+  {
+    vtkTemplateMacro(BlankingFunctor<VTK_TT> functor(static_cast<const VTK_TT*>(array->GetVoidPointer(0)), numComps, component, LowerThreshold, UpperThreshold, inputGhosts, ghosts->GetPointer(0));
+                     vtkSMPTools::For(0, numCells, functor));
+  default:
+    vtkErrorMacro(<< "Unsupported array type: " << array->GetDataTypeAsString());
+    return 0;
+  }
+
+  output->ShallowCopy(input);
+  output->GetCellData()->AddArray(ghosts);
+  UpdateProgress(1.0);
+  return 1;
+}
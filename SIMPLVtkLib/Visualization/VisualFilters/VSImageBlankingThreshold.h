@@ -0,0 +1,126 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkDataSetAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImageBlankingThreshold VSImageBlankingThreshold.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSImageBlankingThreshold.h
+ * @brief This vtkAlgorithm thresholds a vtkImageData by blanking the cells whose
+ * selected array component falls outside the given range instead of extracting
+ * the remaining cells into a vtkUnstructuredGrid.  The output is a vtkUniformGrid
+ * sharing the input's arrays with an additional vtkGhostType cell array marking
+ * the hidden cells, so the result costs one byte per cell.  The range test runs
+ * through vtkSMPTools over the raw array memory.
+ */
+class SIMPLVtkLib_EXPORT VSImageBlankingThreshold : public vtkDataSetAlgorithm
+{
+public:
+  static VSImageBlankingThreshold* New();
+  vtkTypeMacro(VSImageBlankingThreshold, vtkDataSetAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Keeps cells with values between lower and upper, inclusive
+   * @param lower
+   * @param upper
+   */
+  void ThresholdBetween(double lower, double upper);
+
+  /**
+   * @brief Keeps cells with values greater than or equal to lower
+   * @param lower
+   */
+  void ThresholdByUpper(double lower);
+
+  vtkGetMacro(LowerThreshold, double)
+  vtkGetMacro(UpperThreshold, double)
+
+  /**
+   * @brief Sets the array component used for the range test
+   */
+  vtkSetMacro(SelectedComponent, int)
+  vtkGetMacro(SelectedComponent, int)
+
+protected:
+  VSImageBlankingThreshold();
+  ~VSImageBlankingThreshold() override = default;
+
+  /**
+   * @brief Creates a vtkUniformGrid output so that the blanking is honored downstream
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Shallow copies the input and adds the blanking array
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Requires vtkImageData input
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Declares vtkUniformGrid output
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+
+  double LowerThreshold = 0.0;
+  double UpperThreshold = 0.0;
+  int SelectedComponent = 0;
+
+private:
+  VSImageBlankingThreshold(const VSImageBlankingThreshold&) = delete;
+  void operator=(const VSImageBlankingThreshold&) = delete;
+};
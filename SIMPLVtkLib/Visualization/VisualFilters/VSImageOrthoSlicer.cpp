@@ -0,0 +1,377 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSImageOrthoSlicer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <vtkAbstractArray.h>
+#include <vtkCellData.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkUniformGrid.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+vtkStandardNewMacro(VSImageOrthoSlicer);
+
+namespace
+{
+/**
+ * @brief Appends the address and modification time of each array in the attributes
+ * @param attributes
+ * @param stamps
+ */
+template <typename StampType>
+void appendArrayStamps(vtkDataSetAttributes* attributes, std::vector<StampType>& stamps)
+{
+  for(int i = 0; i < attributes->GetNumberOfArrays(); i++)
+  {
+    vtkAbstractArray* array = attributes->GetAbstractArray(i);
+    stamps.emplace_back(array, array ? array->GetMTime() : 0);
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageOrthoSlicer::VSImageOrthoSlicer()
+: Extractor(vtkSmartPointer<VSImageSliceExtractor>::New())
+{
+  SlicePositions[0] = SlicePositions[1] = SlicePositions[2] = 0.0;
+  SliceVisibility[0] = SliceVisibility[1] = SliceVisibility[2] = 1;
+  SetNumberOfOutputPorts(4);
+  std::fill(CachedExtent, CachedExtent + 6, 0);
+  std::fill(CachedOrigin, CachedOrigin + 3, 0.0);
+  std::fill(CachedSpacing, CachedSpacing + 3, 0.0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os, indent);
+  std::lock_guard<std::mutex> lock(SliceMutex);
+  os << indent << "SlicePositions: " << SlicePositions[0] << ", " << SlicePositions[1] << ", " << SlicePositions[2] << "\n";
+  os << indent << "SliceVisibility: " << SliceVisibility[0] << ", " << SliceVisibility[1] << ", " << SliceVisibility[2] << "\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::SetSlicePositions(double x, double y, double z)
+{
+  {
+    std::lock_guard<std::mutex> lock(SliceMutex);
+    if(SlicePositions[0] == x && SlicePositions[1] == y && SlicePositions[2] == z)
+    {
+      return;
+    }
+    SlicePositions[0] = x;
+    SlicePositions[1] = y;
+    SlicePositions[2] = z;
+  }
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::GetSlicePositions(double positions[3])
+{
+  std::lock_guard<std::mutex> lock(SliceMutex);
+  std::copy(SlicePositions, SlicePositions + 3, positions);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::SetSliceVisibility(int x, int y, int z)
+{
+  {
+    std::lock_guard<std::mutex> lock(SliceMutex);
+    if(SliceVisibility[0] == x && SliceVisibility[1] == y && SliceVisibility[2] == z)
+    {
+      return;
+    }
+    SliceVisibility[0] = x;
+    SliceVisibility[1] = y;
+    SliceVisibility[2] = z;
+  }
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::GetSliceVisibility(int visibility[3])
+{
+  std::lock_guard<std::mutex> lock(SliceMutex);
+  std::copy(SliceVisibility, SliceVisibility + 3, visibility);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::GetPlanePort(int axis)
+{
+  return axis + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::GetPrimaryAxis() const
+{
+  return PrimaryAxis;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::ClearCache()
+{
+  for(PlaneCache& plane : Planes)
+  {
+    plane.Layer = -1;
+    plane.Slice = nullptr;
+  }
+  CachedArrays.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::FillOutputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkUniformGrid");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  for(int port = 0; port < GetNumberOfOutputPorts(); port++)
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(port);
+    if(nullptr == vtkUniformGrid::GetData(outInfo))
+    {
+      VTK_NEW(vtkUniformGrid, output);
+      outInfo->Set(vtkDataObject::DATA_OBJECT(), output);
+    }
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  if(nullptr == input)
+  {
+    return 0;
+  }
+
+  if(false == IsCachedInput(input))
+  {
+    ClearCache();
+    CacheInput(input);
+  }
+
+  double slicePositions[3];
+  int sliceVisibility[3];
+  GetSlicePositions(slicePositions);
+  GetSliceVisibility(sliceVisibility);
+
+  for(int axis = 0; axis < 3; axis++)
+  {
+    vtkUniformGrid* output = vtkUniformGrid::GetData(outputVector, GetPlanePort(axis));
+    if(nullptr == output)
+    {
+      return 0;
+    }
+
+    output->Initialize();
+    if(0 == sliceVisibility[axis])
+    {
+      continue;
+    }
+    if(GetAbortExecute())
+    {
+      return 0;
+    }
+
+    // Only planes that moved into another layer of cells are extracted again.  The
+    // other outputs share the arrays of the cached planes.
+    PlaneCache& plane = Planes[axis];
+    int layer = GetSliceLayer(input, axis, slicePositions[axis]);
+    if(nullptr == plane.Slice || plane.Layer != layer)
+    {
+      plane.Slice = ExtractPlane(input, axis, layer);
+      plane.Layer = layer;
+    }
+
+    output->ShallowCopy(plane.Slice);
+    UpdateProgress((axis + 1) / 3.0);
+  }
+
+  vtkUniformGrid* primaryOutput = vtkUniformGrid::GetData(outputVector, 0);
+  if(nullptr == primaryOutput)
+  {
+    return 0;
+  }
+  primaryOutput->Initialize();
+  PrimaryAxis = -1;
+  for(int axis = 0; axis < 3 && PrimaryAxis < 0; axis++)
+  {
+    if(sliceVisibility[axis])
+    {
+      PrimaryAxis = axis;
+      primaryOutput->ShallowCopy(vtkUniformGrid::GetData(outputVector, GetPlanePort(axis)));
+    }
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageOrthoSlicer::GetSliceLayer(vtkImageData* input, int axis, double position) const
+{
+  int extent[6];
+  input->GetExtent(extent);
+  int numLayers = std::max(extent[2 * axis + 1] - extent[2 * axis], 1);
+
+  double spacing = input->GetSpacing()[axis];
+  double index = spacing != 0.0 ? (position - input->GetOrigin()[axis]) / spacing : 0.0;
+  int layer = static_cast<int>(std::floor(index)) - extent[2 * axis];
+  return std::min(std::max(layer, 0), numLayers - 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkSmartPointer<vtkUniformGrid> VSImageOrthoSlicer::ExtractPlane(vtkImageData* input, int axis, int layer)
+{
+  int extent[6];
+  input->GetExtent(extent);
+
+  // Slice through the center of the layer so that every position within it produces the same plane
+  double origin[3];
+  input->GetCenter(origin);
+  origin[axis] = input->GetOrigin()[axis] + (extent[2 * axis] + layer + 0.5) * input->GetSpacing()[axis];
+  double normal[3] = {0.0, 0.0, 0.0};
+  normal[axis] = 1.0;
+
+  Extractor->SetInputData(input);
+  Extractor->SetOrigin(origin);
+  Extractor->SetNormal(normal);
+  Extractor->Update();
+
+  VTK_NEW(vtkUniformGrid, slice);
+  slice->ShallowCopy(Extractor->GetOutput());
+
+  // Release the extractor's references so the cache only holds the slices
+  Extractor->SetInputData(nullptr);
+  Extractor->GetOutput()->Initialize();
+  return slice;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageOrthoSlicer::IsCachedInput(vtkImageData* input) const
+{
+  int extent[6];
+  input->GetExtent(extent);
+  if(false == std::equal(extent, extent + 6, CachedExtent) || false == std::equal(input->GetOrigin(), input->GetOrigin() + 3, CachedOrigin) ||
+     false == std::equal(input->GetSpacing(), input->GetSpacing() + 3, CachedSpacing))
+  {
+    return false;
+  }
+
+  // Applies hand over shallow copies of the parent output, so arrays are compared instead of the input itself
+  std::vector<ArrayStamp> arrays;
+  appendArrayStamps(input->GetCellData(), arrays);
+  appendArrayStamps(input->GetPointData(), arrays);
+  if(arrays.size() != CachedArrays.size())
+  {
+    return false;
+  }
+
+  for(size_t i = 0; i < arrays.size(); i++)
+  {
+    if(nullptr == CachedArrays[i].first.GetPointer() || arrays[i].first.GetPointer() != CachedArrays[i].first.GetPointer() || arrays[i].second != CachedArrays[i].second)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageOrthoSlicer::CacheInput(vtkImageData* input)
+{
+  input->GetExtent(CachedExtent);
+  input->GetOrigin(CachedOrigin);
+  input->GetSpacing(CachedSpacing);
+
+  CachedArrays.clear();
+  appendArrayStamps(input->GetCellData(), CachedArrays);
+  appendArrayStamps(input->GetPointData(), CachedArrays);
+}
@@ -0,0 +1,211 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <vtkAbstractArray.h>
+#include <vtkDataSetAlgorithm.h>
+#include <vtkSmartPointer.h>
+#include <vtkWeakPointer.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSImageSliceExtractor.h"
+
+class vtkImageData;
+class vtkUniformGrid;
+
+/**
+ * @class VSImageOrthoSlicer VSImageOrthoSlicer.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSImageOrthoSlicer.h
+ * @brief This vtkAlgorithm slices a vtkImageData along the three planes normal to
+ * its axes.  Each plane is extracted with a VSImageSliceExtractor into its own flat
+ * output so that it can be drawn as a textured quad.  Output port 0 holds the first
+ * visible plane and ports 1 through 3 hold the planes normal to the X, Y, and Z axes.
+ * Planes are cached by the layer of cells they pass through, so moving one plane only
+ * extracts that plane again and the other outputs keep sharing their arrays.  The cache
+ * is cleared when the input geometry or any of its arrays change.  Planes normal to the
+ * Z axis reference the input arrays, so callers must keep the input alive.
+ */
+class SIMPLVtkLib_EXPORT VSImageOrthoSlicer : public vtkDataSetAlgorithm
+{
+public:
+  static VSImageOrthoSlicer* New();
+  vtkTypeMacro(VSImageOrthoSlicer, vtkDataSetAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Returns the output port holding the plane normal to the given axis
+   * @param axis
+   * @return
+   */
+  static int GetPlanePort(int axis);
+
+  /**
+   * @brief Sets the positions of the planes normal to the X, Y, and Z axes.  The slice
+   * parameters can be set while an aborted update is still returning; each update
+   * reads them once when it starts.
+   * @param x
+   * @param y
+   * @param z
+   */
+  void SetSlicePositions(double x, double y, double z);
+
+  /**
+   * @brief Copies the positions of the planes normal to the X, Y, and Z axes
+   * @param positions
+   */
+  void GetSlicePositions(double positions[3]);
+
+  /**
+   * @brief Sets whether or not the planes normal to the X, Y, and Z axes are extracted
+   * @param x
+   * @param y
+   * @param z
+   */
+  void SetSliceVisibility(int x, int y, int z);
+
+  /**
+   * @brief Copies whether or not the planes normal to the X, Y, and Z axes are extracted
+   * @param visibility
+   */
+  void GetSliceVisibility(int visibility[3]);
+
+  /**
+   * @brief Returns the axis of the plane copied to output port 0 by the last update or -1
+   * if no plane was visible
+   * @return
+   */
+  int GetPrimaryAxis() const;
+
+  /**
+   * @brief Releases the cached planes
+   */
+  void ClearCache();
+
+protected:
+  VSImageOrthoSlicer();
+  ~VSImageOrthoSlicer() override = default;
+
+  /**
+   * @brief Creates vtkUniformGrid outputs like VSImageSliceExtractor
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Extracts the visible planes whose layer changed and copies the cached planes to the outputs
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Requires vtkImageData input
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Declares vtkUniformGrid outputs
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Returns the layer of cells the plane normal to the given axis passes through
+   * @param input
+   * @param axis
+   * @param position
+   * @return
+   */
+  int GetSliceLayer(vtkImageData* input, int axis, double position) const;
+
+  /**
+   * @brief Extracts the given layer normal to the given axis
+   * @param input
+   * @param axis
+   * @param layer
+   * @return
+   */
+  vtkSmartPointer<vtkUniformGrid> ExtractPlane(vtkImageData* input, int axis, int layer);
+
+  /**
+   * @brief Returns true if the input matches the geometry and arrays the cache was built from
+   * @param input
+   * @return
+   */
+  bool IsCachedInput(vtkImageData* input) const;
+
+  /**
+   * @brief Stores the geometry and arrays of the input the cache is built from
+   * @param input
+   */
+  void CacheInput(vtkImageData* input);
+
+  double SlicePositions[3];
+  int SliceVisibility[3];
+  std::mutex SliceMutex;
+
+private:
+  struct PlaneCache
+  {
+    int Layer = -1;
+    vtkSmartPointer<vtkUniformGrid> Slice;
+  };
+  using ArrayStamp = std::pair<vtkWeakPointer<vtkAbstractArray>, vtkMTimeType>;
+
+  vtkSmartPointer<VSImageSliceExtractor> Extractor;
+  PlaneCache Planes[3];
+  int PrimaryAxis = -1;
+  int CachedExtent[6];
+  double CachedOrigin[3];
+  double CachedSpacing[3];
+  std::vector<ArrayStamp> CachedArrays;
+
+  VSImageOrthoSlicer(const VSImageOrthoSlicer&) = delete;
+  void operator=(const VSImageOrthoSlicer&) = delete;
+};
@@ -0,0 +1,639 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSImageSliceExtractor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <vtkAbstractArray.h>
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkFieldData.h>
+#include <vtkIdList.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkMath.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkSMPTools.h>
+#include <vtkUniformGrid.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkVersionMacros.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+vtkStandardNewMacro(VSImageSliceExtractor);
+
+namespace
+{
+const double AlignmentTolerance = 1.0e-6;
+
+/**
+ * @brief Returns the number of cells along each axis of an image with the given point dimensions
+ * @param pointDims
+ * @param cellDims
+ */
+void getCellDimensions(const int pointDims[3], int cellDims[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    cellDims[i] = std::max(pointDims[i] - 1, 1);
+  }
+}
+
+/**
+ * @brief Fills the input tuple IDs of a single layer in output order.  The
+ * in-plane axes keep their input order, so the lower axis varies fastest.
+ */
+class LayerIdsFunctor
+{
+public:
+  LayerIdsFunctor(const int dims[3], int axis, int layer, vtkIdType* ids)
+  : m_Axis(axis)
+  , m_Layer(layer)
+  , m_Ids(ids)
+  {
+    std::copy(dims, dims + 3, m_Dims);
+    int inPlane = 0;
+    for(int i = 0; i < 3; i++)
+    {
+      if(i != axis)
+      {
+        m_InPlaneAxes[inPlane++] = i;
+      }
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    int firstDim = m_Dims[m_InPlaneAxes[0]];
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      int index[3];
+      index[m_Axis] = m_Layer;
+      index[m_InPlaneAxes[0]] = static_cast<int>(i % firstDim);
+      index[m_InPlaneAxes[1]] = static_cast<int>(i / firstDim);
+      m_Ids[i] = index[0] + static_cast<vtkIdType>(m_Dims[0]) * (index[1] + static_cast<vtkIdType>(m_Dims[1]) * index[2]);
+    }
+  }
+
+private:
+  int m_Dims[3];
+  int m_Axis;
+  int m_InPlaneAxes[2];
+  int m_Layer;
+  vtkIdType* m_Ids;
+};
+
+/**
+ * @brief Copies the given tuples of every input array into the output attributes,
+ * keeping the active attributes.
+ * @param input
+ * @param output
+ * @param ids
+ */
+void copyTuples(vtkDataSetAttributes* input, vtkDataSetAttributes* output, vtkIdList* ids)
+{
+  for(int i = 0; i < input->GetNumberOfArrays(); i++)
+  {
+    vtkAbstractArray* inputArray = input->GetAbstractArray(i);
+    VTK_PTR(vtkAbstractArray) outputArray = VTK_PTR(vtkAbstractArray)::Take(vtkAbstractArray::CreateArray(inputArray->GetDataType()));
+    outputArray->SetName(inputArray->GetName());
+    outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
+    outputArray->SetNumberOfTuples(ids->GetNumberOfIds());
+    inputArray->GetTuples(ids, outputArray);
+
+    int index = output->AddArray(outputArray);
+    int attributeType = input->IsArrayAnAttribute(i);
+    if(attributeType >= 0)
+    {
+      output->SetActiveAttribute(index, attributeType);
+    }
+  }
+}
+
+/**
+ * @brief Adds arrays to the output attributes that reference a contiguous range of
+ * tuples in the input arrays.  The referenced memory is owned by the input arrays,
+ * which the caller keeps alive for as long as the output.  Arrays that cannot be
+ * referenced are copied instead.
+ * @param input
+ * @param output
+ * @param offset
+ * @param count
+ */
+void shareTuples(vtkDataSetAttributes* input, vtkDataSetAttributes* output, vtkIdType offset, vtkIdType count)
+{
+  VTK_NEW(vtkIdList, ids);
+  for(int i = 0; i < input->GetNumberOfArrays(); i++)
+  {
+    vtkAbstractArray* inputArray = input->GetAbstractArray(i);
+    vtkDataArray* dataArray = vtkDataArray::SafeDownCast(inputArray);
+    bool canShare = dataArray && dataArray->GetDataType() != VTK_BIT;
+
+    VTK_PTR(vtkAbstractArray) outputArray;
+    if(canShare)
+    {
+      int numComps = dataArray->GetNumberOfComponents();
+      char* values = static_cast<char*>(dataArray->GetVoidPointer(0)) + offset * numComps * dataArray->GetDataTypeSize();
+
+      VTK_PTR(vtkDataArray) sharedArray = VTK_PTR(vtkDataArray)::Take(vtkDataArray::CreateDataArray(dataArray->GetDataType()));
+      sharedArray->SetName(dataArray->GetName());
+      sharedArray->SetNumberOfComponents(numComps);
+      sharedArray->SetVoidArray(values, count * numComps, 1);
+      outputArray = sharedArray;
+    }
+    else
+    {
+      ids->SetNumberOfIds(count);
+      for(vtkIdType id = 0; id < count; id++)
+      {
+        ids->SetId(id, offset + id);
+      }
+
+      outputArray = VTK_PTR(vtkAbstractArray)::Take(vtkAbstractArray::CreateArray(inputArray->GetDataType()));
+      outputArray->SetName(inputArray->GetName());
+      outputArray->SetNumberOfComponents(inputArray->GetNumberOfComponents());
+      outputArray->SetNumberOfTuples(count);
+      inputArray->GetTuples(ids, outputArray);
+    }
+
+    int index = output->AddArray(outputArray);
+    int attributeType = input->IsArrayAnAttribute(i);
+    if(attributeType >= 0)
+    {
+      output->SetActiveAttribute(index, attributeType);
+    }
+  }
+}
+
+/**
+ * @brief Extracts a single layer of tuples, referencing the input memory when the
+ * layer is contiguous.
+ * @param input
+ * @param output
+ * @param dims
+ * @param axis
+ * @param layer
+ */
+void extractLayer(vtkDataSetAttributes* input, vtkDataSetAttributes* output, const int dims[3], int axis, int layer)
+{
+  vtkIdType layerSize = 1;
+  vtkIdType layerStride = 1;
+  bool contiguous = true;
+  for(int i = 0; i < 3; i++)
+  {
+    if(i == axis)
+    {
+      continue;
+    }
+
+    layerSize *= dims[i];
+    if(i < axis)
+    {
+      layerStride *= dims[i];
+    }
+    else if(dims[i] > 1)
+    {
+      contiguous = false;
+    }
+  }
+
+  if(contiguous)
+  {
+    shareTuples(input, output, layer * layerStride, layerSize);
+    return;
+  }
+
+  VTK_NEW(vtkIdList, ids);
+  ids->SetNumberOfIds(layerSize);
+  LayerIdsFunctor functor(dims, axis, layer, ids->GetPointer(0));
+  vtkSMPTools::For(0, layerSize, functor);
+  copyTuples(input, output, ids);
+}
+
+#if VTK_MAJOR_VERSION >= 9
+/**
+ * @brief Finds the nearest input cell and point for each cell and point of an
+ * oblique slice.  Cells whose centers fall outside the input are hidden.
+ */
+class ObliqueSampleFunctor
+{
+public:
+  ObliqueSampleFunctor(vtkImageData* input, const double origin[3], const double u[3], const double v[3], double spacing, int cellsU, vtkIdType* cellIds, vtkIdType* pointIds,
+                       unsigned char* ghosts)
+  : m_Spacing(spacing)
+  , m_CellsU(cellsU)
+  , m_CellIds(cellIds)
+  , m_PointIds(pointIds)
+  , m_Ghosts(ghosts)
+  {
+    int extent[6];
+    input->GetExtent(extent);
+    input->GetOrigin(m_InputOrigin);
+    input->GetSpacing(m_InputSpacing);
+    for(int i = 0; i < 3; i++)
+    {
+      m_PointDims[i] = extent[2 * i + 1] - extent[2 * i] + 1;
+      m_ExtentMin[i] = extent[2 * i];
+      m_Origin[i] = origin[i];
+      m_U[i] = u[i];
+      m_V[i] = v[i];
+    }
+    getCellDimensions(m_PointDims, m_CellDims);
+  }
+
+  /**
+   * @brief Processes the rows of points in [begin, end).  Cells are processed with the
+   * row of points at their lower edge.
+   */
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    int pointsU = m_CellsU + 1;
+    for(vtkIdType row = begin; row < end; row++)
+    {
+      for(int col = 0; col < pointsU; col++)
+      {
+        double index[3];
+        toIndex(col, static_cast<double>(row), index);
+        vtkIdType pointId = 0;
+        for(int i = 2; i >= 0; i--)
+        {
+          int pointIndex = std::min(std::max(static_cast<int>(std::lround(index[i])), 0), m_PointDims[i] - 1);
+          pointId = pointId * m_PointDims[i] + pointIndex;
+        }
+        m_PointIds[row * pointsU + col] = pointId;
+      }
+
+      if(nullptr == m_CellIds)
+      {
+        continue;
+      }
+
+      for(int col = 0; col < m_CellsU; col++)
+      {
+        double index[3];
+        toIndex(col + 0.5, row + 0.5, index);
+        vtkIdType cellId = 0;
+        bool inside = true;
+        for(int i = 2; i >= 0; i--)
+        {
+          int cellIndex = static_cast<int>(std::floor(index[i]));
+          if(1 == m_PointDims[i])
+          {
+            cellIndex = 0;
+          }
+          else if(cellIndex < 0 || cellIndex >= m_CellDims[i])
+          {
+            inside = false;
+            cellIndex = 0;
+          }
+          cellId = cellId * m_CellDims[i] + cellIndex;
+        }
+        m_CellIds[row * m_CellsU + col] = cellId;
+        m_Ghosts[row * m_CellsU + col] = inside ? 0 : vtkDataSetAttributes::HIDDENCELL;
+      }
+    }
+  }
+
+private:
+  void toIndex(double col, double row, double index[3]) const
+  {
+    for(int i = 0; i < 3; i++)
+    {
+      double position = m_Origin[i] + (col * m_U[i] + row * m_V[i]) * m_Spacing;
+      index[i] = (position - m_InputOrigin[i]) / m_InputSpacing[i] - m_ExtentMin[i];
+    }
+  }
+
+  double m_Origin[3];
+  double m_U[3];
+  double m_V[3];
+  double m_Spacing;
+  int m_CellsU;
+  double m_InputOrigin[3];
+  double m_InputSpacing[3];
+  int m_ExtentMin[3];
+  int m_PointDims[3];
+  int m_CellDims[3];
+  vtkIdType* m_CellIds;
+  vtkIdType* m_PointIds;
+  unsigned char* m_Ghosts;
+};
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSliceExtractor::VSImageSliceExtractor()
+{
+  Origin[0] = Origin[1] = Origin[2] = 0.0;
+  Normal[0] = Normal[1] = 0.0;
+  Normal[2] = 1.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSliceExtractor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Origin: " << Origin[0] << ", " << Origin[1] << ", " << Origin[2] << "\n";
+  os << indent << "Normal: " << Normal[0] << ", " << Normal[1] << ", " << Normal[2] << "\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSliceExtractor::GetAlignedAxis(const double normal[3])
+{
+  double length = vtkMath::Norm(normal);
+  if(length <= 0.0)
+  {
+    return -1;
+  }
+
+  for(int i = 0; i < 3; i++)
+  {
+    if(std::abs(normal[i]) / length >= 1.0 - AlignmentTolerance)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageSliceExtractor::SupportsNormal(const double normal[3])
+{
+  if(GetAlignedAxis(normal) >= 0)
+  {
+    return true;
+  }
+
+  // Oblique slices are placed by the image direction matrix
+#if VTK_MAJOR_VERSION >= 9
+  return vtkMath::Norm(normal) > 0.0;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSliceExtractor::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSliceExtractor::FillOutputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkUniformGrid");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSliceExtractor::RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if(nullptr == vtkUniformGrid::GetData(outInfo))
+  {
+    VTK_NEW(vtkUniformGrid, output);
+    outInfo->Set(vtkDataObject::DATA_OBJECT(), output);
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSliceExtractor::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkUniformGrid* output = vtkUniformGrid::GetData(outputVector);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  output->Initialize();
+  output->GetFieldData()->ShallowCopy(input->GetFieldData());
+  if(input->GetNumberOfPoints() == 0)
+  {
+    return 1;
+  }
+
+  int axis = GetAlignedAxis(Normal);
+  if(axis >= 0)
+  {
+    ExtractAlignedSlice(input, output, axis);
+  }
+  else if(SupportsNormal(Normal))
+  {
+    ExtractObliqueSlice(input, output);
+  }
+  else
+  {
+    vtkErrorMacro(<< "Oblique image slices require VTK 9");
+    return 0;
+  }
+
+  UpdateProgress(1.0);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSliceExtractor::ExtractAlignedSlice(vtkImageData* input, vtkImageData* output, int axis)
+{
+  int extent[6];
+  double origin[3];
+  double spacing[3];
+  input->GetExtent(extent);
+  input->GetOrigin(origin);
+  input->GetSpacing(spacing);
+
+  int pointDims[3];
+  for(int i = 0; i < 3; i++)
+  {
+    pointDims[i] = extent[2 * i + 1] - extent[2 * i] + 1;
+  }
+  int cellDims[3];
+  getCellDimensions(pointDims, cellDims);
+
+  // Images that are already flat along the axis are their own slice
+  if(pointDims[axis] <= 1)
+  {
+    output->ShallowCopy(input);
+    return;
+  }
+
+  double index = (Origin[axis] - origin[axis]) / spacing[axis];
+  int pointLayer = std::min(std::max(static_cast<int>(std::lround(index)), extent[2 * axis]), extent[2 * axis + 1]) - extent[2 * axis];
+  int cellLayer = std::min(std::max(static_cast<int>(std::floor(index)), extent[2 * axis]), extent[2 * axis + 1] - 1) - extent[2 * axis];
+
+  // The slice sits at the plane position clamped to the image bounds
+  double bounds[6];
+  input->GetBounds(bounds);
+  double outputOrigin[3] = {origin[0], origin[1], origin[2]};
+  outputOrigin[axis] = std::min(std::max(Origin[axis], bounds[2 * axis]), bounds[2 * axis + 1]);
+  int outputExtent[6];
+  std::copy(extent, extent + 6, outputExtent);
+  outputExtent[2 * axis] = 0;
+  outputExtent[2 * axis + 1] = 0;
+
+  output->SetExtent(outputExtent);
+  output->SetOrigin(outputOrigin);
+  output->SetSpacing(spacing);
+
+  extractLayer(input->GetCellData(), output->GetCellData(), cellDims, axis, cellLayer);
+  extractLayer(input->GetPointData(), output->GetPointData(), pointDims, axis, pointLayer);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSliceExtractor::ExtractObliqueSlice(vtkImageData* input, vtkImageData* output)
+{
+#if VTK_MAJOR_VERSION >= 9
+  double normal[3] = {Normal[0], Normal[1], Normal[2]};
+  vtkMath::Normalize(normal);
+
+  // Build the in-plane axes from the image axis least aligned with the normal
+  int leastAligned = 0;
+  for(int i = 1; i < 3; i++)
+  {
+    if(std::abs(normal[i]) < std::abs(normal[leastAligned]))
+    {
+      leastAligned = i;
+    }
+  }
+  double axisVector[3] = {0.0, 0.0, 0.0};
+  axisVector[leastAligned] = 1.0;
+  double u[3];
+  double v[3];
+  vtkMath::Cross(normal, axisVector, u);
+  vtkMath::Normalize(u);
+  vtkMath::Cross(normal, u, v);
+
+  // Fit the slice around the projection of the image bounds
+  double bounds[6];
+  input->GetBounds(bounds);
+  double range[4] = {VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN};
+  for(int corner = 0; corner < 8; corner++)
+  {
+    double offset[3];
+    for(int i = 0; i < 3; i++)
+    {
+      offset[i] = bounds[2 * i + ((corner >> i) & 1)] - Origin[i];
+    }
+
+    double a = vtkMath::Dot(offset, u);
+    double b = vtkMath::Dot(offset, v);
+    range[0] = std::min(range[0], a);
+    range[1] = std::max(range[1], a);
+    range[2] = std::min(range[2], b);
+    range[3] = std::max(range[3], b);
+  }
+
+  double inputSpacing[3];
+  input->GetSpacing(inputSpacing);
+  double spacing = std::min(inputSpacing[0], std::min(inputSpacing[1], inputSpacing[2]));
+  int cellsU = std::max(static_cast<int>(std::ceil((range[1] - range[0]) / spacing)), 1);
+  int cellsV = std::max(static_cast<int>(std::ceil((range[3] - range[2]) / spacing)), 1);
+
+  double outputOrigin[3];
+  for(int i = 0; i < 3; i++)
+  {
+    outputOrigin[i] = Origin[i] + range[0] * u[i] + range[2] * v[i];
+  }
+
+  output->SetExtent(0, cellsU, 0, cellsV, 0, 0);
+  output->SetOrigin(outputOrigin);
+  output->SetSpacing(spacing, spacing, spacing);
+  output->SetDirectionMatrix(u[0], v[0], normal[0], u[1], v[1], normal[1], u[2], v[2], normal[2]);
+
+  vtkIdType numCells = static_cast<vtkIdType>(cellsU) * cellsV;
+  vtkIdType numPoints = static_cast<vtkIdType>(cellsU + 1) * (cellsV + 1);
+  VTK_NEW(vtkIdList, cellIds);
+  VTK_NEW(vtkIdList, pointIds);
+  cellIds->SetNumberOfIds(numCells);
+  pointIds->SetNumberOfIds(numPoints);
+
+  VTK_NEW(vtkUnsignedCharArray, ghosts);
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfTuples(numCells);
+
+  // The last row of points has no cells above it
+  ObliqueSampleFunctor functor(input, outputOrigin, u, v, spacing, cellsU, cellIds->GetPointer(0), pointIds->GetPointer(0), ghosts->GetPointer(0));
+  vtkSMPTools::For(0, cellsV, functor);
+  ObliqueSampleFunctor lastRowFunctor(input, outputOrigin, u, v, spacing, cellsU, nullptr, pointIds->GetPointer(0), nullptr);
+  vtkSMPTools::For(cellsV, cellsV + 1, lastRowFunctor);
+
+  copyTuples(input->GetCellData(), output->GetCellData(), cellIds);
+  copyTuples(input->GetPointData(), output->GetPointData(), pointIds);
+
+  // Cells hidden or blanked in the input stay hidden in the slice
+  unsigned char* ghostValues = ghosts->GetPointer(0);
+  vtkUnsignedCharArray* sampledGhosts = vtkUnsignedCharArray::SafeDownCast(output->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+  if(sampledGhosts && sampledGhosts->GetNumberOfTuples() == numCells)
+  {
+    const unsigned char* sampledValues = sampledGhosts->GetPointer(0);
+    std::transform(ghostValues, ghostValues + numCells, sampledValues, ghostValues, [](unsigned char value, unsigned char sampled) { return static_cast<unsigned char>(value | sampled); });
+  }
+
+  if(std::any_of(ghostValues, ghostValues + numCells, [](unsigned char value) { return value != 0; }))
+  {
+    output->GetCellData()->AddArray(ghosts);
+  }
+#else
+  vtkErrorMacro(<< "Oblique image slices require VTK 9");
+#endif
+}
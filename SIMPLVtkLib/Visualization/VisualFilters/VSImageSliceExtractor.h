@@ -0,0 +1,139 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <vtkDataSetAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImageSliceExtractor VSImageSliceExtractor.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSImageSliceExtractor.h
+ * @brief This vtkAlgorithm slices a vtkImageData with a plane and produces a flat
+ * vtkUniformGrid instead of the polygonal contour generated by vtkCutter.  Planes
+ * normal to an image axis take the nearest layer of cells and points directly.  Layers
+ * normal to the Z axis are contiguous, so their arrays reference the input memory
+ * without copying.  Callers must keep the input arrays alive for as long as such a
+ * slice is used.  Oblique planes are resampled with nearest-neighbor lookups into an
+ * image oriented by its direction matrix, which requires VTK 9.  Cells of an oblique
+ * slice that fall outside the input are blanked.
+ */
+class SIMPLVtkLib_EXPORT VSImageSliceExtractor : public vtkDataSetAlgorithm
+{
+public:
+  static VSImageSliceExtractor* New();
+  vtkTypeMacro(VSImageSliceExtractor, vtkDataSetAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Returns the image axis the normal points along or -1 if the normal is oblique
+   * @param normal
+   * @return
+   */
+  static int GetAlignedAxis(const double normal[3]);
+
+  /**
+   * @brief Returns true if planes with the given normal can be extracted.  Returns false otherwise.
+   * @param normal
+   * @return
+   */
+  static bool SupportsNormal(const double normal[3]);
+
+  vtkSetVector3Macro(Origin, double)
+  vtkGetVector3Macro(Origin, double)
+
+  vtkSetVector3Macro(Normal, double)
+  vtkGetVector3Macro(Normal, double)
+
+protected:
+  VSImageSliceExtractor();
+  ~VSImageSliceExtractor() override = default;
+
+  /**
+   * @brief Creates a vtkUniformGrid output so that blanking is honored downstream
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Extracts the slice
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Requires vtkImageData input
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Declares vtkUniformGrid output
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Copies the layer of the input normal to the given axis
+   * @param input
+   * @param output
+   * @param axis
+   */
+  void ExtractAlignedSlice(vtkImageData* input, vtkImageData* output, int axis);
+
+  /**
+   * @brief Resamples the input along an oblique plane
+   * @param input
+   * @param output
+   */
+  void ExtractObliqueSlice(vtkImageData* input, vtkImageData* output);
+
+  double Origin[3];
+  double Normal[3];
+
+private:
+  VSImageSliceExtractor(const VSImageSliceExtractor&) = delete;
+  void operator=(const VSImageSliceExtractor&) = delete;
+};
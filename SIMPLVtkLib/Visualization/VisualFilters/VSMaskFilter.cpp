@@ -87,7 +87,9 @@ VSMaskFilter* VSMaskFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
 void VSMaskFilter::createFilter()
 {
   m_MaskAlgorithm = VTK_PTR(vtkThreshold)::New();
-  m_MaskAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+  m_ImageMaskAlgorithm = VTK_PTR(VSImageBlankingThreshold)::New();
+  m_ImageExtractAlgorithm = VTK_PTR(VSCompoundThreshold)::New();
+  m_ImageExtractAlgorithm->BlankImagesOff();
   setConnectedInput(true);
 }
 
@@ -131,7 +133,9 @@ void VSMaskFilter::applyValues(VSMaskValues* values)
 // -----------------------------------------------------------------------------
 void VSMaskFilter::apply(QString name)
 {
-  if(nullptr == m_MaskAlgorithm)
+  abortApply();
+
+  if(nullptr == m_MaskAlgorithm || isCancelingApply())
   {
     createFilter();
   }
@@ -139,11 +143,28 @@ void VSMaskFilter::apply(QString name)
   // Save the applied values for resetting Mask-Type widgets
   m_MaskValues->setLastArrayName(name);
 
+  const bool imageInput = getParentFilter() && IMAGE_DATA == getParentFilter()->getOutputType();
+  m_AppliedImageBlanking = useImageBlanking();
+  if(m_AppliedImageBlanking)
+  {
+    m_ImageMaskAlgorithm->ThresholdByUpper(1.0);
+    m_ImageMaskAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(name));
+    executeAlgorithm(m_ImageMaskAlgorithm);
+    return;
+  }
+
+  // Image data that cannot be blanked is extracted without the cells hidden by a blanked ancestor
+  if(imageInput)
+  {
+    m_ImageExtractAlgorithm->RemoveAllRanges();
+    m_ImageExtractAlgorithm->AddRange(qPrintable(name), 1.0, VTK_DOUBLE_MAX);
+    executeAlgorithm(m_ImageExtractAlgorithm);
+    return;
+  }
+
   m_MaskAlgorithm->ThresholdByUpper(1.0);
   m_MaskAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(name));
-  m_MaskAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  executeAlgorithm(m_MaskAlgorithm);
 }
 
 // -----------------------------------------------------------------------------
@@ -170,9 +191,9 @@ void VSMaskFilter::writeJson(QJsonObject& json)
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSMaskFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_MaskAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_MaskAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -187,9 +208,9 @@ vtkAlgorithmOutput* VSMaskFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSMaskFilter::getOutput() const
 {
-  if(getConnectedInput() && m_MaskAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_MaskAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -213,7 +234,8 @@ void VSMaskFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_MaskAlgorithm)
   {
-    m_MaskAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Rerun the last applied values against the new input
+    apply(m_MaskValues->getLastArrayName());
   }
   else
   {
@@ -234,7 +256,65 @@ QUuid VSMaskFilter::GetUuid()
 // -----------------------------------------------------------------------------
 VSAbstractFilter::dataType_t VSMaskFilter::getOutputType() const
 {
-  return UNSTRUCTURED_GRID;
+  return useImageBlanking() ? IMAGE_DATA : UNSTRUCTURED_GRID;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMaskFilter::useImageBlanking() const
+{
+  if(nullptr == getParentFilter() || IMAGE_DATA != getParentFilter()->getOutputType())
+  {
+    return false;
+  }
+
+  // Filters such as clips and slices would show the hidden cells
+  for(VSAbstractFilter* child : getChildren())
+  {
+    if(false == child->acceptsBlankedInput())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMaskFilter::updateImageBlanking()
+{
+  if((hasAppliedOutput() || isApplying()) && m_AppliedImageBlanking != useImageBlanking())
+  {
+    apply(m_MaskValues->getLastArrayName());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMaskFilter::hasBlankedOutput() const
+{
+  return useImageBlanking();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMaskFilter::acceptsBlankedInput() const
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMaskFilter::childrenChanged()
+{
+  // Children can be added while importing on another thread
+  QMetaObject::invokeMethod(this, "updateImageBlanking", Qt::QueuedConnection);
 }
 
 // -----------------------------------------------------------------------------
@@ -40,6 +40,8 @@
 #include <vtkThreshold.h>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCompoundThreshold.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSImageBlankingThreshold.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskValues.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -129,6 +131,18 @@ public:
    */
   dataType_t getOutputType() const override;
 
+  /**
+   * @brief Returns true while the parent's image data is blanked instead of extracted
+   * @return
+   */
+  bool hasBlankedOutput() const override;
+
+  /**
+   * @brief Returns true because cells hidden by a blanked input are never kept
+   * @return
+   */
+  bool acceptsBlankedInput() const override;
+
   /**
    * @brief Returns the required input data type
    * @return
@@ -194,8 +208,32 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Re-applies the filter when a new or removed child changes whether the
+   * output can be blanked
+   */
+  void childrenChanged() override;
+
+  /**
+   * @brief Returns true if the parent output is a vtkImageData that should be
+   * blanked instead of extracted into a vtkUnstructuredGrid.  The parent's declared
+   * output type is used so that its data is never generated to decide this.
+   * Blanking is only used while every child filter skips hidden cells.
+   * @return
+   */
+  bool useImageBlanking() const;
+
+protected slots:
+  /**
+   * @brief Re-applies the last values if the output no longer matches useImageBlanking
+   */
+  void updateImageBlanking();
+
 private:
   VTK_PTR(vtkThreshold) m_MaskAlgorithm;
+  VTK_PTR(VSImageBlankingThreshold) m_ImageMaskAlgorithm;
+  VTK_PTR(VSCompoundThreshold) m_ImageExtractAlgorithm;
+  bool m_AppliedImageBlanking = false;
   VSMaskValues* m_MaskValues = nullptr;
 };
 
@@ -0,0 +1,418 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSOrthoSliceFilter.h"
+
+#include <algorithm>
+
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include <vtkDataSet.h>
+#include <vtkImageData.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOrthoSliceFilter::VSOrthoSliceFilter(VSAbstractFilter* parent)
+: VSAbstractFilter()
+{
+  m_OrthoSliceAlgorithm = nullptr;
+  setParentFilter(parent);
+
+  m_OrthoSliceValues = new VSOrthoSliceValues(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOrthoSliceFilter::VSOrthoSliceFilter(const VSOrthoSliceFilter& copy)
+: VSAbstractFilter()
+{
+  m_OrthoSliceAlgorithm = nullptr;
+  setParentFilter(copy.getParentFilter());
+
+  m_OrthoSliceValues = new VSOrthoSliceValues(*(copy.m_OrthoSliceValues));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOrthoSliceFilter* VSOrthoSliceFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
+{
+  VSOrthoSliceFilter* filter = new VSOrthoSliceFilter(parent);
+  filter->m_OrthoSliceValues->readJson(json);
+
+  filter->setInitialized(true);
+  filter->readTransformJson(json);
+
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::createFilter()
+{
+  m_OrthoSliceAlgorithm = VTK_PTR(VSImageOrthoSlicer)::New();
+  setConnectedInput(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSOrthoSliceFilter::getFilterName() const
+{
+  return "Ortho Slice";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSOrthoSliceFilter::getToolTip() const
+{
+  return "Orthogonal Slice Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::FilterType VSOrthoSliceFilter::getFilterType() const
+{
+  return FilterType::Filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::applyValues(VSOrthoSliceValues* values)
+{
+  if(values)
+  {
+    apply(values->getSlicePositions(), values->getSliceVisibility());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::previewValues(VSOrthoSliceValues* values)
+{
+  if(nullptr == values)
+  {
+    return;
+  }
+
+  // Slices cost as much as their area, so the full resolution input is sliced on the
+  // worker thread.  The cached planes that did not move are reused.
+  abortApply();
+  prepareSliceAlgorithm(values->getSlicePositions(), values->getSliceVisibility());
+  executeAlgorithm(m_OrthoSliceAlgorithm);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::apply(const double positions[3], const bool visibility[3])
+{
+  abortApply();
+  prepareSliceAlgorithm(positions, visibility);
+
+  // Save the applied values for resetting the filter widget
+  m_OrthoSliceValues->setLastSlicePositions(positions);
+  m_OrthoSliceValues->setLastSliceVisibility(visibility);
+
+  executeAlgorithm(m_OrthoSliceAlgorithm);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::apply(std::vector<double> positionVector, std::vector<bool> visibilityVector)
+{
+  if(positionVector.size() != 3 || visibilityVector.size() != 3)
+  {
+    return;
+  }
+
+  double positions[3];
+  bool visibility[3];
+  for(int i = 0; i < 3; i++)
+  {
+    positions[i] = positionVector[i];
+    visibility[i] = visibilityVector[i];
+  }
+
+  apply(positions, visibility);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::prepareSliceAlgorithm(const double positions[3], const bool visibility[3])
+{
+  // An aborted update may still be returning.  The slicer reads its parameters when an
+  // update starts and executeAlgorithm queues the rerun, so the cached planes are kept.
+  if(nullptr == m_OrthoSliceAlgorithm)
+  {
+    createFilter();
+  }
+
+  m_OrthoSliceAlgorithm->SetSlicePositions(positions[0], positions[1], positions[2]);
+  m_OrthoSliceAlgorithm->SetSliceVisibility(visibility[0], visibility[1], visibility[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOrthoSliceFilter::outputReferencesInput(vtkAlgorithm* algorithm) const
+{
+  return algorithm == m_OrthoSliceAlgorithm.GetPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::storeAdditionalOutputs(vtkAlgorithm* algorithm)
+{
+  if(algorithm != m_OrthoSliceAlgorithm.GetPointer())
+  {
+    return;
+  }
+
+  for(int axis = 0; axis < 3; axis++)
+  {
+    m_PlaneOutputs[axis] = nullptr;
+    vtkImageData* planeOutput = vtkImageData::SafeDownCast(algorithm->GetOutputDataObject(VSImageOrthoSlicer::GetPlanePort(axis)));
+    if(planeOutput && planeOutput->GetNumberOfCells() > 0)
+    {
+      m_PlaneOutputs[axis].TakeReference(planeOutput->NewInstance());
+      m_PlaneOutputs[axis]->ShallowCopy(planeOutput);
+    }
+
+    // Only the primary output is released by the base class
+    if(algorithm->GetReleaseDataFlag() && planeOutput)
+    {
+      planeOutput->ReleaseData();
+    }
+  }
+  m_PrimaryAxis = m_OrthoSliceAlgorithm->GetPrimaryAxis();
+
+  // The planes outlive a released output, so they keep their own reference to the input
+  m_PlaneInput = nullptr;
+  vtkDataObject* algorithmInput = algorithm->GetInputDataObject(0, 0);
+  if(algorithmInput)
+  {
+    m_PlaneInput.TakeReference(algorithmInput->NewInstance());
+    m_PlaneInput->ShallowCopy(algorithmInput);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSOrthoSliceFilter::getPlaneOutput(int axis) const
+{
+  if(axis < 0 || axis > 2)
+  {
+    return nullptr;
+  }
+
+  return m_PlaneOutputs[axis];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSOrthoSliceFilter::getPrimaryAxis() const
+{
+  return m_PrimaryAxis;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::writeJson(QJsonObject& json)
+{
+  VSAbstractFilter::writeJson(json);
+  m_OrthoSliceValues->writeJson(json);
+
+  json["Uuid"] = GetUuid().toString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSOrthoSliceFilter::getOutputPort()
+{
+  if(getConnectedInput() && hasAppliedOutput())
+  {
+    return getAppliedOutputPort();
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutputPort();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSOrthoSliceFilter::getOutput() const
+{
+  if(getConnectedInput() && hasAppliedOutput())
+  {
+    return getAppliedOutput();
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutput();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceFilter::updateAlgorithmInput(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  setInputPort(filter->getOutputPort());
+
+  if(getConnectedInput() && m_OrthoSliceAlgorithm)
+  {
+    // Rerun the last applied values against the new input
+    double positions[3];
+    bool visibility[3];
+    std::copy(m_OrthoSliceValues->getLastSlicePositions(), m_OrthoSliceValues->getLastSlicePositions() + 3, positions);
+    std::copy(m_OrthoSliceValues->getLastSliceVisibility(), m_OrthoSliceValues->getLastSliceVisibility() + 3, visibility);
+    apply(positions, visibility);
+  }
+  else
+  {
+    emit updatedOutputPort(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid VSOrthoSliceFilter::GetUuid()
+{
+  return QUuid("{19acb8de-4a43-5a43-9212-3a2fa57fd90d}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSOrthoSliceFilter::getOutputType() const
+{
+  return IMAGE_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSOrthoSliceFilter::GetRequiredInputType()
+{
+  return IMAGE_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOrthoSliceFilter::CompatibleWithParent(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return false;
+  }
+
+  // Blanked cells are not skipped when extracting image subsets
+  if(filter->hasBlankedOutput())
+  {
+    return false;
+  }
+
+  if(CompatibleInput(filter->getOutputType(), GetRequiredInputType()))
+  {
+    return true;
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOrthoSliceFilter::CompatibleWithParents(VSAbstractFilter::FilterListType filters)
+{
+  if(filters.size() == 0)
+  {
+    return false;
+  }
+
+  for(VSAbstractFilter* filter : filters)
+  {
+    if(false == CompatibleWithParent(filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilterValues* VSOrthoSliceFilter::getValues()
+{
+  return m_OrthoSliceValues;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSOrthoSliceFilter::getInfoString(SIMPL::InfoStringFormat format) const
+{
+  return QString();
+}
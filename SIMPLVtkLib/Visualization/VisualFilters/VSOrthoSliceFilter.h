@@ -0,0 +1,250 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <vector>
+
+#include "Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSImageOrthoSlicer.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceValues.h"
+
+/**
+ * @class VSOrthoSliceFilter VSOrthoSliceFilter.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceFilter.h
+ * @brief This class slices image data along the three planes normal to its axes.
+ * All three planes share the parent's output and a single VSImageOrthoSlicer, which
+ * only extracts the planes that moved since the last update.  Each plane is kept as a
+ * separate flat image so that VSFilterViewSettings can draw it with its own textured actor.
+ */
+class SIMPLVtkLib_EXPORT VSOrthoSliceFilter : public VSAbstractFilter
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSOrthoSliceFilter(VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Copy constructor
+   * @param copy
+   */
+  VSOrthoSliceFilter(const VSOrthoSliceFilter& copy);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSOrthoSliceFilter() = default;
+
+  /**
+   * @brief Create
+   * @param json
+   * @param parent
+   * @return
+   */
+  static VSOrthoSliceFilter* Create(QJsonObject& json, VSAbstractFilter* parent);
+
+  /**
+   * @brief Returns the filter's name
+   * @return
+   */
+  QString getFilterName() const override;
+
+  /**
+   * @brief Returns the tooltip to use for the filter
+   * @return
+   */
+  virtual QString getToolTip() const override;
+
+  /**
+   * @brief Convenience method for determining what the filter does
+   * @return
+   */
+  FilterType getFilterType() const override;
+
+  /**
+   * @brief Applies the current filter with the given values
+   * @param values
+   */
+  void applyValues(VSOrthoSliceValues* values);
+
+  /**
+   * @brief Updates the slices with the given values without saving them as the applied
+   * values.  Used while a plane is being dragged.  Only the moving plane is extracted again.
+   * @param values
+   */
+  void previewValues(VSOrthoSliceValues* values);
+
+  /**
+   * @brief Applies the updated values to the algorithm and updates the output
+   * @param positions
+   * @param visibility
+   */
+  void apply(const double positions[3], const bool visibility[3]);
+
+  /**
+   * @brief Invokable method for QML to apply the plane positions and visibility to the algorithm.
+   * @param positions
+   * @param visibility
+   */
+  Q_INVOKABLE void apply(std::vector<double> positions, std::vector<bool> visibility);
+
+  /**
+   * @brief Returns the output port to be used by vtkMappers and subsequent filters
+   * @return
+   */
+  virtual vtkAlgorithmOutput* getOutputPort() override;
+
+  /**
+   * @brief Returns a smart pointer containing the output data from the filter
+   * @return
+   */
+  virtual VTK_PTR(vtkDataSet) getOutput() const override;
+
+  /**
+   * @brief Returns the plane normal to the given axis from the last apply.  Returns
+   * nullptr if the plane is hidden or nothing has been applied.
+   * @param axis
+   * @return
+   */
+  VTK_PTR(vtkImageData) getPlaneOutput(int axis) const;
+
+  /**
+   * @brief Returns the axis of the plane used as the filter output.  The other planes
+   * are only available through getPlaneOutput.  Returns -1 if no plane is visible.
+   * @return
+   */
+  int getPrimaryAxis() const;
+
+  /**
+   * @brief Returns IMAGE_DATA.  Each plane is a flat image, and filters added below
+   * this one operate on the first visible plane held by the output.
+   * @return
+   */
+  dataType_t getOutputType() const override;
+
+  /**
+   * @brief Returns the required input data type
+   * @return
+   */
+  static dataType_t GetRequiredInputType();
+
+  /**
+   * @brief Returns true if this filter type can be added as a child of
+   * the given filter.  Returns false otherwise.
+   * @param filter
+   * @return
+   */
+  static bool CompatibleWithParent(VSAbstractFilter* filter);
+
+  /**
+   * @brief Returns true if this filter type can be added as a child of
+   * the given filters.  Returns false otherwise.
+   * @param filters
+   * @return
+   */
+  static bool CompatibleWithParents(VSAbstractFilter::FilterListType filters);
+
+  /**
+   * @brief Returns the filter values associated with the filter
+   * @return
+   */
+  VSAbstractFilterValues* getValues() override;
+
+  /**
+   * @brief Writes values to a json file from the filter
+   * @param json
+   */
+  void writeJson(QJsonObject& json) override;
+
+  /**
+   * @brief getUuid
+   * @return
+   */
+  static QUuid GetUuid();
+
+  /**
+   * @brief getInfoString
+   * @return Returns a formatted string that contains general infomation about
+   * the filter.
+   */
+  QString getInfoString(SIMPL::InfoStringFormat format) const override;
+
+protected:
+  /**
+   * @brief Initializes the algorithm and connects it to the vtkMapper
+   */
+  void createFilter() override;
+
+  /**
+   * @brief This method updates the input port and connects it to the vtkAlgorithm if it exists
+   * @param filter
+   */
+  void updateAlgorithmInput(VSAbstractFilter* filter) override;
+
+  /**
+   * @brief Sets the plane positions and visibility on the algorithm
+   * @param positions
+   * @param visibility
+   */
+  void prepareSliceAlgorithm(const double positions[3], const bool visibility[3]);
+
+  /**
+   * @brief Returns true for the ortho slice algorithm, whose planes normal to the Z
+   * axis reference the parent arrays
+   * @param algorithm
+   * @return
+   */
+  bool outputReferencesInput(vtkAlgorithm* algorithm) const override;
+
+  /**
+   * @brief Copies the outputs of the individual planes
+   * @param algorithm
+   */
+  void storeAdditionalOutputs(vtkAlgorithm* algorithm) override;
+
+private:
+  VTK_PTR(VSImageOrthoSlicer) m_OrthoSliceAlgorithm;
+  VTK_PTR(vtkImageData) m_PlaneOutputs[3];
+  VTK_PTR(vtkDataObject) m_PlaneInput = nullptr;
+  int m_PrimaryAxis = -1;
+  VSOrthoSliceValues* m_OrthoSliceValues = nullptr;
+};
+
+Q_DECLARE_METATYPE(VSOrthoSliceFilter)
@@ -0,0 +1,373 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "VSOrthoSliceValues.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+#include <vtkImageData.h>
+
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceFilter.h"
+#include "ui_VSOrthoSliceFilterWidget.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOrthoSliceValues::VSOrthoSliceValues(VSOrthoSliceFilter* filter)
+: VSAbstractFilterValues(filter)
+{
+  // Start with the planes crossing at the center of the volume
+  double* bounds = filter->getBounds();
+  for(int i = 0; i < 3; i++)
+  {
+    m_SlicePositions[i] = bounds ? (bounds[2 * i] + bounds[2 * i + 1]) / 2.0 : 0.0;
+    m_SliceVisibility[i] = true;
+    m_LastSlicePositions[i] = m_SlicePositions[i];
+    m_LastSliceVisibility[i] = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOrthoSliceValues::VSOrthoSliceValues(const VSOrthoSliceValues& values)
+: VSAbstractFilterValues(values.getFilter())
+, m_FreshFilter(values.m_FreshFilter)
+{
+  for(int i = 0; i < 3; i++)
+  {
+    m_SlicePositions[i] = values.m_SlicePositions[i];
+    m_SliceVisibility[i] = values.m_SliceVisibility[i];
+    m_LastSlicePositions[i] = values.m_LastSlicePositions[i];
+    m_LastSliceVisibility[i] = values.m_LastSliceVisibility[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::applyValues()
+{
+  VSAbstractFilter::FilterListType filters = getSelection();
+  for(VSAbstractFilter* filter : filters)
+  {
+    // Make sure this is the appropriate filter type first
+    FilterType* filterType = dynamic_cast<FilterType*>(filter);
+    if(filterType)
+    {
+      filterType->applyValues(this);
+    }
+  }
+
+  m_FreshFilter = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::previewValues()
+{
+  VSAbstractFilter::FilterListType filters = getSelection();
+  for(VSAbstractFilter* filter : filters)
+  {
+    FilterType* filterType = dynamic_cast<FilterType*>(filter);
+    if(filterType)
+    {
+      filterType->previewValues(this);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::resetValues()
+{
+  for(int i = 0; i < 3; i++)
+  {
+    setSlicePosition(i, m_LastSlicePositions[i]);
+    setSliceVisible(i, m_LastSliceVisibility[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOrthoSliceValues::hasChanges() const
+{
+  if(m_FreshFilter)
+  {
+    return true;
+  }
+
+  if(getSelection().size() > 1)
+  {
+    return true;
+  }
+
+  for(int i = 0; i < 3; i++)
+  {
+    if(m_SlicePositions[i] != m_LastSlicePositions[i] || m_SliceVisibility[i] != m_LastSliceVisibility[i])
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOrthoSliceValues::getLayerGeometry(int axis, double& start, double& spacing, int& numLayers) const
+{
+  VSAbstractFilter* parentFilter = getFilter()->getParentFilter();
+  vtkImageData* imageData = parentFilter ? vtkImageData::SafeDownCast(parentFilter->getOutput()) : nullptr;
+  if(nullptr == imageData)
+  {
+    return false;
+  }
+
+  int extent[6];
+  imageData->GetExtent(extent);
+  spacing = imageData->GetSpacing()[axis];
+  start = imageData->GetOrigin()[axis] + extent[2 * axis] * spacing;
+  numLayers = std::max(extent[2 * axis + 1] - extent[2 * axis], 1);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QWidget* VSOrthoSliceValues::createFilterWidget()
+{
+  Ui::VSOrthoSliceFilterWidget ui;
+  QWidget* filterWidget = new QWidget();
+  ui.setupUi(filterWidget);
+
+  QCheckBox* checkBoxes[3] = {ui.xCheckBox, ui.yCheckBox, ui.zCheckBox};
+  QSlider* sliders[3] = {ui.xSlider, ui.ySlider, ui.zSlider};
+  QDoubleSpinBox* spinBoxes[3] = {ui.xSpinBox, ui.ySpinBox, ui.zSpinBox};
+  double* bounds = getFilter()->getBounds();
+
+  for(int axis = 0; axis < 3; axis++)
+  {
+    QCheckBox* checkBox = checkBoxes[axis];
+    QSlider* slider = sliders[axis];
+    QDoubleSpinBox* spinBox = spinBoxes[axis];
+
+    double start = 0.0;
+    double spacing = 1.0;
+    int numLayers = 1;
+    slider->setEnabled(getLayerGeometry(axis, start, spacing, numLayers));
+    slider->setRange(0, numLayers - 1);
+    if(bounds)
+    {
+      spinBox->setRange(bounds[2 * axis], bounds[2 * axis + 1]);
+    }
+    spinBox->setSingleStep(spacing);
+
+    // The slider steps through layers of cells and places the plane at the center of each layer
+    auto toLayer = [=](double position) { return spacing != 0.0 ? static_cast<int>(std::floor((position - start) / spacing)) : 0; };
+    auto updateControls = [=](double position) {
+      slider->blockSignals(true);
+      spinBox->blockSignals(true);
+      slider->setValue(toLayer(position));
+      spinBox->setValue(position);
+      slider->blockSignals(false);
+      spinBox->blockSignals(false);
+    };
+
+    checkBox->setChecked(m_SliceVisibility[axis]);
+    updateControls(m_SlicePositions[axis]);
+
+    connect(checkBox, &QCheckBox::toggled, filterWidget, [=](bool checked) { setSliceVisible(axis, checked); });
+    connect(spinBox, &QDoubleSpinBox::editingFinished, filterWidget, [=] { setSlicePosition(axis, spinBox->value()); });
+    connect(slider, &QSlider::valueChanged, filterWidget, [=](int layer) { setSlicePosition(axis, start + (layer + 0.5) * spacing); });
+
+    // Dragging a slider previews the moving plane without waiting for Apply
+    connect(slider, &QSlider::sliderPressed, this, &VSOrthoSliceValues::beginInteractivePreview);
+    connect(slider, &QSlider::sliderReleased, this, &VSOrthoSliceValues::endInteractivePreview);
+
+    connect(this, &VSOrthoSliceValues::slicePositionChanged, filterWidget, [=](int changedAxis, double position) {
+      if(changedAxis == axis)
+      {
+        updateControls(position);
+      }
+    });
+    connect(this, &VSOrthoSliceValues::sliceVisibilityChanged, filterWidget, [=](int changedAxis, bool visible) {
+      if(changedAxis == axis)
+      {
+        checkBox->blockSignals(true);
+        checkBox->setChecked(visible);
+        checkBox->blockSignals(false);
+      }
+    });
+  }
+
+  return filterWidget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const double* VSOrthoSliceValues::getSlicePositions() const
+{
+  return m_SlicePositions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const bool* VSOrthoSliceValues::getSliceVisibility() const
+{
+  return m_SliceVisibility;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::setSlicePosition(int axis, double position)
+{
+  if(axis < 0 || axis > 2)
+  {
+    return;
+  }
+
+  m_SlicePositions[axis] = position;
+  emit slicePositionChanged(axis, position);
+  emit alertChangesWaiting();
+
+  updateInteractivePreview();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::setSliceVisible(int axis, bool visible)
+{
+  if(axis < 0 || axis > 2)
+  {
+    return;
+  }
+
+  m_SliceVisibility[axis] = visible;
+  emit sliceVisibilityChanged(axis, visible);
+  emit alertChangesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const double* VSOrthoSliceValues::getLastSlicePositions() const
+{
+  return m_LastSlicePositions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const bool* VSOrthoSliceValues::getLastSliceVisibility() const
+{
+  return m_LastSliceVisibility;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::setLastSlicePositions(const double positions[3])
+{
+  std::copy(positions, positions + 3, m_LastSlicePositions);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::setLastSliceVisibility(const bool visibility[3])
+{
+  std::copy(visibility, visibility + 3, m_LastSliceVisibility);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::writeJson(QJsonObject& json)
+{
+  QJsonArray positions;
+  QJsonArray lastPositions;
+  QJsonArray visibility;
+  QJsonArray lastVisibility;
+  for(int i = 0; i < 3; i++)
+  {
+    positions.append(m_SlicePositions[i]);
+    lastPositions.append(m_LastSlicePositions[i]);
+    visibility.append(m_SliceVisibility[i]);
+    lastVisibility.append(m_LastSliceVisibility[i]);
+  }
+
+  json["Slice Positions"] = positions;
+  json["Last Slice Positions"] = lastPositions;
+  json["Slice Visibility"] = visibility;
+  json["Last Slice Visibility"] = lastVisibility;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOrthoSliceValues::readJson(QJsonObject& json)
+{
+  QJsonArray positions = json["Slice Positions"].toArray();
+  QJsonArray lastPositions = json["Last Slice Positions"].toArray();
+  QJsonArray visibility = json["Slice Visibility"].toArray();
+  QJsonArray lastVisibility = json["Last Slice Visibility"].toArray();
+  if(positions.size() != 3 || lastPositions.size() != 3 || visibility.size() != 3 || lastVisibility.size() != 3)
+  {
+    return;
+  }
+
+  for(int i = 0; i < 3; i++)
+  {
+    m_SlicePositions[i] = positions.at(i).toDouble();
+    m_LastSlicePositions[i] = lastPositions.at(i).toDouble();
+    m_SliceVisibility[i] = visibility.at(i).toBool();
+    m_LastSliceVisibility[i] = lastVisibility.at(i).toBool();
+  }
+
+  m_FreshFilter = false;
+  emit alertChangesWaiting();
+}
@@ -0,0 +1,170 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include "VSAbstractFilterValues.h"
+
+class VSOrthoSliceFilter;
+
+/**
+ * @class VSOrthoSliceValues VSOrthoSliceValues.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSOrthoSliceValues.h
+ * @brief This class stores the positions and visibility of the three planes
+ * of a VSOrthoSliceFilter and allows the user to edit them in the user interface.
+ */
+class SIMPLVtkLib_EXPORT VSOrthoSliceValues : public VSAbstractFilterValues
+{
+  Q_OBJECT
+
+public:
+  using FilterType = VSOrthoSliceFilter;
+
+  VSOrthoSliceValues(VSOrthoSliceFilter* filter);
+  VSOrthoSliceValues(const VSOrthoSliceValues& values);
+  virtual ~VSOrthoSliceValues() = default;
+
+  /**
+   * @brief Applies the current values to the selected filters
+   */
+  void applyValues() override;
+
+  /**
+   * @brief Resets the selected filters to their last applied values
+   */
+  void resetValues() override;
+
+  /**
+   * @brief Returns true if there are changes waiting to be applied.  Returns false otherwise.
+   * @return
+   */
+  bool hasChanges() const override;
+
+  /**
+   * @brief Creates and returns a new filter widget
+   * @return
+   */
+  QWidget* createFilterWidget() override;
+
+  /**
+   * @brief Returns the positions of the planes normal to the X, Y, and Z axes
+   * @return
+   */
+  const double* getSlicePositions() const;
+
+  /**
+   * @brief Returns whether or not the planes normal to the X, Y, and Z axes are shown
+   * @return
+   */
+  const bool* getSliceVisibility() const;
+
+  /**
+   * @brief Sets the position of the plane normal to the given axis
+   * @param axis
+   * @param position
+   */
+  void setSlicePosition(int axis, double position);
+
+  /**
+   * @brief Sets whether or not the plane normal to the given axis is shown
+   * @param axis
+   * @param visible
+   */
+  void setSliceVisible(int axis, bool visible);
+
+  /**
+   * @brief Returns the last applied plane positions
+   * @return
+   */
+  const double* getLastSlicePositions() const;
+
+  /**
+   * @brief Returns the last applied plane visibility
+   * @return
+   */
+  const bool* getLastSliceVisibility() const;
+
+  /**
+   * @brief Updates the last applied plane positions
+   * @param positions
+   */
+  void setLastSlicePositions(const double positions[3]);
+
+  /**
+   * @brief Updates the last applied plane visibility
+   * @param visibility
+   */
+  void setLastSliceVisibility(const bool visibility[3]);
+
+  /**
+   * @brief Writes values to Json
+   * @param json
+   */
+  void writeJson(QJsonObject& json);
+
+  /**
+   * @brief Reads values from Json
+   * @param json
+   */
+  void readJson(QJsonObject& json);
+
+signals:
+  void slicePositionChanged(int axis, double position);
+  void sliceVisibilityChanged(int axis, bool visible);
+
+protected:
+  /**
+   * @brief Previews the current plane positions on the selected filters
+   */
+  void previewValues() override;
+
+  /**
+   * @brief Returns the position of the first layer of cells, the layer spacing, and the
+   * number of layers along the given axis of the parent image.  Returns false if the
+   * parent output is not image data.
+   * @param axis
+   * @param start
+   * @param spacing
+   * @param numLayers
+   * @return
+   */
+  bool getLayerGeometry(int axis, double& start, double& spacing, int& numLayers) const;
+
+private:
+  double m_SlicePositions[3];
+  bool m_SliceVisibility[3];
+  double m_LastSlicePositions[3];
+  bool m_LastSliceVisibility[3];
+  bool m_FreshFilter = true;
+};
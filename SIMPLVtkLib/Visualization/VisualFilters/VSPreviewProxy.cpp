@@ -0,0 +1,291 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSPreviewProxy.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <vtkCellType.h>
+#include <vtkExtractCells.h>
+#include <vtkExtractVOI.h>
+#include <vtkGeometryFilter.h>
+#include <vtkIdList.h>
+#include <vtkPolyData.h>
+#include <vtkQuadricClustering.h>
+#include <vtkUnstructuredGridBase.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSPreviewProxy::VSPreviewProxy(vtkIdType cellBudget)
+: m_CellBudget(cellBudget)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSPreviewProxy::getCellBudget() const
+{
+  return m_CellBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSPreviewProxy::setCellBudget(vtkIdType cellBudget)
+{
+  m_CellBudget = cellBudget;
+  clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataObject) VSPreviewProxy::getProxy(vtkDataObject* source)
+{
+  if(nullptr == source)
+  {
+    return nullptr;
+  }
+
+  vtkMTimeType sourceMTime = source->GetMTime();
+  if(m_Proxy && m_Source == source && m_SourceMTime == sourceMTime)
+  {
+    return m_Proxy;
+  }
+
+  if(m_BuildSource == source && m_BuildSourceMTime == sourceMTime)
+  {
+    if(false == m_Build.isFinished())
+    {
+      return nullptr;
+    }
+
+    m_Proxy = m_Build.result();
+    m_Source = source;
+    m_SourceMTime = sourceMTime;
+    m_Build = QFuture<VTK_PTR(vtkDataObject)>();
+    m_BuildSource = nullptr;
+    return m_Proxy;
+  }
+
+  // Sources within the budget are used as they are
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(source);
+  if(nullptr == dataSet || m_CellBudget <= 0 || dataSet->GetNumberOfCells() <= m_CellBudget)
+  {
+    m_Proxy = source;
+    m_Source = source;
+    m_SourceMTime = sourceMTime;
+    return m_Proxy;
+  }
+
+  // The worker decimates a copy so that the source can update in the meantime.  A
+  // superseded build is left to finish and its result is dropped.
+  VTK_PTR(vtkDataObject) snapshot;
+  snapshot.TakeReference(source->NewInstance());
+  snapshot->ShallowCopy(source);
+  vtkIdType cellBudget = m_CellBudget;
+  m_Build = QtConcurrent::run([snapshot, cellBudget] { return CreateProxy(snapshot, cellBudget); });
+  m_BuildSource = source;
+  m_BuildSourceMTime = sourceMTime;
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QFuture<void> VSPreviewProxy::getBuildFuture() const
+{
+  return m_Build;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSPreviewProxy::clear()
+{
+  m_Proxy = nullptr;
+  m_Source = nullptr;
+  m_SourceMTime = 0;
+  m_Build = QFuture<VTK_PTR(vtkDataObject)>();
+  m_BuildSource = nullptr;
+  m_BuildSourceMTime = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataObject) VSPreviewProxy::CreateProxy(vtkDataObject* source, vtkIdType cellBudget)
+{
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(source);
+  if(nullptr == dataSet || cellBudget <= 0 || dataSet->GetNumberOfCells() <= cellBudget)
+  {
+    return source;
+  }
+
+  if(vtkImageData* imageData = vtkImageData::SafeDownCast(dataSet))
+  {
+    return CreateImageProxy(imageData, cellBudget);
+  }
+  if(IsSurfaceMesh(dataSet))
+  {
+    return CreateSurfaceProxy(dataSet, cellBudget);
+  }
+
+  return CreateSampledCellProxy(dataSet, cellBudget);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataObject) VSPreviewProxy::CreateImageProxy(vtkImageData* imageData, vtkIdType cellBudget)
+{
+  int extent[6];
+  imageData->GetExtent(extent);
+
+  // Only stride along the axes that have more than a single cell
+  int numAxes = 0;
+  for(int i = 0; i < 3; i++)
+  {
+    if(extent[2 * i + 1] - extent[2 * i] > 1)
+    {
+      numAxes++;
+    }
+  }
+  numAxes = std::max(numAxes, 1);
+
+  double reduction = static_cast<double>(imageData->GetNumberOfCells()) / static_cast<double>(cellBudget);
+  int rate = std::max(static_cast<int>(std::ceil(std::pow(reduction, 1.0 / numAxes))), 1);
+
+  VTK_NEW(vtkExtractVOI, extractVOI);
+  extractVOI->SetInputData(imageData);
+  extractVOI->SetVOI(extent);
+  extractVOI->SetSampleRate(rate, rate, rate);
+  extractVOI->IncludeBoundaryOn();
+  extractVOI->Update();
+
+  return extractVOI->GetOutput();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataObject) VSPreviewProxy::CreateSurfaceProxy(vtkDataSet* dataSet, vtkIdType cellBudget)
+{
+  VTK_PTR(vtkPolyData) surface = vtkPolyData::SafeDownCast(dataSet);
+  if(nullptr == surface)
+  {
+    VTK_NEW(vtkGeometryFilter, geometryFilter);
+    geometryFilter->SetInputData(dataSet);
+    geometryFilter->Update();
+    surface = geometryFilter->GetOutput();
+  }
+
+  // Surface triangles scale with the square of the number of divisions
+  int divisions = std::max(static_cast<int>(std::sqrt(static_cast<double>(cellBudget))), 2);
+
+  VTK_NEW(vtkQuadricClustering, clustering);
+  clustering->SetInputData(surface);
+  clustering->SetNumberOfDivisions(divisions, divisions, divisions);
+  clustering->AutoAdjustNumberOfDivisionsOn();
+  clustering->CopyCellDataOn();
+  clustering->Update();
+
+  return clustering->GetOutput();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataObject) VSPreviewProxy::CreateSampledCellProxy(vtkDataSet* dataSet, vtkIdType cellBudget)
+{
+  vtkIdType numCells = dataSet->GetNumberOfCells();
+  vtkIdType stride = (numCells + cellBudget - 1) / cellBudget;
+
+  VTK_NEW(vtkIdList, cellIds);
+  cellIds->Allocate(numCells / stride + 1);
+  for(vtkIdType i = 0; i < numCells; i += stride)
+  {
+    cellIds->InsertNextId(i);
+  }
+
+  VTK_NEW(vtkExtractCells, extractCells);
+  extractCells->SetInputData(dataSet);
+  extractCells->SetCellList(cellIds);
+  extractCells->Update();
+
+  return extractCells->GetOutput();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSPreviewProxy::IsSurfaceMesh(vtkDataSet* dataSet)
+{
+  if(vtkPolyData::SafeDownCast(dataSet))
+  {
+    return true;
+  }
+
+  // SIMPL geometries are wrapped as homogeneous vtkMappedUnstructuredGrids
+  if(false == dataSet->IsA("vtkUnstructuredGridBase") || dataSet->GetNumberOfCells() == 0)
+  {
+    return false;
+  }
+
+  vtkUnstructuredGridBase* grid = static_cast<vtkUnstructuredGridBase*>(dataSet);
+  if(false == grid->IsHomogeneous())
+  {
+    return false;
+  }
+
+  switch(grid->GetCellType(0))
+  {
+  case VTK_TRIANGLE:
+  case VTK_QUAD:
+  case VTK_POLYGON:
+  case VTK_TRIANGLE_STRIP:
+  case VTK_PIXEL:
+  case VTK_QUADRATIC_TRIANGLE:
+  case VTK_QUADRATIC_QUAD:
+    return true;
+  default:
+    return false;
+  }
+}
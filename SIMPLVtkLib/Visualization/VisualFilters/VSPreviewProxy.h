@@ -0,0 +1,158 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkDataObject.h>
+#include <vtkDataSet.h>
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+#include <vtkWeakPointer.h>
+
+#include <QtCore/QFuture>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSPreviewProxy VSPreviewProxy.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSPreviewProxy.h
+ * @brief This class builds and caches a decimated copy of a filter input for use
+ * while a VSAbstractWidget is being dragged.  Image data is strided with
+ * vtkExtractVOI, surface meshes are decimated with vtkQuadricClustering, and all
+ * other data sets keep an evenly spaced subset of their cells.  Inputs that are
+ * already within the cell budget are returned unchanged.  Proxies are built on a
+ * worker thread from a shallow copy of the source.
+ */
+class SIMPLVtkLib_EXPORT VSPreviewProxy
+{
+public:
+  static const vtkIdType DefaultCellBudget = 262144;
+
+  /**
+   * @brief Constructor
+   * @param cellBudget
+   */
+  VSPreviewProxy(vtkIdType cellBudget = DefaultCellBudget);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSPreviewProxy() = default;
+
+  /**
+   * @brief Returns the approximate maximum number of cells in a proxy
+   * @return
+   */
+  vtkIdType getCellBudget() const;
+
+  /**
+   * @brief Sets the approximate maximum number of cells in a proxy.  This clears the cached proxy.
+   * @param cellBudget
+   */
+  void setCellBudget(vtkIdType cellBudget);
+
+  /**
+   * @brief Returns the proxy for the given source.  The proxy is rebuilt only
+   * when the source object or its modified time has changed.  Rebuilds run on a
+   * worker thread and nullptr is returned until getBuildFuture has finished.
+   * @param source
+   * @return
+   */
+  VTK_PTR(vtkDataObject) getProxy(vtkDataObject* source);
+
+  /**
+   * @brief Returns the proxy build in progress.  The future is finished if no
+   * proxy is being built.
+   * @return
+   */
+  QFuture<void> getBuildFuture() const;
+
+  /**
+   * @brief Releases the cached proxy
+   */
+  void clear();
+
+  /**
+   * @brief Creates a decimated copy of the source containing roughly cellBudget cells
+   * @param source
+   * @param cellBudget
+   * @return
+   */
+  static VTK_PTR(vtkDataObject) CreateProxy(vtkDataObject* source, vtkIdType cellBudget);
+
+protected:
+  /**
+   * @brief Returns a strided subset of the image data
+   * @param imageData
+   * @param cellBudget
+   * @return
+   */
+  static VTK_PTR(vtkDataObject) CreateImageProxy(vtkImageData* imageData, vtkIdType cellBudget);
+
+  /**
+   * @brief Returns a vtkQuadricClustering decimation of a surface mesh
+   * @param dataSet
+   * @param cellBudget
+   * @return
+   */
+  static VTK_PTR(vtkDataObject) CreateSurfaceProxy(vtkDataSet* dataSet, vtkIdType cellBudget);
+
+  /**
+   * @brief Returns an evenly spaced subset of the data set's cells
+   * @param dataSet
+   * @param cellBudget
+   * @return
+   */
+  static VTK_PTR(vtkDataObject) CreateSampledCellProxy(vtkDataSet* dataSet, vtkIdType cellBudget);
+
+  /**
+   * @brief Returns true if the data set is poly data or a homogeneous unstructured
+   * grid, including wrapped SIMPL geometries, of two dimensional cells
+   * @param dataSet
+   * @return
+   */
+  static bool IsSurfaceMesh(vtkDataSet* dataSet);
+
+private:
+  vtkIdType m_CellBudget;
+  vtkWeakPointer<vtkDataObject> m_Source;
+  vtkMTimeType m_SourceMTime = 0;
+  VTK_PTR(vtkDataObject) m_Proxy;
+  QFuture<VTK_PTR(vtkDataObject)> m_Build;
+  vtkWeakPointer<vtkDataObject> m_BuildSource;
+  vtkMTimeType m_BuildSourceMTime = 0;
+};
@@ -36,22 +36,23 @@
 #include "VSSIMPLDataContainerFilter.h"
 
 #include <QtConcurrent>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QUuid>
 
 #include <vtkAlgorithmOutput.h>
 #include <vtkCellData.h>
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
-#include <vtkExtractVOI.h>
 #include <vtkImageData.h>
 #include <vtkPointSet.h>
-#include <vtkTransformFilter.h>
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+#include "SIMPLVtkLib/Common/VSTraceRecorder.h"
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSPipelineFilter.h"
 
@@ -165,6 +166,20 @@ VTK_PTR(vtkDataSet) VSSIMPLDataContainerFilter::getOutput() const
   return m_DCValues->getWrappedDataContainer()->m_DataSet;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSSIMPLDataContainerFilter::getFilePath() const
+{
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(getParentFilter());
+  if(nullptr == fileFilter)
+  {
+    return QString();
+  }
+
+  return fileFilter->getFilePath();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -173,6 +188,7 @@ VSSIMPLDataContainerFilter* VSSIMPLDataContainerFilter::Create(const QString& fi
   QString dcName = json["Data Container Name"].toString();
 
   // Read in the data from the file and initialize the filter
+  QMutexLocker hdf5Lock(VSConcurrentImport::HDF5Mutex());
   SIMPLH5DataReader reader;
   bool success = reader.openFile(filePath);
   if(success)
@@ -210,7 +226,12 @@ VSSIMPLDataContainerFilter* VSSIMPLDataContainerFilter::Create(const QString& fi
 
         dataContainers[dcProxy.getName()] = dcProxy;
 
-        DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(proxy, false);
+        DataContainerArray::Pointer dca;
+        {
+          VS_TRACE_NAMED_SCOPE(traceScope, "Import", "Read HDF5 Data");
+          VS_TRACE_DETAIL(traceScope, filePath);
+          dca = reader.readSIMPLDataUsingProxy(proxy, false);
+        }
         DataContainerShPtr dc = dca->getDataContainer(dcName);
         if(dc)
         {
@@ -295,6 +316,7 @@ void VSSIMPLDataContainerFilter::reloadData()
   {
     QString filePath = fileFilter->getFilePath();
 
+    QMutexLocker hdf5Lock(VSConcurrentImport::HDF5Mutex());
     QSharedPointer<SIMPLH5DataReader> reader = QSharedPointer<SIMPLH5DataReader>(new SIMPLH5DataReader());
     connect(reader.data(), SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SIGNAL(errorGenerated(const QString&, const QString&, const int&)));
 
@@ -320,7 +342,12 @@ void VSSIMPLDataContainerFilter::reloadData()
           dcProxy.setFlags(Qt::Checked, amFlags, pFlags, compDimsVector);
           dataContainers[dcProxy.getName()] = dcProxy;
 
-          DataContainerArray::Pointer dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+          DataContainerArray::Pointer dca;
+          {
+            VS_TRACE_NAMED_SCOPE(traceScope, "Import", "Read HDF5 Data");
+            VS_TRACE_DETAIL(traceScope, filePath);
+            dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+          }
           DataContainer::Pointer dc = dca->getDataContainer(m_DCValues->getWrappedDataContainer()->m_Name);
 
           m_WrappingWatcher.setFuture(QtConcurrent::run(this, &VSSIMPLDataContainerFilter::reloadData, dc));
@@ -457,6 +484,7 @@ bool VSSIMPLDataContainerFilter::finishWrapping()
   // Do not lock the main thread trying to apply a filter that is already being applied.
   if(m_ApplyLock.tryAcquire())
   {
+    VS_TRACE_SCOPE("Import", "Finish Wrapping Filter");
     SIMPLVtkBridge::FinishWrappingDataContainerStruct(m_DCValues->getWrappedDataContainer());
     m_DCValues->setFullyWrapped(true);
     VTK_PTR(vtkDataSet) dataSet = m_DCValues->getWrappedDataContainer()->m_DataSet;
@@ -524,34 +552,6 @@ bool VSSIMPLDataContainerFilter::CompatibleWithParent(VSAbstractFilter* filter)
   return false;
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-double* VSSIMPLDataContainerFilter::getTransformBounds()
-{
-  if(nullptr == getTransformFilter())
-  {
-    return getBounds();
-  }
-  VTK_PTR(vtkDataSet) outputData = getOutput();
-  VTK_PTR(vtkImageData) imageData = dynamic_cast<vtkImageData*>(outputData.Get());
-
-  // Subsample the image to reduce amount of data stored in transform filter
-  VTK_PTR(vtkExtractVOI) subsample = VTK_PTR(vtkExtractVOI)::New();
-  int* inputDims = imageData->GetDimensions();
-  subsample->SetInputData(imageData);
-  subsample->SetSampleRate(20, 20, 20);
-  subsample->ReleaseDataFlagOn();
-  subsample->Update();
-
-  VTK_PTR(vtkTransformFilter) trans = getTransformFilter();
-  trans->SetInputConnection(subsample->GetOutputPort());
-  trans->SetTransform(getTransform()->getGlobalTransform());
-  trans->ReleaseDataFlagOn();
-  trans->Update();
-  return trans->GetOutput()->GetBounds();
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -122,6 +122,13 @@ public:
    */
   bool finishWrapping();
 
+  /**
+   * @brief Returns the .dream3d file the data container was read from.  Returns an empty
+   * string if the data container did not come from a file.
+   * @return
+   */
+  QString getFilePath() const;
+
   /**
    * @brief Returns the WrappedDataContainerPtr used by the filter
    * @return
@@ -177,12 +184,6 @@ public:
    */
   static bool CompatibleWithParent(VSAbstractFilter* filter);
 
-  /**
-   * @brief Returns the bounds from the vtkTransformFilter
-   * @return
-   */
-  double* getTransformBounds() override;
-
   /**
    * @brief getInfoString
    * @return Returns a formatted string that contains general infomation about
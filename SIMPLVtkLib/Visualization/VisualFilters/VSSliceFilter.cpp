@@ -35,12 +35,15 @@
 
 #include "VSSliceFilter.h"
 
+#include <algorithm>
+
 #include <QtCore/QJsonArray>
 #include <QtCore/QString>
 #include <QtCore/QUuid>
 
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
+#include <vtkImageData.h>
 #include <vtkUnstructuredGrid.h>
 
 // -----------------------------------------------------------------------------
@@ -87,7 +90,7 @@ VSSliceFilter* VSSliceFilter::Create(QJsonObject& json, VSAbstractFilter* parent
 void VSSliceFilter::createFilter()
 {
   m_SliceAlgorithm = vtkSmartPointer<vtkCutter>::New();
-  m_SliceAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+  m_ImageSliceAlgorithm = VTK_PTR(VSImageSliceExtractor)::New();
   setConnectedInput(true);
 }
 
@@ -129,25 +132,71 @@ void VSSliceFilter::applyValues(VSSliceValues* values)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSSliceFilter::apply(double origin[3], double normal[3])
+void VSSliceFilter::previewValues(VSSliceValues* values)
 {
-  if(nullptr == m_SliceAlgorithm)
+  if(nullptr == values)
   {
-    createFilter();
+    return;
   }
 
+  abortApply();
+  executePreview(prepareSliceAlgorithm(values->getOrigin(), values->getNormal()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::apply(double origin[3], double normal[3])
+{
+  abortApply();
+
   // Save the applied values for resetting Plane-Type widgets
   m_SliceValues->setLastOrigin(origin);
   m_SliceValues->setLastNormal(normal);
 
-  VTK_NEW(vtkPlane, planeWidget);
-  planeWidget->SetOrigin(origin);
-  planeWidget->SetNormal(normal);
+  executeAlgorithm(prepareSliceAlgorithm(origin, normal));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithm* VSSliceFilter::prepareSliceAlgorithm(double origin[3], double normal[3])
+{
+  if(nullptr == m_SliceAlgorithm || isCancelingApply())
+  {
+    createFilter();
+  }
+
+  // Image data is sliced directly into a flat image instead of contoured into polygons
+  if(useImageSlice(normal))
+  {
+    m_ImageSliceAlgorithm->SetOrigin(origin);
+    m_ImageSliceAlgorithm->SetNormal(normal);
+    return m_ImageSliceAlgorithm;
+  }
 
-  m_SliceAlgorithm->SetCutFunction(planeWidget);
-  m_SliceAlgorithm->Update();
+  VTK_NEW(vtkPlane, plane);
+  plane->SetOrigin(origin);
+  plane->SetNormal(normal);
 
-  emit updatedOutputPort(this);
+  m_SliceAlgorithm->SetCutFunction(plane);
+  return m_SliceAlgorithm;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSliceFilter::useImageSlice(const double normal[3]) const
+{
+  return getParentFilter() && IMAGE_DATA == getParentFilter()->getOutputType() && VSImageSliceExtractor::SupportsNormal(normal);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSliceFilter::outputReferencesInput(vtkAlgorithm* algorithm) const
+{
+  return algorithm == m_ImageSliceAlgorithm.GetPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -198,9 +247,9 @@ void VSSliceFilter::writeJson(QJsonObject& json)
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSSliceFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_SliceAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_SliceAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -215,9 +264,9 @@ vtkAlgorithmOutput* VSSliceFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSSliceFilter::getOutput() const
 {
-  if(getConnectedInput() && m_SliceAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_SliceAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -241,7 +290,13 @@ void VSSliceFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_SliceAlgorithm)
   {
-    m_SliceAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Rerun the last applied values against the new input.  The slice method can
+    // change when the input switches between image and non-image data.
+    double origin[3];
+    double normal[3];
+    std::copy(m_SliceValues->getLastOrigin(), m_SliceValues->getLastOrigin() + 3, origin);
+    std::copy(m_SliceValues->getLastNormal(), m_SliceValues->getLastNormal() + 3, normal);
+    apply(origin, normal);
   }
   else
   {
@@ -262,7 +317,7 @@ QUuid VSSliceFilter::GetUuid()
 // -----------------------------------------------------------------------------
 VSAbstractFilter::dataType_t VSSliceFilter::getOutputType() const
 {
-  return POLY_DATA;
+  return useImageSlice(m_SliceValues->getLastNormal()) ? IMAGE_DATA : POLY_DATA;
 }
 
 // -----------------------------------------------------------------------------
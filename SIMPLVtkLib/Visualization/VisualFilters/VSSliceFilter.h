@@ -43,6 +43,7 @@
 #include <vtkPlane.h>
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSImageSliceExtractor.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceValues.h"
 
 /**
@@ -106,6 +107,13 @@ public:
    */
   void applyValues(VSSliceValues* values);
 
+  /**
+   * @brief Slices a decimated proxy of the input using the given values.  Used
+   * while the plane widget is being dragged.
+   * @param values
+   */
+  void previewValues(VSSliceValues* values);
+
   /**
    * @brief Applies the updated values to the algorithm and updates the output
    * @param origin
@@ -203,8 +211,33 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns true if the parent output is image data that can be sliced directly
+   * with the given normal.  Returns false if the slice requires vtkCutter.
+   * @param normal
+   * @return
+   */
+  bool useImageSlice(const double normal[3]) const;
+
+  /**
+   * @brief Returns the algorithm that slices the parent output with the given plane
+   * @param origin
+   * @param normal
+   * @return
+   */
+  vtkAlgorithm* prepareSliceAlgorithm(double origin[3], double normal[3]);
+
+  /**
+   * @brief Returns true for the image slice algorithm, whose slices normal to the Z
+   * axis reference the parent arrays
+   * @param algorithm
+   * @return
+   */
+  bool outputReferencesInput(vtkAlgorithm* algorithm) const override;
+
 private:
   VTK_PTR(vtkCutter) m_SliceAlgorithm;
+  VTK_PTR(VSImageSliceExtractor) m_ImageSliceAlgorithm;
   VSSliceValues* m_SliceValues = nullptr;
 };
 
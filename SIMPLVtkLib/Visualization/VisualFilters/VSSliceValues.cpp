@@ -45,6 +45,7 @@ VSSliceValues::VSSliceValues(VSSliceFilter* filter)
 , m_PlaneWidget(new VSPlaneWidget(nullptr, filter->getTransform(), filter->getBounds(), nullptr))
 {
   connect(m_PlaneWidget, &VSPlaneWidget::modified, this, &VSSliceValues::alertChangesWaiting);
+  observeWidgetInteraction(m_PlaneWidget);
 
   m_PlaneWidget->setUsePlaneNormal(m_PlaneWidget->getNormal());
   m_PlaneWidget->setUsePlaneOrigin(m_PlaneWidget->getOrigin());
@@ -61,6 +62,7 @@ VSSliceValues::VSSliceValues(const VSSliceValues& values)
   m_PlaneWidget->setNormal(values.getNormal());
   m_PlaneWidget->setOrigin(values.getOrigin());
   connect(m_PlaneWidget, &VSPlaneWidget::modified, this, &VSSliceValues::alertChangesWaiting);
+  observeWidgetInteraction(m_PlaneWidget);
 
   m_PlaneWidget->setUsePlaneNormal(values.m_PlaneWidget->getUsePlaneNormal());
   m_PlaneWidget->setUsePlaneOrigin(values.m_PlaneWidget->getUsePlaneOrigin());
@@ -88,6 +90,22 @@ void VSSliceValues::applyValues()
   m_FreshFilter = false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceValues::previewValues()
+{
+  VSAbstractFilter::FilterListType filters = getSelection();
+  for(VSAbstractFilter* filter : filters)
+  {
+    FilterType* filterType = dynamic_cast<FilterType*>(filter);
+    if(filterType)
+    {
+      filterType->previewValues(this);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
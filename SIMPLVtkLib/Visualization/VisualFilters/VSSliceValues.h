@@ -158,6 +158,11 @@ protected:
    */
   void updateRendering();
 
+  /**
+   * @brief Previews the current slice values on the selected filters
+   */
+  void previewValues() override;
+
 private:
   VSPlaneWidget* m_PlaneWidget = nullptr;
   bool m_FreshFilter = true;
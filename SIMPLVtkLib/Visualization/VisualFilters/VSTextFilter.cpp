@@ -163,6 +163,30 @@ VSAbstractFilter::dataType_t VSTextFilter::getOutputType() const
   return INVALID_DATA;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextFilter::hasBlankedOutput() const
+{
+  return getParentFilter() && getParentFilter()->hasBlankedOutput();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextFilter::acceptsBlankedInput() const
+{
+  for(VSAbstractFilter* child : getChildren())
+  {
+    if(false == child->acceptsBlankedInput())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
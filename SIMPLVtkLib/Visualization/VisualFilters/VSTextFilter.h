@@ -119,6 +119,18 @@ public:
    */
   dataType_t getOutputType() const override;
 
+  /**
+   * @brief Returns true if the parent's output is blanked
+   * @return
+   */
+  bool hasBlankedOutput() const override;
+
+  /**
+   * @brief Returns true if every child accepts the blanked output passed through
+   * @return
+   */
+  bool acceptsBlankedInput() const override;
+
   /**
    * @brief Returns the required incoming data type
    * @return
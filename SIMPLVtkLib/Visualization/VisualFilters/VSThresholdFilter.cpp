@@ -41,6 +41,7 @@
 #include <vtkCellData.h>
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
+#include <vtkImageData.h>
 #include <vtkImplicitDataSet.h>
 #include <vtkPointData.h>
 #include <vtkThreshold.h>
@@ -89,6 +90,8 @@ VSThresholdFilter* VSThresholdFilter::Create(QJsonObject& json, VSAbstractFilter
 void VSThresholdFilter::createFilter()
 {
   m_ThresholdAlgorithm = VTK_PTR(vtkThreshold)::New();
+  m_ImageThresholdAlgorithm = VTK_PTR(VSImageBlankingThreshold)::New();
+  m_CompoundThresholdAlgorithm = VTK_PTR(VSCompoundThreshold)::New();
 
   // Parent cell data required
   if(false == (getParentFilter() && getParentFilter()->getOutput() && getParentFilter()->getOutput()->GetCellData()))
@@ -96,7 +99,6 @@ void VSThresholdFilter::createFilter()
     return;
   }
 
-  m_ThresholdAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
   VTK_PTR(vtkDataArray) dataArray = getParentFilter()->getOutput()->GetCellData()->GetScalars();
 
   setConnectedInput(true);
@@ -133,7 +135,7 @@ void VSThresholdFilter::applyValues(VSThresholdValues* values)
 {
   if(values)
   {
-    apply(values->getArrayName(), values->getMinValue(), values->getMaxValue());
+    apply(values->getRanges(), values->getCombineMode());
   }
 }
 
@@ -142,21 +144,69 @@ void VSThresholdFilter::applyValues(VSThresholdValues* values)
 // -----------------------------------------------------------------------------
 void VSThresholdFilter::apply(QString arrayName, double min, double max)
 {
-  if(nullptr == m_ThresholdAlgorithm)
+  VSThresholdValues::RangeList ranges;
+  ranges.push_back({arrayName, min, max});
+  apply(ranges, VSThresholdValues::CombineMode::All);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdFilter::apply(VSThresholdValues::RangeList ranges, VSThresholdValues::CombineMode mode)
+{
+  if(ranges.empty())
+  {
+    return;
+  }
+
+  const QString arrayName = ranges[0].arrayName;
+  const double min = ranges[0].minValue;
+  const double max = ranges[0].maxValue;
+
+  abortApply();
+
+  if(nullptr == m_ThresholdAlgorithm || isCancelingApply())
   {
     createFilter();
   }
 
+  const bool imageInput = getParentFilter() && IMAGE_DATA == getParentFilter()->getOutputType();
+  m_AppliedImageBlanking = useImageBlanking();
+
   // Save the applied values for resetting Threshold-Type widgets
   m_ThresholdValues->setLastArrayName(arrayName);
   m_ThresholdValues->setLastMinValue(min);
   m_ThresholdValues->setLastMaxValue(max);
+  m_ThresholdValues->setLastAdditionalRanges(VSThresholdValues::RangeList(ranges.begin() + 1, ranges.end()));
+  m_ThresholdValues->setLastCombineMode(mode);
+
+  // Evaluate every range in one pass instead of chaining threshold filters.  Image
+  // data that cannot be blanked is extracted the same way so that cells hidden by a
+  // blanked ancestor stay hidden.
+  if(ranges.size() > 1 || (imageInput && false == m_AppliedImageBlanking))
+  {
+    m_CompoundThresholdAlgorithm->RemoveAllRanges();
+    for(const VSThresholdValues::Range& range : ranges)
+    {
+      m_CompoundThresholdAlgorithm->AddRange(qPrintable(range.arrayName), range.minValue, range.maxValue);
+    }
+    m_CompoundThresholdAlgorithm->SetCombineMode(VSThresholdValues::CombineMode::Any == mode ? VSCompoundThreshold::COMBINE_ANY : VSCompoundThreshold::COMBINE_ALL);
+    m_CompoundThresholdAlgorithm->SetBlankImages(m_AppliedImageBlanking);
+    executeAlgorithm(m_CompoundThresholdAlgorithm);
+    return;
+  }
+
+  if(m_AppliedImageBlanking)
+  {
+    m_ImageThresholdAlgorithm->ThresholdBetween(min, max);
+    m_ImageThresholdAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(arrayName));
+    executeAlgorithm(m_ImageThresholdAlgorithm);
+    return;
+  }
 
   m_ThresholdAlgorithm->ThresholdBetween(min, max);
   m_ThresholdAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(arrayName));
-  m_ThresholdAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  executeAlgorithm(m_ThresholdAlgorithm);
 }
 
 // -----------------------------------------------------------------------------
@@ -191,9 +241,9 @@ QUuid VSThresholdFilter::GetUuid()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSThresholdFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_ThresholdAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ThresholdAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -208,9 +258,9 @@ vtkAlgorithmOutput* VSThresholdFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSThresholdFilter::getOutput() const
 {
-  if(getConnectedInput() && m_ThresholdAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ThresholdAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -234,7 +284,8 @@ void VSThresholdFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_ThresholdAlgorithm)
   {
-    m_ThresholdAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Rerun the last applied values against the new input
+    apply(m_ThresholdValues->getLastRanges(), m_ThresholdValues->getLastCombineMode());
   }
   else
   {
@@ -247,7 +298,65 @@ void VSThresholdFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 // -----------------------------------------------------------------------------
 VSAbstractFilter::dataType_t VSThresholdFilter::getOutputType() const
 {
-  return UNSTRUCTURED_GRID;
+  return useImageBlanking() ? IMAGE_DATA : UNSTRUCTURED_GRID;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSThresholdFilter::useImageBlanking() const
+{
+  if(nullptr == getParentFilter() || IMAGE_DATA != getParentFilter()->getOutputType())
+  {
+    return false;
+  }
+
+  // Filters such as clips and slices would show the hidden cells
+  for(VSAbstractFilter* child : getChildren())
+  {
+    if(false == child->acceptsBlankedInput())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdFilter::updateImageBlanking()
+{
+  if((hasAppliedOutput() || isApplying()) && m_AppliedImageBlanking != useImageBlanking())
+  {
+    apply(m_ThresholdValues->getLastRanges(), m_ThresholdValues->getLastCombineMode());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSThresholdFilter::hasBlankedOutput() const
+{
+  return useImageBlanking();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSThresholdFilter::acceptsBlankedInput() const
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdFilter::childrenChanged()
+{
+  // Children can be added while importing on another thread
+  QMetaObject::invokeMethod(this, "updateImageBlanking", Qt::QueuedConnection);
 }
 
 // -----------------------------------------------------------------------------
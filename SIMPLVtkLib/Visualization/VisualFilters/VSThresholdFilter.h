@@ -40,6 +40,8 @@
 #include <vtkThreshold.h>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCompoundThreshold.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSImageBlankingThreshold.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdValues.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -115,6 +117,15 @@ public:
    */
   Q_INVOKABLE void apply(QString arrayName, double min, double max);
 
+  /**
+   * @brief Applies a compound threshold over several arrays in a single pass.
+   * Cells must pass all of the ranges or any of the ranges depending on the
+   * combine mode.  The first range is treated as the primary array range.
+   * @param ranges
+   * @param mode
+   */
+  void apply(VSThresholdValues::RangeList ranges, VSThresholdValues::CombineMode mode);
+
   /**
    * @brief Returns the output port to be used by vtkMappers and subsequent filters
    * @return
@@ -133,6 +144,18 @@ public:
    */
   dataType_t getOutputType() const override;
 
+  /**
+   * @brief Returns true while the parent's image data is blanked instead of extracted
+   * @return
+   */
+  bool hasBlankedOutput() const override;
+
+  /**
+   * @brief Returns true because cells hidden by a blanked input are never kept
+   * @return
+   */
+  bool acceptsBlankedInput() const override;
+
   /**
    * @brief Returns the required input data type
    * @return
@@ -198,8 +221,32 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Re-applies the filter when a new or removed child changes whether the
+   * output can be blanked
+   */
+  void childrenChanged() override;
+
+  /**
+   * @brief Returns true if the parent output is a vtkImageData that should be
+   * blanked instead of extracted into a vtkUnstructuredGrid.  The parent's declared
+   * output type is used so that its data is never generated to decide this.
+   * Blanking is only used while every child filter skips hidden cells.
+   * @return
+   */
+  bool useImageBlanking() const;
+
+protected slots:
+  /**
+   * @brief Re-applies the last values if the output no longer matches useImageBlanking
+   */
+  void updateImageBlanking();
+
 private:
   VTK_PTR(vtkThreshold) m_ThresholdAlgorithm;
+  VTK_PTR(VSImageBlankingThreshold) m_ImageThresholdAlgorithm;
+  VTK_PTR(VSCompoundThreshold) m_CompoundThresholdAlgorithm;
+  bool m_AppliedImageBlanking = false;
   VSThresholdValues* m_ThresholdValues = nullptr;
 };
 
@@ -35,6 +35,11 @@
 
 #include "VSThresholdValues.h"
 
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLVtkLib/QtWidgets/VSHistogramWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdFilter.h"
 #include "ui_VSThresholdFilterWidget.h"
 
@@ -74,6 +79,10 @@ VSThresholdValues::VSThresholdValues(const VSThresholdValues& values)
   setLastArrayName(values.getLastArrayName());
   setLastMaxValue(values.getLastMaxValue());
   setLastMinValue(values.getLastMinValue());
+  m_AdditionalRanges = values.m_AdditionalRanges;
+  m_CombineMode = values.m_CombineMode;
+  m_LastAdditionalRanges = values.m_LastAdditionalRanges;
+  m_LastCombineMode = values.m_LastCombineMode;
 }
 
 // -----------------------------------------------------------------------------
@@ -111,6 +120,8 @@ void VSThresholdValues::resetValues()
   setArrayName(getLastArrayName());
   setMinValue(getLastMinValue());
   setMaxValue(getLastMaxValue());
+  setAdditionalRanges(getLastAdditionalRanges());
+  setCombineMode(getLastCombineMode());
 }
 
 // -----------------------------------------------------------------------------
@@ -138,6 +149,21 @@ bool VSThresholdValues::hasChanges() const
     return true;
   }
 
+  if(getCombineMode() != getLastCombineMode() || m_AdditionalRanges.size() != m_LastAdditionalRanges.size())
+  {
+    return true;
+  }
+
+  for(size_t i = 0; i < m_AdditionalRanges.size(); i++)
+  {
+    const Range& range = m_AdditionalRanges[i];
+    const Range& lastRange = m_LastAdditionalRanges[i];
+    if(range.arrayName != lastRange.arrayName || range.minValue != lastRange.minValue || range.maxValue != lastRange.maxValue)
+    {
+      return true;
+    }
+  }
+
   return false;
 }
 
@@ -165,7 +191,34 @@ QWidget* VSThresholdValues::createFilterWidget()
   ui->minSpinBox->setValue(getMinValue());
   ui->maxSpinBox->setValue(getMaxValue());
 
-  connect(this, &VSThresholdValues::arrayNameChanged, [=](QString name) { ui->scalarsComboBox->setCurrentText(name); });
+  // The histogram shows the distribution of the values being thresholded.  It is
+  // computed on a worker thread and only the latest request is shown.
+  QFutureWatcher<VSHistogram>* histogramWatcher = new QFutureWatcher<VSHistogram>(filterWidget);
+  connect(histogramWatcher, &QFutureWatcher<VSHistogram>::finished, ui->histogramWidget, [=] {
+    if(histogramWatcher->future().resultCount() == 0)
+    {
+      return;
+    }
+    ui->histogramWidget->setHistogram(histogramWatcher->result());
+    ui->histogramWidget->setSelectedRange(getMinValue(), getMaxValue());
+  });
+  auto updateHistogram = [=] {
+    VSAbstractFilter* parentFilter = getFilter()->getParentFilter();
+    if(nullptr == parentFilter)
+    {
+      histogramWatcher->setFuture(QFuture<VSHistogram>());
+      ui->histogramWidget->setHistogram(VSHistogram());
+      return;
+    }
+
+    histogramWatcher->setFuture(parentFilter->getArrayHistogramAsync(m_ThresholdArrayName));
+  };
+  updateHistogram();
+
+  connect(this, &VSThresholdValues::arrayNameChanged, [=](QString name) {
+    ui->scalarsComboBox->setCurrentText(name);
+    updateHistogram();
+  });
   connect(this, &VSThresholdValues::rangeChanged, [=](double range[2]) {
     ui->minSpinBox->setMinimum(range[0]);
     ui->maxSpinBox->setMinimum(range[0]);
@@ -177,6 +230,7 @@ QWidget* VSThresholdValues::createFilterWidget()
     ui->minSlider->setValue(getMinPercent() * numTicks);
     ui->minSpinBox->setValue(value);
     ui->minSlider->blockSignals(false);
+    ui->histogramWidget->setSelectedRange(getMinValue(), getMaxValue());
   });
   connect(this, &VSThresholdValues::maxValueChanged, [=](double value) {
     ui->maxSlider->blockSignals(true);
@@ -185,6 +239,7 @@ QWidget* VSThresholdValues::createFilterWidget()
     ui->maxSlider->setValue(getMaxPercent() * numTicks);
     ui->maxSpinBox->setValue(value);
     ui->maxSlider->blockSignals(false);
+    ui->histogramWidget->setSelectedRange(getMinValue(), getMaxValue());
   });
   connect(getFilter(), &VSAbstractFilter::arrayNamesChanged, this, [=] {
     QStringList scalarNames = getFilter()->getScalarNames();
@@ -218,6 +273,14 @@ QWidget* VSThresholdValues::createFilterWidget()
     double percent = static_cast<double>(tick) / numTicks;
     setMaxPercent(percent);
   });
+  connect(ui->histogramWidget, &VSHistogramWidget::rangeSelected, [=](double min, double max) {
+    setMinValue(min);
+    setMaxValue(max);
+  });
+  if(getFilter()->getParentFilter())
+  {
+    connect(getFilter()->getParentFilter(), &VSAbstractFilter::updatedOutputPort, ui->histogramWidget, updateHistogram);
+  }
   connect(ui->minSpinBox, &QDoubleSpinBox::editingFinished, [=] { setMinValue(ui->minSpinBox->value()); });
   connect(ui->maxSpinBox, &QDoubleSpinBox::editingFinished, [=] { setMaxValue(ui->maxSpinBox->value()); });
 
@@ -448,6 +511,22 @@ void VSThresholdValues::readJson(QJsonObject& json)
   m_LastArrayName = json["Last Array Name"].toString();
   m_LastMinValue = json["Last Minimum Value"].toDouble();
   m_LastMaxValue = json["Last Maximum Value"].toDouble();
+
+  m_LastAdditionalRanges.clear();
+  QJsonArray rangesJson = json["Last Additional Ranges"].toArray();
+  for(const QJsonValue& rangeValue : rangesJson)
+  {
+    QJsonObject rangeJson = rangeValue.toObject();
+    m_LastAdditionalRanges.push_back({rangeJson["Array Name"].toString(), rangeJson["Minimum Value"].toDouble(), rangeJson["Maximum Value"].toDouble()});
+  }
+
+  // Unknown modes from newer or hand-edited files fall back to requiring every range
+  int combineMode = json["Last Combine Mode"].toInt(static_cast<int>(CombineMode::All));
+  m_LastCombineMode = (static_cast<int>(CombineMode::Any) == combineMode) ? CombineMode::Any : CombineMode::All;
+
+  // Additional ranges have no widget of their own so start from the loaded values
+  m_AdditionalRanges = m_LastAdditionalRanges;
+  m_CombineMode = m_LastCombineMode;
 }
 
 // -----------------------------------------------------------------------------
@@ -458,4 +537,104 @@ void VSThresholdValues::writeJson(QJsonObject& json)
   json["Last Array Name"] = m_LastArrayName;
   json["Last Minimum Value"] = m_LastMinValue;
   json["Last Maximum Value"] = m_LastMaxValue;
+
+  QJsonArray rangesJson;
+  for(const Range& range : m_LastAdditionalRanges)
+  {
+    QJsonObject rangeJson;
+    rangeJson["Array Name"] = range.arrayName;
+    rangeJson["Minimum Value"] = range.minValue;
+    rangeJson["Maximum Value"] = range.maxValue;
+    rangesJson.append(rangeJson);
+  }
+  json["Last Additional Ranges"] = rangesJson;
+  json["Last Combine Mode"] = static_cast<int>(m_LastCombineMode);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSThresholdValues::RangeList VSThresholdValues::getAdditionalRanges() const
+{
+  return m_AdditionalRanges;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdValues::setAdditionalRanges(RangeList ranges)
+{
+  m_AdditionalRanges = ranges;
+  emit alertChangesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSThresholdValues::CombineMode VSThresholdValues::getCombineMode() const
+{
+  return m_CombineMode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdValues::setCombineMode(CombineMode mode)
+{
+  m_CombineMode = mode;
+  emit alertChangesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSThresholdValues::RangeList VSThresholdValues::getRanges() const
+{
+  RangeList ranges;
+  ranges.push_back({getArrayName(), getMinValue(), getMaxValue()});
+  ranges.insert(ranges.end(), m_AdditionalRanges.begin(), m_AdditionalRanges.end());
+  return ranges;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSThresholdValues::RangeList VSThresholdValues::getLastAdditionalRanges() const
+{
+  return m_LastAdditionalRanges;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdValues::setLastAdditionalRanges(RangeList ranges)
+{
+  m_LastAdditionalRanges = ranges;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSThresholdValues::CombineMode VSThresholdValues::getLastCombineMode() const
+{
+  return m_LastCombineMode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdValues::setLastCombineMode(CombineMode mode)
+{
+  m_LastCombineMode = mode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSThresholdValues::RangeList VSThresholdValues::getLastRanges() const
+{
+  RangeList ranges;
+  ranges.push_back({getLastArrayName(), getLastMinValue(), getLastMaxValue()});
+  ranges.insert(ranges.end(), m_LastAdditionalRanges.begin(), m_LastAdditionalRanges.end());
+  return ranges;
 }
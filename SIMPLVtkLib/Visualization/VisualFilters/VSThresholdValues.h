@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "VSAbstractFilterValues.h"
 
 class VSThresholdFilter;
@@ -56,6 +58,26 @@ class SIMPLVtkLib_EXPORT VSThresholdValues : public VSAbstractFilterValues
 public:
   using FilterType = VSThresholdFilter;
 
+  /**
+   * @brief A single array range used by compound thresholds
+   */
+  struct Range
+  {
+    QString arrayName;
+    double minValue;
+    double maxValue;
+  };
+  using RangeList = std::vector<Range>;
+
+  /**
+   * @brief How the ranges of a compound threshold are combined
+   */
+  enum class CombineMode : int
+  {
+    All = 0,
+    Any = 1
+  };
+
   VSThresholdValues(VSThresholdFilter* filter);
   VSThresholdValues(const VSThresholdValues& values);
   virtual ~VSThresholdValues();
@@ -160,6 +182,66 @@ public:
    */
   void setLastMaxValue(double lastMaxValue);
 
+  /**
+   * @brief Returns the ranges evaluated in addition to the current array range
+   * @return
+   */
+  RangeList getAdditionalRanges() const;
+
+  /**
+   * @brief Sets the ranges evaluated in addition to the current array range
+   * @param ranges
+   */
+  void setAdditionalRanges(RangeList ranges);
+
+  /**
+   * @brief Returns how the current ranges are combined
+   * @return
+   */
+  CombineMode getCombineMode() const;
+
+  /**
+   * @brief Sets how the current ranges are combined
+   * @param mode
+   */
+  void setCombineMode(CombineMode mode);
+
+  /**
+   * @brief Returns the current array range followed by the additional ranges
+   * @return
+   */
+  RangeList getRanges() const;
+
+  /**
+   * @brief Returns the additional ranges last used for thresholding
+   * @return
+   */
+  RangeList getLastAdditionalRanges() const;
+
+  /**
+   * @brief Sets the additional ranges last used for thresholding
+   * @param ranges
+   */
+  void setLastAdditionalRanges(RangeList ranges);
+
+  /**
+   * @brief Returns the combine mode last used for thresholding
+   * @return
+   */
+  CombineMode getLastCombineMode() const;
+
+  /**
+   * @brief Sets the combine mode last used for thresholding
+   * @param mode
+   */
+  void setLastCombineMode(CombineMode mode);
+
+  /**
+   * @brief Returns the last applied array range followed by the last additional ranges
+   * @return
+   */
+  RangeList getLastRanges() const;
+
   /**
    * @brief Update values from the given Json
    * @param json
@@ -222,4 +304,8 @@ private:
   double m_LastMinValue = 0.0;
   double m_LastMaxValue = 99.9;
   bool m_FreshFilter = true;
+  RangeList m_AdditionalRanges;
+  CombineMode m_CombineMode = CombineMode::All;
+  RangeList m_LastAdditionalRanges;
+  CombineMode m_LastCombineMode = CombineMode::All;
 };
@@ -43,6 +43,8 @@
 VSTransform::VSTransform(VSTransform* parent)
 {
   m_LocalTransform = VTK_PTR(vtkTransform)::New();
+  m_GlobalMatrix = VTK_PTR(vtkMatrix4x4)::New();
+  m_GlobalTransform = VTK_PTR(vtkTransform)::New();
 
   setParent(parent);
   setupSignals();
@@ -55,9 +57,13 @@ VSTransform::VSTransform(const VSTransform& copy)
 {
   m_LocalTransform = VTK_PTR(vtkTransform)::New();
   m_LocalTransform->DeepCopy(copy.m_LocalTransform);
+  m_GlobalMatrix = VTK_PTR(vtkMatrix4x4)::New();
+  m_GlobalTransform = VTK_PTR(vtkTransform)::New();
 
   setParent(copy.getParent());
   setOriginPosition(copy.getOriginPosition());
+  setOriginRotation(copy.getOriginRotation());
+  setOriginScale(copy.getOriginScale());
   setupSignals();
 }
 
@@ -66,19 +72,25 @@ VSTransform::VSTransform(const VSTransform& copy)
 // -----------------------------------------------------------------------------
 void VSTransform::setupSignals()
 {
+  // Parent changes are forwarded through the emit signals, so the cached global
+  // values are invalidated before any listeners request the updated values.
   connect(this, &VSTransform::emitPosition, this, [=] {
+    m_GlobalValuesDirty = true;
     emit updatedPosition();
     emit valuesChanged();
   });
   connect(this, &VSTransform::emitRotation, this, [=] {
+    m_GlobalValuesDirty = true;
     emit updatedRotation();
     emit valuesChanged();
   });
   connect(this, &VSTransform::emitScale, this, [=] {
+    m_GlobalValuesDirty = true;
     emit updatedScale();
     emit valuesChanged();
   });
   connect(this, &VSTransform::emitAll, this, [=] {
+    m_GlobalValuesDirty = true;
     emit updatedPosition();
     emit updatedRotation();
     emit updatedScale();
@@ -109,6 +121,7 @@ void VSTransform::setParent(VSTransform* parent)
   }
 
   m_Parent = parent;
+  m_GlobalValuesDirty = true;
 
   if(parent)
   {
@@ -132,54 +145,43 @@ VSTransform* VSTransform::getParent() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getPosition()
+std::array<double, 3> VSTransform::getPosition()
 {
-  double* position = new double[3];
-  getGlobalTransform()->GetPosition(position);
-  return position;
+  updateGlobalValues();
+  return m_GlobalPosition;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getLocalPosition()
+std::array<double, 3> VSTransform::getLocalPosition()
 {
-  double* position = new double[3];
-  m_LocalTransform->GetPosition(position);
+  std::array<double, 3> position;
+  m_LocalTransform->GetPosition(position.data());
   return position;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getRotation()
+std::array<double, 3> VSTransform::getRotation()
 {
   if(nullptr == m_Parent)
   {
     return getLocalRotation();
   }
 
-  double* rotation = new double[3];
-  getGlobalTransform()->GetOrientation(rotation);
-
-  for(int i = 0; i < 3; i++)
-  {
-    if(abs(rotation[i]) < 0.0001)
-    {
-      rotation[i] = 0.0;
-    }
-  }
-
-  return rotation;
+  updateGlobalValues();
+  return m_GlobalRotation;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getLocalRotation()
+std::array<double, 3> VSTransform::getLocalRotation()
 {
-  double* rotation = new double[3];
-  m_LocalTransform->GetOrientation(rotation);
+  std::array<double, 3> rotation;
+  m_LocalTransform->GetOrientation(rotation.data());
 
   for(int i = 0; i < 3; i++)
   {
@@ -195,20 +197,19 @@ double* VSTransform::getLocalRotation()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getScale()
+std::array<double, 3> VSTransform::getScale()
 {
-  double* scale = new double[3];
-  getGlobalTransform()->GetScale(scale);
-  return scale;
+  updateGlobalValues();
+  return m_GlobalScale;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getLocalScale()
+std::array<double, 3> VSTransform::getLocalScale()
 {
-  double* scale = new double[3];
-  m_LocalTransform->GetScale(scale);
+  std::array<double, 3> scale;
+  m_LocalTransform->GetScale(scale.data());
   return scale;
 }
 
@@ -258,14 +259,53 @@ void VSTransform::scale(double amount[3])
 VTK_PTR(vtkTransform) VSTransform::getGlobalTransform()
 {
   VTK_NEW(vtkTransform, transform);
-  transform->DeepCopy(m_LocalTransform);
+  transform->SetMatrix(getGlobalMatrix());
+
+  return transform;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkMatrix4x4* VSTransform::getGlobalMatrix()
+{
+  updateGlobalValues();
+  return m_GlobalMatrix;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::updateGlobalValues()
+{
+  if(!m_GlobalValuesDirty)
+  {
+    return;
+  }
 
   if(m_Parent)
   {
-    transform->SetInput(m_Parent->getGlobalTransform());
+    vtkMatrix4x4::Multiply4x4(m_Parent->getGlobalMatrix(), m_LocalTransform->GetMatrix(), m_GlobalMatrix);
+  }
+  else
+  {
+    m_GlobalMatrix->DeepCopy(m_LocalTransform->GetMatrix());
   }
 
-  return transform;
+  m_GlobalTransform->SetMatrix(m_GlobalMatrix);
+  m_GlobalTransform->GetPosition(m_GlobalPosition.data());
+  m_GlobalTransform->GetOrientation(m_GlobalRotation.data());
+  m_GlobalTransform->GetScale(m_GlobalScale.data());
+
+  for(int i = 0; i < 3; i++)
+  {
+    if(abs(m_GlobalRotation[i]) < 0.0001)
+    {
+      m_GlobalRotation[i] = 0.0;
+    }
+  }
+
+  m_GlobalValuesDirty = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -347,14 +387,8 @@ void VSTransform::setLocalValues(double position[3], double rotation[3], double
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getPositionVector()
 {
-  double* positionPtr = getPosition();
-  std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = positionPtr[i];
-  }
-
-  return outputVector;
+  std::array<double, 3> position = getPosition();
+  return std::vector<double>(position.begin(), position.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -362,14 +396,8 @@ std::vector<double> VSTransform::getPositionVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getRotationVector()
 {
-  double* rotationPtr = getRotation();
-  std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = rotationPtr[i];
-  }
-
-  return outputVector;
+  std::array<double, 3> rotation = getRotation();
+  return std::vector<double>(rotation.begin(), rotation.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -377,14 +405,8 @@ std::vector<double> VSTransform::getRotationVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getScaleVector()
 {
-  double* scalePtr = getScale();
-  std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = scalePtr[i];
-  }
-
-  return outputVector;
+  std::array<double, 3> scale = getScale();
+  return std::vector<double>(scale.begin(), scale.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -392,14 +414,8 @@ std::vector<double> VSTransform::getScaleVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getLocalPositionVector()
 {
-  double* localPositionPtr = getLocalPosition();
-  std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = localPositionPtr[i];
-  }
-
-  return outputVector;
+  std::array<double, 3> localPosition = getLocalPosition();
+  return std::vector<double>(localPosition.begin(), localPosition.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -407,14 +423,8 @@ std::vector<double> VSTransform::getLocalPositionVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getLocalRotationVector()
 {
-  double* localRotationPtr = getLocalRotation();
-  std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = localRotationPtr[i];
-  }
-
-  return outputVector;
+  std::array<double, 3> localRotation = getLocalRotation();
+  return std::vector<double>(localRotation.begin(), localRotation.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -422,14 +432,8 @@ std::vector<double> VSTransform::getLocalRotationVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getLocalScaleVector()
 {
-  double* localScalePtr = getLocalScale();
-  std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = localScalePtr[i];
-  }
-
-  return outputVector;
+  std::array<double, 3> localScale = getLocalScale();
+  return std::vector<double>(localScale.begin(), localScale.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -488,6 +492,15 @@ void VSTransform::setLocalPosition(double position[3])
   emit updatedLocalPosition();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setLocalPosition(const std::array<double, 3>& position)
+{
+  double values[3] = {position[0], position[1], position[2]};
+  setLocalPosition(values);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -505,6 +518,15 @@ void VSTransform::setLocalRotation(double rotation[3])
   emit updatedLocalRotation();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setLocalRotation(const std::array<double, 3>& rotation)
+{
+  double values[3] = {rotation[0], rotation[1], rotation[2]};
+  setLocalRotation(values);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -522,6 +544,15 @@ void VSTransform::setLocalScale(double scale[3])
   emit updatedLocalScale();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setLocalScale(const std::array<double, 3>& scale)
+{
+  double values[3] = {scale[0], scale[1], scale[2]};
+  setLocalScale(values);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -707,7 +738,7 @@ void VSTransform::updateTransform(vtkTransform* transform)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getOriginPosition() const
+std::array<double, 3> VSTransform::getOriginPosition() const
 {
   return m_OriginPosition;
 }
@@ -715,7 +746,18 @@ double* VSTransform::getOriginPosition() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSTransform::setOriginPosition(double* originPosition)
+void VSTransform::setOriginPosition(const double originPosition[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    m_OriginPosition[i] = originPosition[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setOriginPosition(const std::array<double, 3>& originPosition)
 {
   m_OriginPosition = originPosition;
 }
@@ -723,7 +765,7 @@ void VSTransform::setOriginPosition(double* originPosition)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getOriginRotation() const
+std::array<double, 3> VSTransform::getOriginRotation() const
 {
   return m_OriginRotation;
 }
@@ -731,7 +773,18 @@ double* VSTransform::getOriginRotation() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSTransform::setOriginRotation(double* originRotation)
+void VSTransform::setOriginRotation(const double originRotation[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    m_OriginRotation[i] = originRotation[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setOriginRotation(const std::array<double, 3>& originRotation)
 {
   m_OriginRotation = originRotation;
 }
@@ -739,7 +792,7 @@ void VSTransform::setOriginRotation(double* originRotation)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSTransform::getOriginScale() const
+std::array<double, 3> VSTransform::getOriginScale() const
 {
   return m_OriginScale;
 }
@@ -747,7 +800,18 @@ double* VSTransform::getOriginScale() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSTransform::setOriginScale(double* originScale)
+void VSTransform::setOriginScale(const double originScale[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    m_OriginScale[i] = originScale[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setOriginScale(const std::array<double, 3>& originScale)
 {
   m_OriginScale = originScale;
 }
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <array>
+
 #include <QtCore/QObject>
 
 #include <vtkMatrix4x4.h>
@@ -50,7 +52,9 @@
  * @class VSTransform VSTransform.h SIMPLVtkLib/Visualization/VisualFilters/VSTransform.h
  * @brief This class stores the local coordinates for placing an object in 3D
  * space including local values for position, rotation, and scale. Global values
- * are found by applying the local value to the parent's global value.
+ * are found by applying the local value to the parent's global value.  The global
+ * matrix and values are cached and only recalculated after the transform or one
+ * of its parents emits a change.
  */
 class SIMPLVtkLib_EXPORT VSTransform : public QObject
 {
@@ -158,37 +162,37 @@ public:
    * @brief Returns the transform's global position in 3D space
    * @return
    */
-  double* getPosition();
+  std::array<double, 3> getPosition();
 
   /**
    * @brief Returns the transform's local position in 3D space
    * @return
    */
-  double* getLocalPosition();
+  std::array<double, 3> getLocalPosition();
 
   /**
    * @brief Returns the transform's global Euler rotation
    * @return
    */
-  double* getRotation();
+  std::array<double, 3> getRotation();
 
   /**
    * @brief Returns the transform's local Euler rotation
    * @return
    */
-  double* getLocalRotation();
+  std::array<double, 3> getLocalRotation();
 
   /**
    * @brief Returns the transform's global scale
    * @return
    */
-  double* getScale();
+  std::array<double, 3> getScale();
 
   /**
    * @brief Returns the transform's local scale
    * @return
    */
-  double* getLocalScale();
+  std::array<double, 3> getLocalScale();
 
   /**
    * @brief Sets the transform's local position
@@ -196,18 +200,36 @@ public:
    */
   void setLocalPosition(double position[3]);
 
+  /**
+   * @brief Sets the transform's local position
+   * @param position
+   */
+  void setLocalPosition(const std::array<double, 3>& position);
+
   /**
    * @brief Sets the transform's local Euler rotation
    * @param rotation
    */
   void setLocalRotation(double rotation[3]);
 
+  /**
+   * @brief Sets the transform's local Euler rotation
+   * @param rotation
+   */
+  void setLocalRotation(const std::array<double, 3>& rotation);
+
   /**
    * @brief Sets the transform's local scale
    * @param scale
    */
   void setLocalScale(double scale[3]);
 
+  /**
+   * @brief Sets the transform's local scale
+   * @param scale
+   */
+  void setLocalScale(const std::array<double, 3>& scale);
+
   /**
    * @brief Translates the object in global space
    * @param delta
@@ -234,11 +256,18 @@ public:
   void scale(double amount[3]);
 
   /**
-   * @brief Returns the vtkTransform describing the global position, rotation, and scale.
+   * @brief Returns a new vtkTransform describing the global position, rotation, and scale.
    * @return
    */
   VTK_PTR(vtkTransform) getGlobalTransform();
 
+  /**
+   * @brief Returns the cached matrix describing the global position, rotation, and scale.
+   * The matrix is owned by the VSTransform and updated in place when the transform changes.
+   * @return
+   */
+  vtkMatrix4x4* getGlobalMatrix();
+
   /**
    * @brief Localizes the given point from global space
    * @param point
@@ -327,37 +356,55 @@ public:
    * @brief Get the origin position of the transform
    * @return origin
    */
-  double* getOriginPosition() const;
+  std::array<double, 3> getOriginPosition() const;
 
   /**
    * @brief Set the origin position of the transform
    * @param originPosition
    */
-  void setOriginPosition(double* originPosition);
+  void setOriginPosition(const double originPosition[3]);
+
+  /**
+   * @brief Set the origin position of the transform
+   * @param originPosition
+   */
+  void setOriginPosition(const std::array<double, 3>& originPosition);
 
   /**
    * @brief Get the origin of the transform
    * @return originRotation
    */
-  double* getOriginRotation() const;
+  std::array<double, 3> getOriginRotation() const;
+
+  /**
+   * @brief Set the origin rotation of the transform
+   * @param originRotation
+   */
+  void setOriginRotation(const double originRotation[3]);
 
   /**
    * @brief Set the origin rotation of the transform
    * @param originRotation
    */
-  void setOriginRotation(double* originRotation);
+  void setOriginRotation(const std::array<double, 3>& originRotation);
 
   /**
    * @brief Get the origin scale of the transform
    * @return originScale
    */
-  double* getOriginScale() const;
+  std::array<double, 3> getOriginScale() const;
 
   /**
    * @brief Set the origin scale of the transform
    * @param originScale
    */
-  void setOriginScale(double* originScale);
+  void setOriginScale(const double originScale[3]);
+
+  /**
+   * @brief Set the origin scale of the transform
+   * @param originScale
+   */
+  void setOriginScale(const std::array<double, 3>& originScale);
 
 signals:
   void updatedPosition();
@@ -424,11 +471,24 @@ protected:
    */
   static void updateTransform(vtkTransform* transform);
 
+  /**
+   * @brief Recalculates the cached global matrix and values if the transform
+   * or one of its parents has changed since they were last calculated.
+   */
+  void updateGlobalValues();
+
 private:
   VSTransform* m_Parent = nullptr;
 
-  double* m_OriginPosition;
-  double* m_OriginRotation;
-  double* m_OriginScale;
+  std::array<double, 3> m_OriginPosition = {{0.0, 0.0, 0.0}};
+  std::array<double, 3> m_OriginRotation = {{0.0, 0.0, 0.0}};
+  std::array<double, 3> m_OriginScale = {{1.0, 1.0, 1.0}};
   VTK_PTR(vtkTransform) m_LocalTransform;
+
+  bool m_GlobalValuesDirty = true;
+  VTK_PTR(vtkMatrix4x4) m_GlobalMatrix;
+  VTK_PTR(vtkTransform) m_GlobalTransform;
+  std::array<double, 3> m_GlobalPosition = {{0.0, 0.0, 0.0}};
+  std::array<double, 3> m_GlobalRotation = {{0.0, 0.0, 0.0}};
+  std::array<double, 3> m_GlobalScale = {{1.0, 1.0, 1.0}};
 };
@@ -35,6 +35,33 @@
 
 #include "VSAbstractWidget.h"
 
+#include <vtkCallbackCommand.h>
+#include <vtkCommand.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+namespace
+{
+/**
+ * @brief Emits the matching VSAbstractWidget signal for vtkWidget interaction events
+ */
+void InteractionCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  Q_UNUSED(caller)
+  Q_UNUSED(callData)
+
+  VSAbstractWidget* widget = static_cast<VSAbstractWidget*>(clientData);
+  if(eventId == vtkCommand::StartInteractionEvent)
+  {
+    emit widget->interactionStarted();
+  }
+  else if(eventId == vtkCommand::EndInteractionEvent)
+  {
+    emit widget->interactionEnded();
+  }
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -141,3 +168,16 @@ VSTransform* VSAbstractWidget::getVSTransform()
 {
   return m_Transform;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractWidget::observeInteraction(vtkAbstractWidget* widget)
+{
+  VTK_NEW(vtkCallbackCommand, interactionCallback);
+  interactionCallback->SetCallback(InteractionCallback);
+  interactionCallback->SetClientData(this);
+
+  widget->AddObserver(vtkCommand::StartInteractionEvent, interactionCallback);
+  widget->AddObserver(vtkCommand::EndInteractionEvent, interactionCallback);
+}
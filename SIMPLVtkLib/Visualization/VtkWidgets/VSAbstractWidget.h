@@ -43,6 +43,7 @@
 
 #include <vector>
 
+#include <vtkAbstractWidget.h>
 #include <vtkImplicitFunction.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkSmartPointer.h>
@@ -122,6 +123,8 @@ public:
 
 signals:
   void modified();
+  void interactionStarted();
+  void interactionEnded();
 
 protected slots:
   /**
@@ -164,6 +167,13 @@ protected:
    */
   VSTransform* getVSTransform();
 
+  /**
+   * @brief Forwards the vtkWidget's start and end interaction events to the
+   * interactionStarted and interactionEnded signals
+   * @param widget
+   */
+  void observeInteraction(vtkAbstractWidget* widget);
+
   const double MIN_SIZE = 6.0;
 
 private:
@@ -152,6 +152,7 @@ VSPlaneWidget::VSPlaneWidget(QWidget* parent, VSTransform* transform, double bou
   m_PlaneWidget->SetInteractor(iren);
   m_PlaneWidget->SetRepresentation(m_PlaneRep);
   m_PlaneWidget->AddObserver(vtkCommand::InteractionEvent, myCallback);
+  observeInteraction(m_PlaneWidget);
 
   updateSpinBoxes();
 